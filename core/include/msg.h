@@ -317,6 +317,62 @@ int msg_receive(msg_t *m);
  */
 int msg_try_receive(msg_t *m);
 
+/**
+ * @brief Receive up to @p max messages at once.
+ *
+ * Drains the message queue of the calling thread into @p out within a single
+ * critical section. Messages of threads blocked in @ref msg_send() on the
+ * calling thread are moved into the freed queue slots afterwards, preserving
+ * the order in which @ref msg_receive() would have returned them.
+ *
+ * This function blocks until at least one message was received.
+ *
+ * @pre     @p max > 0
+ *
+ * @param[out] out  Pointer to preallocated array of at least @p max
+ *                  ``msg_t`` structures, must not be NULL.
+ * @param[in]  max  Maximum number of messages to receive
+ *
+ * @return  Number of messages written to @p out (at least 1)
+ */
+unsigned msg_receive_batch(msg_t *out, unsigned max);
+
+/**
+ * @brief Try to receive up to @p max messages at once.
+ *
+ * Non-blocking variant of @ref msg_receive_batch().
+ *
+ * @param[out] out  Pointer to preallocated array of at least @p max
+ *                  ``msg_t`` structures, must not be NULL.
+ * @param[in]  max  Maximum number of messages to receive
+ *
+ * @return  Number of messages written to @p out, 0 if none was available
+ */
+unsigned msg_try_receive_batch(msg_t *out, unsigned max);
+
+/**
+ * @brief Send multiple messages to a thread at once.
+ *
+ * All messages are delivered within a single critical section and the
+ * scheduler is invoked at most once afterwards. If the target is waiting in
+ * @ref msg_receive() the first message is delivered directly, all following
+ * messages are put into the message queue of the target.
+ *
+ * This function never blocks: Delivery stops at the first message that does
+ * not fit into the target's message queue. May be called from ISR context.
+ *
+ * @param[in] m             Pointer to an array of @p num ``msg_t``
+ *                          structures, must not be NULL. The
+ *                          @ref msg_t::sender_pid field of each delivered
+ *                          message is updated.
+ * @param[in] num           Number of messages in @p m
+ * @param[in] target_pid    PID of target thread
+ *
+ * @return  Number of messages delivered (the first `n` in @p m)
+ * @return  -1, on error (invalid PID)
+ */
+int msg_send_batch(msg_t *m, unsigned num, kernel_pid_t target_pid);
+
 /**
  * @brief Send a message, block until reply received.
  *
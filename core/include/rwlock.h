@@ -0,0 +1,193 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#pragma once
+
+/**
+ * @defgroup    core_sync_rwlock Reader-Writer Lock
+ * @ingroup     core_sync
+ * @brief       Lock allowing either many readers or a single writer
+ *
+ * A reader-writer lock protects data that is read frequently but modified
+ * rarely, such as lookup tables: any number of readers may hold the lock
+ * concurrently, while a writer gets exclusive access.
+ *
+ * Blocked threads are queued in order of their priority. The lock prefers
+ * writers: a thread trying to read blocks as soon as a writer of the same or
+ * higher priority is waiting, so a constant stream of readers cannot starve
+ * writers. Only readers of strictly higher priority than all waiting writers
+ * may still join the current readers.
+ *
+ * When the lock is released, it is handed over directly to the waiter(s) of
+ * highest priority, writers winning ties: either a single writer, or all
+ * waiting readers that are not outranked by a waiting writer.
+ *
+ * @warning Read locks acquired by rwlock_read_lock() are not recursive: a
+ *          thread already holding a read lock will deadlock if it acquires it
+ *          again while a writer is waiting. Use rwlock_read_lock_recursive()
+ *          where the caller may already hold a read lock.
+ *
+ * Example:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * static rwlock_t lock = RWLOCK_INIT;
+ *
+ * [...]
+ * rwlock_read_lock(&lock);
+ * entry = table_lookup(&table, key);
+ * [...]
+ * rwlock_read_unlock(&lock);
+ *
+ * [...]
+ * rwlock_write_lock(&lock);
+ * table_insert(&table, entry);
+ * rwlock_write_unlock(&lock);
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @{
+ *
+ * @file
+ * @brief       Reader-writer lock API
+ */
+
+#include <limits.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "list.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Value of rwlock_t::holders while a writer holds the lock
+ */
+#define RWLOCK_WRITE_LOCKED     (UINT_MAX)
+
+/**
+ * @brief   Reader-writer lock structure. Must never be modified by the user.
+ */
+typedef struct {
+    list_node_t readers;    /**< blocked readers, highest priority first */
+    list_node_t writers;    /**< blocked writers, highest priority first */
+    /**
+     * @brief   Number of readers holding the lock, or
+     *          @ref RWLOCK_WRITE_LOCKED
+     */
+    unsigned holders;
+} rwlock_t;
+
+/**
+ * @brief   Static initializer for rwlock_t
+ */
+#define RWLOCK_INIT             { { NULL }, { NULL }, 0 }
+
+/**
+ * @brief   Initialize a reader-writer lock
+ *
+ * @param[out]  lock    lock to initialize
+ */
+static inline void rwlock_init(rwlock_t *lock)
+{
+    *lock = (rwlock_t)RWLOCK_INIT;
+}
+
+/**
+ * @brief   Acquire a read lock, blocking
+ *
+ * Blocks while a writer holds the lock or a writer of the same or higher
+ * priority is waiting for it.
+ *
+ * @pre     Must be called in thread context
+ *
+ * @param[in,out]   lock    lock to acquire
+ */
+void rwlock_read_lock(rwlock_t *lock);
+
+/**
+ * @brief   Acquire a read lock that the calling thread may already hold
+ *
+ * Other than rwlock_read_lock(), this joins the current readers regardless of
+ * waiting writers, so it does not deadlock if the calling thread already holds
+ * a read lock. It only blocks while a writer holds the lock.
+ *
+ * @pre     Must be called in thread context
+ *
+ * @param[in,out]   lock    lock to acquire
+ */
+void rwlock_read_lock_recursive(rwlock_t *lock);
+
+/**
+ * @brief   Try to acquire a read lock, non-blocking
+ *
+ * @param[in,out]   lock    lock to acquire
+ *
+ * @retval  true    read lock acquired
+ * @retval  false   lock would have blocked
+ */
+bool rwlock_read_trylock(rwlock_t *lock);
+
+/**
+ * @brief   Release a read lock
+ *
+ * @pre     The calling thread holds a read lock on @p lock
+ *
+ * @param[in,out]   lock    lock to release
+ */
+void rwlock_read_unlock(rwlock_t *lock);
+
+/**
+ * @brief   Acquire the write lock, blocking
+ *
+ * @pre     Must be called in thread context
+ *
+ * @param[in,out]   lock    lock to acquire
+ */
+void rwlock_write_lock(rwlock_t *lock);
+
+/**
+ * @brief   Try to acquire the write lock, non-blocking
+ *
+ * @param[in,out]   lock    lock to acquire
+ *
+ * @retval  true    write lock acquired
+ * @retval  false   lock would have blocked
+ */
+bool rwlock_write_trylock(rwlock_t *lock);
+
+/**
+ * @brief   Release the write lock
+ *
+ * @pre     The calling thread holds the write lock on @p lock
+ *
+ * @param[in,out]   lock    lock to release
+ */
+void rwlock_write_unlock(rwlock_t *lock);
+
+/**
+ * @brief   Check if a lock is held by at least one reader
+ *
+ * @note    This is meant for assertions, the result may already be outdated
+ *          when it is returned.
+ *
+ * @param[in]   lock    lock to check
+ *
+ * @returns true if @p lock is read locked
+ */
+static inline bool rwlock_is_read_locked(const rwlock_t *lock)
+{
+    unsigned holders = *(volatile const unsigned *)&lock->holders;
+
+    return (holders != 0) && (holders != RWLOCK_WRITE_LOCKED);
+}
+
+#ifdef __cplusplus
+}
+#endif
+/** @} */
@@ -171,6 +171,7 @@ typedef enum {
     STATUS_FLAG_BLOCKED_ALL,        /**< waiting for all flags in flag_mask       */
     STATUS_MBOX_BLOCKED,            /**< waiting for get/put on mbox              */
     STATUS_COND_BLOCKED,            /**< waiting for a condition variable         */
+    STATUS_RWLOCK_BLOCKED,          /**< waiting for a reader-writer lock         */
     STATUS_RUNNING,                 /**< currently running                        */
     STATUS_PENDING,                 /**< waiting to be scheduled to run           */
     STATUS_NUMOF                    /**< number of supported thread states        */
@@ -344,6 +345,26 @@ static inline void sched_runq_advance(uint8_t prio)
 extern void sched_runq_callback(uint8_t prio);
 #endif
 
+#if (IS_USED(MODULE_SCHED_WAKEUP_CALLBACK)) || defined(DOXYGEN)
+/**
+ * @brief   Scheduler wake-up callback
+ *
+ * @details Function has to be provided by the user of this API.
+ *          It will be called by @ref sched_set_status() with interrupts
+ *          disabled whenever a thread that was not on a runqueue becomes
+ *          runnable, e.g. when it is woken up by a message, a mutex or a
+ *          thread flag.
+ *
+ * @warning This API is not intended for out of tree users.
+ *          Breaking API changes will be done without notice and
+ *          without deprecation. Consider yourself warned!
+ *
+ * @param   pid       the PID of the thread that became runnable
+ *
+ */
+extern void sched_wakeup_callback(kernel_pid_t pid);
+#endif
+
 /**
  * @brief   Tell if the number of threads in a runqueue is 0
  *
@@ -442,6 +442,177 @@ static int _msg_receive(msg_t *m, int block)
     DEBUG("This should have never been reached!\n");
 }
 
+static unsigned _msg_queue_drain(thread_t *me, msg_t *out, unsigned max)
+{
+    cib_t *queue = &me->msg_queue;
+    unsigned count = MIN(cib_avail(queue), max);
+
+    if (count == 0) {
+        return 0;
+    }
+
+    /* the queued messages occupy at most two contiguous spans of msg_array */
+    unsigned first = cib_peek_unsafe(queue);
+    unsigned span = MIN(count, cib_size(queue) - first);
+
+    memcpy(out, &me->msg_array[first], sizeof(msg_t) * span);
+    memcpy(&out[span], &me->msg_array[0], sizeof(msg_t) * (count - span));
+    queue->read_count += count;
+
+    return count;
+}
+
+static unsigned _msg_receive_batch(msg_t *out, unsigned max, int block)
+{
+    assert(max > 0);
+
+    unsigned state = irq_disable();
+    thread_t *me = thread_get_active();
+    unsigned count = 0;
+
+    DEBUG("_msg_receive_batch: %" PRIkernel_pid ": receiving up to %u "
+          "messages.\n", thread_getpid(), max);
+
+    if (thread_has_msg_queue(me)) {
+        count = _msg_queue_drain(me, out, max);
+    }
+
+    /* take over the messages of blocked senders: first into the remaining
+     * space of out, then into the just freed queue space */
+    uint16_t sender_prio = THREAD_PRIORITY_IDLE;
+
+    while (me->msg_waiters.next) {
+        msg_t *dest;
+
+        if (count < max) {
+            dest = &out[count++];
+        }
+        else {
+            int queue_index = -1;
+
+            if (thread_has_msg_queue(me)) {
+                queue_index = cib_put(&me->msg_queue);
+            }
+            if (queue_index < 0) {
+                break;
+            }
+            dest = &me->msg_array[queue_index];
+        }
+
+        list_node_t *next = list_remove_head(&me->msg_waiters);
+        thread_t *sender =
+            container_of((clist_node_t *)next, thread_t, rq_entry);
+
+        *dest = *(msg_t *)sender->wait_data;
+
+        if (sender->status != STATUS_REPLY_BLOCKED) {
+            sender->wait_data = NULL;
+            sched_set_status(sender, STATUS_PENDING);
+            sender_prio = MIN(sender_prio, sender->priority);
+        }
+    }
+
+    if (count == 0) {
+        if (!block) {
+            irq_restore(state);
+            return 0;
+        }
+
+        DEBUG("_msg_receive_batch(): %" PRIkernel_pid ": No msg in queue. "
+              "Going blocked.\n", thread_getpid());
+        me->wait_data = (void *)out;
+        sched_set_status(me, STATUS_RECEIVE_BLOCKED);
+
+        irq_restore(state);
+        thread_yield_higher();
+
+        /* sender copied message */
+        assert(thread_get_active()->status != STATUS_RECEIVE_BLOCKED);
+        return 1;
+    }
+
+    irq_restore(state);
+    if (sender_prio < THREAD_PRIORITY_IDLE) {
+        sched_switch(sender_prio);
+    }
+
+    return count;
+}
+
+unsigned msg_receive_batch(msg_t *out, unsigned max)
+{
+    return _msg_receive_batch(out, max, 1);
+}
+
+unsigned msg_try_receive_batch(msg_t *out, unsigned max)
+{
+    return _msg_receive_batch(out, max, 0);
+}
+
+int msg_send_batch(msg_t *m, unsigned num, kernel_pid_t target_pid)
+{
+    const bool in_irq = irq_is_in();
+    const kernel_pid_t sender_pid = in_irq ? KERNEL_PID_ISR : thread_getpid();
+    unsigned count = 0;
+
+#ifdef DEVELHELP
+    if (!pid_is_valid(target_pid)) {
+        DEBUG("%s: target_pid is invalid, continuing anyways\n", __func__);
+    }
+#endif /* DEVELHELP */
+
+    unsigned state = irq_disable();
+    thread_t *target = thread_get_unchecked(target_pid);
+
+    if (target == NULL) {
+        DEBUG("%s: target thread %d does not exist\n", __func__, target_pid);
+        irq_restore(state);
+        return -1;
+    }
+
+    if ((num > 0) && (target->status == STATUS_RECEIVE_BLOCKED)) {
+        DEBUG("%s: Direct msg copy from %" PRIkernel_pid " to %"
+              PRIkernel_pid ".\n", __func__, sender_pid, target_pid);
+        m[0].sender_pid = sender_pid;
+        *(msg_t *)target->wait_data = m[0];
+        sched_set_status(target, STATUS_PENDING);
+        sched_context_switch_request = 1;
+        count++;
+    }
+
+    if (thread_has_msg_queue(target)) {
+        unsigned queued = 0;
+
+        for (; count < num; count++, queued++) {
+            int n = cib_put(&target->msg_queue);
+
+            if (n < 0) {
+                DEBUG("%s: message queue of thread %" PRIkernel_pid
+                      " is full\n", __func__, target_pid);
+                break;
+            }
+            m[count].sender_pid = sender_pid;
+            target->msg_array[n] = m[count];
+        }
+#if MODULE_CORE_THREAD_FLAGS
+        if (queued) {
+            target->flags |= THREAD_FLAG_MSG_WAITING;
+            thread_flags_wake(target);
+        }
+#else
+        (void)queued;
+#endif
+    }
+
+    irq_restore(state);
+
+    if (sched_context_switch_request && !in_irq) {
+        thread_yield_higher();
+    }
+
+    return count;
+}
+
 static unsigned _msg_avail(thread_t *thread)
 {
     DEBUG("msg_available: %" PRIkernel_pid ": msg_available.\n",
@@ -36,6 +36,80 @@
 
 #if MAXTHREADS > 1
 
+#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
+/**
+ * @brief   Boost the owner of @p mutex to @p priority
+ * @pre     IRQs are disabled
+ *
+ * If the owner is itself blocked on a mutex, the boost is passed on along the
+ * chain of owners.
+ */
+static void _inherit_priority(mutex_t *mutex, uint8_t priority)
+{
+    /* a chain can't be longer than the number of threads */
+    for (unsigned i = 0; i < MAXTHREADS; i++) {
+        thread_t *owner = thread_get(mutex->owner);
+        if (!owner || (owner->priority <= priority)) {
+            return;
+        }
+
+        DEBUG("PID[%" PRIkernel_pid "] prio of %" PRIkernel_pid
+              ": %u --> %u\n",
+              thread_getpid(), owner->pid,
+              (unsigned)owner->priority, (unsigned)priority);
+
+        if (owner->status != STATUS_MUTEX_BLOCKED) {
+            sched_change_priority(owner, priority);
+            return;
+        }
+
+        /* the owner waits for another mutex: keep that wait queue sorted and
+         * boost the owner of that mutex as well */
+        mutex = owner->wait_data;
+        list_remove(&mutex->queue, (list_node_t *)&owner->rq_entry);
+        sched_change_priority(owner, priority);
+        thread_add_to_list(&mutex->queue, owner);
+    }
+}
+
+/**
+ * @brief   Restore the priority of the owner of @p mutex before unlocking it
+ * @pre     IRQs are disabled
+ */
+static void _restore_priority(mutex_t *mutex)
+{
+    thread_t *owner = thread_get(mutex->owner);
+
+    if ((owner) && (owner->priority != mutex->owner_original_priority)) {
+        DEBUG("PID[%" PRIkernel_pid "] prio %u --> %u\n",
+              owner->pid, (unsigned)owner->priority,
+              (unsigned)mutex->owner_original_priority);
+        sched_change_priority(owner, mutex->owner_original_priority);
+    }
+    mutex->owner = KERNEL_PID_UNDEF;
+}
+
+/**
+ * @brief   Hand @p mutex over to the waiting thread @p process
+ * @pre     IRQs are disabled
+ *
+ * Like when obtaining an unlocked mutex, the priority to restore on unlock is
+ * the current one. It includes boosts due to mutexes obtained earlier.
+ */
+static void _pass_ownership(mutex_t *mutex, thread_t *process)
+{
+    mutex->owner = process->pid;
+    mutex->owner_original_priority = process->priority;
+
+    /* the new owner may have to inherit from the remaining waiters */
+    if (mutex->queue.next != MUTEX_LOCKED) {
+        thread_t *waiter = container_of((clist_node_t *)mutex->queue.next,
+                                        thread_t, rq_entry);
+        _inherit_priority(mutex, waiter->priority);
+    }
+}
+#endif
+
 /**
  * @brief   Block waiting for a locked mutex
  * @pre     IRQs are disabled
@@ -65,6 +139,9 @@ void _block(mutex_t *mutex,
     /* Fail visibly even if a blocking action is called from somewhere where
      * it's subtly not allowed, eg. board_init */
     assert(me != NULL);
+#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
+    me->wait_data = mutex;
+#endif
     DEBUG("PID[%" PRIkernel_pid "] mutex_lock() Adding node to mutex queue: "
           "prio: %" PRIu32 "\n", thread_getpid(), (uint32_t)me->priority);
     sched_set_status(me, STATUS_MUTEX_BLOCKED);
@@ -76,15 +153,8 @@ void _block(mutex_t *mutex,
         thread_add_to_list(&mutex->queue, me);
     }
 
-#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
-    thread_t *owner = thread_get(mutex->owner);
-    if ((owner) && (owner->priority > me->priority)) {
-        DEBUG("PID[%" PRIkernel_pid "] prio of %" PRIkernel_pid
-              ": %u --> %u\n",
-              thread_getpid(), mutex->owner,
-              (unsigned)owner->priority, (unsigned)me->priority);
-        sched_change_priority(owner, me->priority);
-    }
+#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
+    _inherit_priority(mutex, me->priority);
 #endif
 
     irq_restore(irq_state);
@@ -200,6 +270,10 @@ void mutex_unlock(mutex_t *mutex)
     if (mutex->queue.next == MUTEX_LOCKED) {
         mutex->queue.next = NULL;
         /* the mutex was locked and no thread was waiting for it */
+#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
+        /* waiters that boosted the owner may have been canceled */
+        _restore_priority(mutex);
+#endif
         irq_restore(irqstate);
         return;
     }
@@ -217,13 +291,8 @@ void mutex_unlock(mutex_t *mutex)
     }
 
 #if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
-    thread_t *owner = thread_get(mutex->owner);
-    if ((owner) && (owner->priority != mutex->owner_original_priority)) {
-        DEBUG("PID[%" PRIkernel_pid "] prio %u --> %u\n",
-              owner->pid, (unsigned)owner->priority,
-              (unsigned)mutex->owner_original_priority);
-        sched_change_priority(owner, mutex->owner_original_priority);
-    }
+    _restore_priority(mutex);
+    _pass_ownership(mutex, process);
 #endif
 #if IS_USED(MODULE_CORE_MUTEX_DEBUG)
     mutex->owner_calling_pc = 0;
@@ -240,6 +309,9 @@ void mutex_unlock_and_sleep(mutex_t *mutex)
     unsigned irqstate = irq_disable();
 
     if (mutex->queue.next) {
+#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
+        _restore_priority(mutex);
+#endif
         if (mutex->queue.next == MUTEX_LOCKED) {
             mutex->queue.next = NULL;
         }
@@ -253,6 +325,9 @@ void mutex_unlock_and_sleep(mutex_t *mutex)
             if (!mutex->queue.next) {
                 mutex->queue.next = MUTEX_LOCKED;
             }
+#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
+            _pass_ownership(mutex, process);
+#endif
         }
     }
 
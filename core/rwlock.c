@@ -0,0 +1,201 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     core_sync_rwlock
+ * @{
+ *
+ * @file
+ * @brief       Reader-writer lock implementation
+ *
+ * The lock is handed over to the woken threads by the releasing thread, so a
+ * woken thread owns the lock as soon as it is scheduled. This implies that
+ * the lock can only be unheld while no thread is waiting for it.
+ *
+ * @}
+ */
+
+#include <assert.h>
+
+#include "irq.h"
+#include "rwlock.h"
+#include "sched.h"
+#include "thread.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/* priority of the first thread in a wait list, or a value lower than any
+ * thread priority if the list is empty */
+static uint16_t _head_prio(const list_node_t *list)
+{
+    if (!list->next) {
+        return THREAD_PRIORITY_MIN + 1;
+    }
+
+    return container_of((clist_node_t *)list->next, thread_t,
+                        rq_entry)->priority;
+}
+
+static bool _read_may_enter(const rwlock_t *lock, uint16_t prio)
+{
+    return (lock->holders != RWLOCK_WRITE_LOCKED)
+           && (prio < _head_prio(&lock->writers));
+}
+
+static void _block(list_node_t *list, unsigned irq_state)
+{
+    thread_t *me = thread_get_active();
+
+    DEBUG("rwlock: %" PRIkernel_pid " blocks\n", me->pid);
+    sched_set_status(me, STATUS_RWLOCK_BLOCKED);
+    thread_add_to_list(list, me);
+    irq_restore(irq_state);
+    thread_yield_higher();
+    /* we were handed over the lock by the releasing thread */
+}
+
+static uint16_t _wake(list_node_t *list)
+{
+    thread_t *thread = container_of((clist_node_t *)list_remove_head(list),
+                                    thread_t, rq_entry);
+
+    DEBUG("rwlock: waking %" PRIkernel_pid "\n", thread->pid);
+    sched_set_status(thread, STATUS_PENDING);
+    return thread->priority;
+}
+
+/* hands the unheld lock over to the waiting writer or readers of highest
+ * priority, restores irq_state */
+static void _release(rwlock_t *lock, unsigned irq_state)
+{
+    uint16_t writer_prio = _head_prio(&lock->writers);
+    uint16_t reader_prio = _head_prio(&lock->readers);
+    uint16_t switch_prio = THREAD_PRIORITY_MIN + 1;
+
+    assert(lock->holders == 0);
+
+    if (lock->writers.next && (writer_prio <= reader_prio)) {
+        lock->holders = RWLOCK_WRITE_LOCKED;
+        switch_prio = _wake(&lock->writers);
+    }
+    else {
+        while (lock->readers.next && (reader_prio < writer_prio)) {
+            uint16_t prio = _wake(&lock->readers);
+            if (prio < switch_prio) {
+                switch_prio = prio;
+            }
+            lock->holders++;
+            reader_prio = _head_prio(&lock->readers);
+        }
+    }
+
+    irq_restore(irq_state);
+
+    if (switch_prio <= THREAD_PRIORITY_MIN) {
+        sched_switch(switch_prio);
+    }
+}
+
+void rwlock_read_lock(rwlock_t *lock)
+{
+    assert(!irq_is_in());
+
+    unsigned irq_state = irq_disable();
+
+    if (_read_may_enter(lock, thread_get_active()->priority)) {
+        lock->holders++;
+        irq_restore(irq_state);
+    }
+    else {
+        _block(&lock->readers, irq_state);
+    }
+}
+
+void rwlock_read_lock_recursive(rwlock_t *lock)
+{
+    assert(!irq_is_in());
+
+    unsigned irq_state = irq_disable();
+
+    /* if the lock is unheld, no writer can be waiting */
+    if (lock->holders != RWLOCK_WRITE_LOCKED) {
+        lock->holders++;
+        irq_restore(irq_state);
+    }
+    else {
+        _block(&lock->readers, irq_state);
+    }
+}
+
+bool rwlock_read_trylock(rwlock_t *lock)
+{
+    thread_t *me = thread_get_active();
+    uint16_t prio = (me && !irq_is_in()) ? me->priority : 0;
+    unsigned irq_state = irq_disable();
+    bool entered = _read_may_enter(lock, prio);
+
+    if (entered) {
+        lock->holders++;
+    }
+    irq_restore(irq_state);
+
+    return entered;
+}
+
+void rwlock_read_unlock(rwlock_t *lock)
+{
+    unsigned irq_state = irq_disable();
+
+    assert(rwlock_is_read_locked(lock));
+
+    if (--lock->holders == 0) {
+        _release(lock, irq_state);
+    }
+    else {
+        irq_restore(irq_state);
+    }
+}
+
+void rwlock_write_lock(rwlock_t *lock)
+{
+    assert(!irq_is_in());
+
+    unsigned irq_state = irq_disable();
+
+    if (lock->holders == 0) {
+        lock->holders = RWLOCK_WRITE_LOCKED;
+        irq_restore(irq_state);
+    }
+    else {
+        _block(&lock->writers, irq_state);
+    }
+}
+
+bool rwlock_write_trylock(rwlock_t *lock)
+{
+    unsigned irq_state = irq_disable();
+    bool entered = (lock->holders == 0);
+
+    if (entered) {
+        lock->holders = RWLOCK_WRITE_LOCKED;
+    }
+    irq_restore(irq_state);
+
+    return entered;
+}
+
+void rwlock_write_unlock(rwlock_t *lock)
+{
+    unsigned irq_state = irq_disable();
+
+    assert(lock->holders == RWLOCK_WRITE_LOCKED);
+
+    lock->holders = 0;
+    _release(lock, irq_state);
+}
@@ -388,6 +388,7 @@ static const char *state_names[STATUS_NUMOF] = {
     [STATUS_FLAG_BLOCKED_ALL] = "bl allfl",
     [STATUS_MBOX_BLOCKED] = "bl mbox",
     [STATUS_COND_BLOCKED] = "bl cond",
+    [STATUS_RWLOCK_BLOCKED] = "bl rwlock",
     [STATUS_RUNNING] = "running",
     [STATUS_PENDING] = "pending",
 };
@@ -47,6 +47,8 @@ typedef struct netdev_tap {
     uint8_t addr[ETHERNET_ADDR_LEN];    /**< The MAC address of the TAP */
     bool promiscuous;                   /**< Flag for promiscuous mode */
     bool wired;                         /**< Flag for wired mode */
+    bool rx_pending;                    /**< Upper layer was told that it can
+                                             fetch another frame */
 } netdev_tap_t;
 
 /**
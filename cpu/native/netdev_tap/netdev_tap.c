@@ -65,6 +65,8 @@ static int _init(netdev_t *netdev);
 static int _send(netdev_t *netdev, const iolist_t *iolist);
 static int _recv(netdev_t *netdev, void *buf, size_t n, void *info);
 
+static bool _get_rx_pending(netdev_tap_t *dev);
+
 static inline void _get_mac_addr(netdev_t *netdev, uint8_t *dst)
 {
     netdev_tap_t *dev = container_of(netdev, netdev_tap_t, netdev);
@@ -136,6 +138,13 @@ static int _get(netdev_t *dev, netopt_t opt, void *value, size_t max_len)
                 res = sizeof(bool);
             }
             break;
+        case NETOPT_RX_PENDING:
+            assert(max_len >= sizeof(netopt_enable_t));
+            *((netopt_enable_t *)value) =
+                _get_rx_pending(container_of(dev, netdev_tap_t, netdev))
+                    ? NETOPT_ENABLE : NETOPT_DISABLE;
+            res = sizeof(netopt_enable_t);
+            break;
         default:
             res = netdev_eth_get(dev, opt, value, max_len);
             break;
@@ -201,18 +210,40 @@ static inline bool _is_addr_multicast(uint8_t *addr)
     return (addr[0] & 0x01);
 }
 
-static void _continue_reading(netdev_tap_t *dev)
+static bool _rx_pending(netdev_tap_t *dev)
 {
-    /* work around lost signals */
     fd_set rfds;
     struct timeval t;
+    bool res;
+
     memset(&t, 0, sizeof(t));
     FD_ZERO(&rfds);
     FD_SET(dev->tap_fd, &rfds);
 
+    _native_pending_syscalls_up(); /* no switching here */
+    res = (real_select(dev->tap_fd + 1, &rfds, NULL, NULL, &t) == 1);
+    _native_pending_syscalls_down();
+
+    return res;
+}
+
+static bool _get_rx_pending(netdev_tap_t *dev)
+{
+    /* if a frame is pending the upper layer fetches it and asks again, so
+     * there is no need to signal it. Otherwise wait for the next one. */
+    dev->rx_pending = _rx_pending(dev);
+    if (!dev->rx_pending) {
+        native_async_read_continue(dev->tap_fd);
+    }
+    return dev->rx_pending;
+}
+
+static void _continue_reading(netdev_tap_t *dev)
+{
+    /* work around lost signals */
     _native_pending_syscalls_up(); /* no switching here */
 
-    if (real_select(dev->tap_fd + 1, &rfds, NULL, NULL, &t) == 1) {
+    if (_rx_pending(dev)) {
         int sig = SIGIO;
         extern int _signal_pipe_fd[2];
         extern ssize_t (*real_write)(int fd, const void * buf, size_t count);
@@ -250,6 +281,7 @@ static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
 
             real_read(dev->tap_fd, nullbuf, sizeof(nullbuf));
 
+            dev->rx_pending = false;
             _continue_reading(dev);
         }
 
@@ -276,7 +308,13 @@ static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
             return 0;
         }
 
-        _continue_reading(dev);
+        if (dev->rx_pending) {
+            /* upper layer asks for the next frame itself */
+            dev->rx_pending = false;
+        }
+        else {
+            _continue_reading(dev);
+        }
 
         return nread;
     }
@@ -352,6 +390,7 @@ static int _init(netdev_t *netdev)
 # endif
     /* initialize device descriptor */
     dev->promiscuous = 0;
+    dev->rx_pending = false;
     /* implicitly create the tap interface */
     if ((dev->tap_fd = real_open(clonedev, O_RDWR | O_NONBLOCK)) == -1) {
         err(EXIT_FAILURE, "open(%s)", clonedev);
@@ -23,6 +23,7 @@
 #include <stdbool.h>
 #include <string.h>
 
+#include "container.h"
 #include "ethos.h"
 #include "periph/uart.h"
 #include "tsrb.h"
@@ -361,30 +362,42 @@ static int _recv(netdev_t *netdev, void *buf, size_t len, void* info)
     int res = 0;
 
     if (buf) {
-        int byte;
         bool escaped = false;
+        bool overflow = false;
+        bool complete = false;
         uint8_t *ptr = buf;
         uint8_t frametype = ETHOS_FRAME_TYPE_DATA;
-
-        do {
-            int tmp;
-
-            if ((byte = tsrb_get_one(&dev->inbuf)) < 0) {
-                DEBUG("ethos _recv(): inbuf doesn't contain enough bytes.\n");
-                return -EIO;
-            }
-            if ((unsigned)res >= len) {
-                while (byte != (int)ETHOS_FRAME_DELIMITER && byte >= 0) {
+        tsrb_region_t regions[2];
+        size_t consumed = 0;
+
+        /* unstuff directly from the ringbuffer's memory */
+        tsrb_peek_regions(&dev->inbuf, regions);
+        for (unsigned r = 0; (r < ARRAY_SIZE(regions)) && !complete; r++) {
+            for (size_t i = 0; (i < regions[r].len) && !complete; i++) {
+                uint8_t byte = regions[r].data[i];
+
+                consumed++;
+                complete = (byte == ETHOS_FRAME_DELIMITER);
+                if (overflow || ((unsigned)res >= len)) {
                     /* clear out unreceived packet */
-                    byte = tsrb_get_one(&dev->inbuf);
+                    overflow = true;
+                    continue;
                 }
-                return -ENOBUFS;
+
+                int tmp = ethos_unstuff_readbyte(ptr, byte, &escaped, &frametype);
+                ptr += tmp;
+                res += tmp;
             }
+        }
+        tsrb_drop(&dev->inbuf, consumed);
 
-            tmp = ethos_unstuff_readbyte(ptr, (uint8_t)byte, &escaped, &frametype);
-            ptr += tmp;
-            res += tmp;
-        } while (byte != ETHOS_FRAME_DELIMITER);
+        if (overflow) {
+            return -ENOBUFS;
+        }
+        if (!complete) {
+            DEBUG("ethos _recv(): inbuf doesn't contain enough bytes.\n");
+            return -EIO;
+        }
 
         switch (frametype) {
         case ETHOS_FRAME_TYPE_HELLO:
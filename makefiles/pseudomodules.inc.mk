@@ -125,6 +125,7 @@ PSEUDOMODULES += gnrc_ipv6_nib_rtr_adv_pio_cb
 PSEUDOMODULES += gnrc_lorawan_1_1
 PSEUDOMODULES += gnrc_neterr
 PSEUDOMODULES += gnrc_netapi_callbacks
+PSEUDOMODULES += gnrc_netapi_direct
 PSEUDOMODULES += gnrc_netapi_mbox
 PSEUDOMODULES += gnrc_netif_bus
 PSEUDOMODULES += gnrc_netif_timestamp
@@ -341,6 +342,7 @@ PSEUDOMODULES += openthread
 PSEUDOMODULES += picolibc
 PSEUDOMODULES += picolibc_stdout_buffered
 PSEUDOMODULES += pktqueue
+PSEUDOMODULES += pm_layered_predictive
 PSEUDOMODULES += posix_headers
 PSEUDOMODULES += printf_float
 PSEUDOMODULES += printf_long_long
@@ -377,6 +379,14 @@ PSEUDOMODULES += saul_pwm
 PSEUDOMODULES += scanf_float
 PSEUDOMODULES += sched_cb
 PSEUDOMODULES += sched_runq_callback
+PSEUDOMODULES += sched_wakeup_callback
+## @defgroup pseudomodule_schedstatistics_histogram schedstatistics_histogram
+## @brief Track wake-up latency and runtime slice histograms per thread
+##
+## Extends @ref schedstatistics with a per-thread histogram of the time between
+## a thread becoming runnable and actually running, and a histogram of the
+## durations it ran uninterrupted. The histograms are printed by `ps`.
+PSEUDOMODULES += schedstatistics_histogram
 ## @defgroup pseudomodule_sema_deprecated sema_deprecated
 ## @ingroup sys_sema
 ## @{
@@ -476,6 +486,7 @@ PSEUDOMODULES += sock_dtls_verify_public_key
 PSEUDOMODULES += sock_ip
 PSEUDOMODULES += sock_tcp
 PSEUDOMODULES += sock_udp
+PSEUDOMODULES += sock_udp_batch
 PSEUDOMODULES += socket_zep_hello
 PSEUDOMODULES += soft_uart_modecfg
 PSEUDOMODULES += stdin
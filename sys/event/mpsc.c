@@ -0,0 +1,131 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_event_mpsc
+ * @{
+ *
+ * @file
+ * @brief       Lock-free MPSC event queue implementation
+ *
+ * Producers push onto queue->pending, a Treiber stack. As there is only one
+ * consumer, which always takes the whole stack using an atomic exchange, no
+ * ABA problem can occur.
+ *
+ * An event's list_node.next is NULL iff the event is not queued. To keep it
+ * non-NULL for the last element of a list, lists are terminated by the
+ * address of the queue instead.
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <stdatomic.h>
+
+#include "event/mpsc.h"
+#include "thread_flags.h"
+
+/* the list pointers are plain pointers in the (C++ compatible) public
+ * structures, but only ever accessed atomically */
+#define _ATOMIC(ptr)    ((_Atomic(clist_node_t *) *)(ptr))
+
+static inline clist_node_t *_end(event_mpsc_queue_t *queue)
+{
+    return (clist_node_t *)queue;
+}
+
+void event_mpsc_post(event_mpsc_queue_t *queue, event_t *event)
+{
+    assert(queue && event);
+    assert(event->handler);
+
+    clist_node_t *node = &event->list_node;
+    clist_node_t *end = _end(queue);
+    clist_node_t *expected = NULL;
+
+    /* claim the event, this fails if it is already queued */
+    if (atomic_compare_exchange_strong_explicit(_ATOMIC(&node->next),
+                                                &expected, end,
+                                                memory_order_acquire,
+                                                memory_order_relaxed)) {
+        clist_node_t *head = atomic_load_explicit(_ATOMIC(&queue->pending),
+                                                  memory_order_relaxed);
+        do {
+            atomic_store_explicit(_ATOMIC(&node->next), head ? head : end,
+                                  memory_order_relaxed);
+        } while (!atomic_compare_exchange_weak_explicit(_ATOMIC(&queue->pending),
+                                                        &head, node,
+                                                        memory_order_release,
+                                                        memory_order_relaxed));
+    }
+
+    thread_t *waiter = queue->waiter;
+    if (waiter) {
+        thread_flags_set(waiter, THREAD_FLAG_EVENT);
+    }
+}
+
+bool event_mpsc_is_queued(const event_t *event)
+{
+    assert(event);
+
+    return atomic_load_explicit(_ATOMIC((clist_node_t **)&event->list_node.next),
+                                memory_order_relaxed) != NULL;
+}
+
+event_t *event_mpsc_get(event_mpsc_queue_t *queue)
+{
+    assert(queue);
+
+    clist_node_t *end = _end(queue);
+
+    if (!queue->local) {
+        clist_node_t *node = atomic_exchange_explicit(_ATOMIC(&queue->pending),
+                                                      NULL,
+                                                      memory_order_acquire);
+        clist_node_t *fifo = NULL;
+
+        /* reverse the stack to restore posting order */
+        while (node) {
+            clist_node_t *next = atomic_load_explicit(_ATOMIC(&node->next),
+                                                      memory_order_relaxed);
+            atomic_store_explicit(_ATOMIC(&node->next), fifo ? fifo : end,
+                                  memory_order_relaxed);
+            fifo = node;
+            node = (next == end) ? NULL : next;
+        }
+        queue->local = fifo;
+    }
+
+    clist_node_t *node = queue->local;
+    if (!node) {
+        return NULL;
+    }
+
+    clist_node_t *next = atomic_load_explicit(_ATOMIC(&node->next),
+                                              memory_order_relaxed);
+    queue->local = (next == end) ? NULL : next;
+
+    /* from now on, the event may be posted again */
+    atomic_store_explicit(_ATOMIC(&node->next), NULL, memory_order_release);
+
+    return container_of(node, event_t, list_node);
+}
+
+event_t *event_mpsc_wait(event_mpsc_queue_t *queue)
+{
+    assert(queue && queue->waiter);
+
+    event_t *event;
+
+    while ((event = event_mpsc_get(queue)) == NULL) {
+        thread_flags_wait_any(THREAD_FLAG_EVENT);
+    }
+
+    return event;
+}
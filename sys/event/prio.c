@@ -0,0 +1,150 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_event_prio
+ * @{
+ *
+ * @file
+ * @brief       Priority and deadline event queue implementation
+ *
+ * The event's list_node is not needed for the priority queue, its next
+ * pointer is used to mark the event as queued instead.
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <stdint.h>
+
+#include "event/prio.h"
+#include "irq.h"
+#include "thread_flags.h"
+
+/* like priority_queue_add(), but deadlines are compared by their signed
+ * difference, so the order survives a wrap around of the clock */
+static void _deadline_add(priority_queue_t *root, priority_queue_node_t *new_obj)
+{
+    /* The strict aliasing rules allow this assignment. */
+    priority_queue_node_t *node = (priority_queue_node_t *)root;
+
+    while (node->next != NULL) {
+        if ((int32_t)(node->next->priority - new_obj->priority) > 0) {
+            break;
+        }
+        node = node->next;
+    }
+
+    new_obj->next = node->next;
+    node->next = new_obj;
+}
+
+void event_prio_post(event_prio_queue_t *queue, event_prio_t *event,
+                     uint32_t urgency)
+{
+    assert(queue && event);
+    assert(event->super.handler);
+
+    if (queue->clock) {
+        assert(urgency <= INT32_MAX);
+        urgency += ztimer_now(queue->clock);
+    }
+
+    unsigned state = irq_disable();
+    if (!event->super.list_node.next) {
+        event->super.list_node.next = (clist_node_t *)queue;
+        event->node.priority = urgency;
+        if (queue->clock) {
+            _deadline_add(&queue->queue, &event->node);
+        }
+        else {
+            priority_queue_add(&queue->queue, &event->node);
+        }
+    }
+    thread_t *waiter = queue->waiter;
+    irq_restore(state);
+
+    if (waiter) {
+        thread_flags_set(waiter, THREAD_FLAG_EVENT);
+    }
+}
+
+void event_prio_cancel(event_prio_queue_t *queue, event_prio_t *event)
+{
+    assert(queue && event);
+
+    unsigned state = irq_disable();
+    if (event->super.list_node.next) {
+        priority_queue_remove(&queue->queue, &event->node);
+        event->super.list_node.next = NULL;
+    }
+    irq_restore(state);
+}
+
+event_prio_t *event_prio_get(event_prio_queue_t *queue)
+{
+    assert(queue);
+
+    unsigned state = irq_disable();
+    priority_queue_node_t *node = priority_queue_remove_head(&queue->queue);
+    irq_restore(state);
+
+    if (!node) {
+        return NULL;
+    }
+
+    event_prio_t *event = container_of(node, event_prio_t, node);
+    event->super.list_node.next = NULL;
+    return event;
+}
+
+event_prio_t *event_prio_wait(event_prio_queue_t *queue)
+{
+    assert(queue && queue->waiter);
+
+    event_prio_t *event;
+
+    while ((event = event_prio_get(queue)) == NULL) {
+        thread_flags_wait_any(THREAD_FLAG_EVENT);
+    }
+
+    return event;
+}
+
+#if IS_USED(MODULE_EVENT_TIMEOUT_ZTIMER)
+static void _timeout_callback(void *arg)
+{
+    event_prio_timeout_t *event_timeout = arg;
+
+    event_prio_post(event_timeout->queue, event_timeout->event,
+                    event_timeout->urgency);
+}
+
+void event_prio_timeout_init(event_prio_timeout_t *event_timeout,
+                             ztimer_clock_t *clock, event_prio_queue_t *queue,
+                             event_prio_t *event, uint32_t urgency)
+{
+    event_timeout->clock = clock;
+    event_timeout->timer.callback = _timeout_callback;
+    event_timeout->timer.arg = event_timeout;
+    event_timeout->queue = queue;
+    event_timeout->event = event;
+    event_timeout->urgency = urgency;
+}
+
+void event_prio_timeout_set(event_prio_timeout_t *event_timeout,
+                            uint32_t timeout)
+{
+    if (timeout == 0) {
+        _timeout_callback(event_timeout);
+    }
+    else {
+        ztimer_set(event_timeout->clock, &event_timeout->timer, timeout);
+    }
+}
+#endif
@@ -0,0 +1,182 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#pragma once
+
+/**
+ * @defgroup    sys_event_mpsc Lock-free MPSC event queue
+ * @ingroup     sys_event
+ * @brief       Event queue with lock-free posting from any context
+ *
+ * This is a variant of the @ref sys_event queue for queues that are fed at a
+ * high rate, e.g. by several peripheral ISRs. event_mpsc_post() does not
+ * disable interrupts and runs in constant time: producers push the event onto
+ * a lock-free stack using C11 atomics. The (single) consumer thread takes the
+ * whole stack at once and restores the FIFO order in a private list.
+ *
+ * Checking whether an event is queued is a constant time operation, too.
+ *
+ * The regular @ref event_t type is used, so all event types (e.g.
+ * @ref event_callback_t) can be posted to an MPSC queue as well. As with
+ * regular queues, an event can only be queued in one queue at a time.
+ *
+ * @warning Queued events cannot be canceled, and only the thread owning the
+ *          queue may get events from it.
+ *
+ * Example:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * static event_mpsc_queue_t queue;
+ *
+ * void isr_cb(void *arg)
+ * {
+ *     event_mpsc_post(&queue, &event);
+ * }
+ *
+ * [...]
+ * event_mpsc_queue_init(&queue);
+ * event_mpsc_loop(&queue);
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @{
+ *
+ * @file
+ * @brief       Lock-free MPSC event queue API
+ */
+
+#include <stdbool.h>
+
+#include "event.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   MPSC event queue structure
+ *
+ * @note    Only access via the functions below, @p pending is modified
+ *          atomically.
+ */
+typedef struct {
+    clist_node_t *pending;      /**< stack of newly posted events       */
+    clist_node_t *local;        /**< FIFO of events taken by consumer   */
+    thread_t *waiter;           /**< thread owning event queue          */
+} event_mpsc_queue_t;
+
+/**
+ * @brief   event_mpsc_queue_t static initializer
+ */
+#define EVENT_MPSC_QUEUE_INIT           { .waiter = thread_get_active() }
+
+/**
+ * @brief   static initializer for detached MPSC event queues
+ */
+#define EVENT_MPSC_QUEUE_INIT_DETACHED  { .waiter = NULL }
+
+/**
+ * @brief   Initialize an MPSC event queue
+ *
+ * This will set the calling thread as owner of @p queue.
+ *
+ * @param[out]  queue   event queue object to initialize
+ */
+static inline void event_mpsc_queue_init(event_mpsc_queue_t *queue)
+{
+    assert(queue);
+    *queue = (event_mpsc_queue_t){ .waiter = thread_get_active() };
+}
+
+/**
+ * @brief   Initialize an MPSC event queue not binding it to a thread
+ *
+ * @param[out]  queue   event queue object to initialize
+ */
+static inline void event_mpsc_queue_init_detached(event_mpsc_queue_t *queue)
+{
+    assert(queue);
+    *queue = (event_mpsc_queue_t){ .waiter = NULL };
+}
+
+/**
+ * @brief   Bind an MPSC event queue to the calling thread
+ *
+ * @pre     (queue->waiter == NULL)
+ *
+ * @param[out]  queue   event queue object to bind to a thread
+ */
+static inline void event_mpsc_queue_claim(event_mpsc_queue_t *queue)
+{
+    assert(queue && (queue->waiter == NULL));
+    queue->waiter = thread_get_active();
+}
+
+/**
+ * @brief   Queue an event, lock-free
+ *
+ * Same semantics as @ref event_post(): reposting an event that is already
+ * queued has no effect. Can be called from any thread or ISR.
+ *
+ * @param[in]   queue   event queue to queue event in
+ * @param[in]   event   event to queue in event queue
+ */
+void event_mpsc_post(event_mpsc_queue_t *queue, event_t *event);
+
+/**
+ * @brief   Check if an event is queued, in O(1)
+ *
+ * @param[in]   event   event to check
+ *
+ * @returns true if @p event is queued (in any queue)
+ * @returns false otherwise
+ */
+bool event_mpsc_is_queued(const event_t *event);
+
+/**
+ * @brief   Get next event from an MPSC event queue, non-blocking
+ *
+ * @pre     Must only be called by the thread owning @p queue
+ *
+ * @param[in]   queue   event queue to get event from
+ *
+ * @returns     pointer to next event
+ * @returns     NULL if no event available
+ */
+event_t *event_mpsc_get(event_mpsc_queue_t *queue);
+
+/**
+ * @brief   Get next event from an MPSC event queue, blocking
+ *
+ * @pre     Must only be called by the thread owning @p queue
+ *
+ * @param[in]   queue   event queue to get event from
+ *
+ * @returns     pointer to next event
+ */
+event_t *event_mpsc_wait(event_mpsc_queue_t *queue);
+
+/**
+ * @brief   Simple event loop for an MPSC event queue
+ *
+ * @pre     Must only be called by the thread owning @p queue
+ *
+ * @param[in]   queue   event queue to process
+ */
+static inline void event_mpsc_loop(event_mpsc_queue_t *queue)
+{
+    event_t *event;
+
+    while ((event = event_mpsc_wait(queue))) {
+        event->handler(event);
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
+/** @} */
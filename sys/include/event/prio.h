@@ -0,0 +1,258 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#pragma once
+
+/**
+ * @defgroup    sys_event_prio Priority and deadline ordered event queues
+ * @ingroup     sys_event
+ * @brief       Event queues dispatching the most urgent event first
+ *
+ * A regular @ref event_queue_t is strictly FIFO, so an urgent event has to
+ * wait for all events posted before it. The queues provided here are ordered
+ * by urgency instead, using @ref priority_queue_t:
+ *
+ * - Priority queues (event_prio_queue_init()): every event is posted with a
+ *   priority, lower values are dispatched first.
+ * - Deadline queues (event_deadline_queue_init()): every event is posted with a
+ *   relative deadline in ticks of the queue's ztimer clock. Events are
+ *   dispatched earliest deadline first.
+ *
+ * Events of equal urgency are dispatched in FIFO order. The dispatching is
+ * not preemptive: an urgent event may still have to wait for the handler that
+ * is currently running.
+ *
+ * Deadlines are compared by their difference, as ztimer does, so a deadline
+ * queue keeps its order across a wrap around of its clock.
+ *
+ * @warning Relative deadlines must be smaller than 2^31 ticks, and an event
+ *          must not stay queued for more than 2^31 ticks past its deadline.
+ *
+ * Example:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * static event_prio_queue_t queue;
+ * static event_prio_t ack_timeout = { .super.handler = _ack_timeout };
+ * static event_prio_t parse = { .super.handler = _parse };
+ *
+ * [...]
+ * event_prio_queue_init(&queue);
+ * event_prio_post(&queue, &parse, 10);
+ * event_prio_post(&queue, &ack_timeout, 0);
+ * // _ack_timeout() is run before _parse()
+ * event_prio_loop(&queue);
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @{
+ *
+ * @file
+ * @brief       Priority and deadline event queue API
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "event.h"
+#include "priority_queue.h"
+#include "ztimer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Event that can be posted to a priority or deadline queue
+ */
+typedef struct {
+    event_t super;                  /**< event_t structure that gets extended */
+    priority_queue_node_t node;     /**< queue entry, priority holds the
+                                         priority or absolute deadline */
+} event_prio_t;
+
+/**
+ * @brief   Priority or deadline ordered event queue
+ */
+typedef struct {
+    priority_queue_t queue;         /**< queued events, most urgent first */
+    thread_t *waiter;               /**< thread owning event queue        */
+    ztimer_clock_t *clock;          /**< clock for deadlines, NULL for
+                                         priority ordering                */
+} event_prio_queue_t;
+
+/**
+ * @brief   Initialize a priority ordered event queue
+ *
+ * This will set the calling thread as owner of @p queue.
+ *
+ * @param[out]  queue   event queue object to initialize
+ */
+static inline void event_prio_queue_init(event_prio_queue_t *queue)
+{
+    assert(queue);
+    *queue = (event_prio_queue_t){ .waiter = thread_get_active() };
+}
+
+/**
+ * @brief   Initialize a deadline ordered event queue
+ *
+ * This will set the calling thread as owner of @p queue.
+ *
+ * @param[out]  queue   event queue object to initialize
+ * @param[in]   clock   clock the deadlines are given in
+ */
+static inline void event_deadline_queue_init(event_prio_queue_t *queue,
+                                             ztimer_clock_t *clock)
+{
+    assert(queue && clock);
+    *queue = (event_prio_queue_t){
+        .waiter = thread_get_active(),
+        .clock = clock,
+    };
+}
+
+/**
+ * @brief   Bind an event queue to the calling thread
+ *
+ * @pre     (queue->waiter == NULL)
+ *
+ * @param[out]  queue   event queue object to bind to a thread
+ */
+static inline void event_prio_queue_claim(event_prio_queue_t *queue)
+{
+    assert(queue && (queue->waiter == NULL));
+    queue->waiter = thread_get_active();
+}
+
+/**
+ * @brief   Queue an event according to its urgency
+ *
+ * If the event is already queued, it will not be touched and keeps its
+ * position and urgency.
+ *
+ * @param[in]   queue   event queue to queue event in
+ * @param[in]   event   event to queue
+ * @param[in]   urgency priority (lower is more urgent) for priority queues,
+ *                      deadline relative to now in ticks of the queue's
+ *                      clock for deadline queues
+ */
+void event_prio_post(event_prio_queue_t *queue, event_prio_t *event,
+                     uint32_t urgency);
+
+/**
+ * @brief   Cancel a queued event
+ *
+ * @param[in]   queue   event queue to remove event from
+ * @param[in]   event   event to remove from queue
+ */
+void event_prio_cancel(event_prio_queue_t *queue, event_prio_t *event);
+
+/**
+ * @brief   Check if an event is queued
+ *
+ * @param[in]   event   event to check
+ *
+ * @returns true if @p event is queued
+ * @returns false otherwise
+ */
+static inline bool event_prio_is_queued(const event_prio_t *event)
+{
+    return event->super.list_node.next != NULL;
+}
+
+/**
+ * @brief   Get the most urgent event from a queue, non-blocking
+ *
+ * @param[in]   queue   event queue to get event from
+ *
+ * @returns     pointer to next event
+ * @returns     NULL if no event available
+ */
+event_prio_t *event_prio_get(event_prio_queue_t *queue);
+
+/**
+ * @brief   Get the most urgent event from a queue, blocking
+ *
+ * @pre     Must only be called by the thread owning @p queue
+ *
+ * @param[in]   queue   event queue to get event from
+ *
+ * @returns     pointer to next event
+ */
+event_prio_t *event_prio_wait(event_prio_queue_t *queue);
+
+/**
+ * @brief   Simple event loop for a priority or deadline queue
+ *
+ * @pre     Must only be called by the thread owning @p queue
+ *
+ * @param[in]   queue   event queue to process
+ */
+static inline void event_prio_loop(event_prio_queue_t *queue)
+{
+    event_prio_t *event;
+
+    while ((event = event_prio_wait(queue))) {
+        event->super.handler(&event->super);
+    }
+}
+
+#if IS_USED(MODULE_EVENT_TIMEOUT_ZTIMER) || DOXYGEN
+/**
+ * @brief   Timeout event for priority and deadline queues
+ *
+ * Counterpart of @ref event_timeout_t: when the timeout expires, the event is
+ * posted with the configured urgency.
+ */
+typedef struct {
+    ztimer_clock_t *clock;          /**< ztimer clock to use              */
+    ztimer_t timer;                 /**< ztimer object used for timeout   */
+    event_prio_queue_t *queue;      /**< event queue to post event to     */
+    event_prio_t *event;            /**< event to post after timeout      */
+    uint32_t urgency;               /**< urgency to post event with       */
+} event_prio_timeout_t;
+
+/**
+ * @brief   Initialize timeout event object
+ *
+ * @param[out]  event_timeout   object to initialize
+ * @param[in]   clock           clock the timeout is given in
+ * @param[in]   queue           queue the event will be posted to
+ * @param[in]   event           event to post after timeout
+ * @param[in]   urgency         urgency to post @p event with,
+ *                              see @ref event_prio_post()
+ */
+void event_prio_timeout_init(event_prio_timeout_t *event_timeout,
+                             ztimer_clock_t *clock, event_prio_queue_t *queue,
+                             event_prio_t *event, uint32_t urgency);
+
+/**
+ * @brief   Set a timeout
+ *
+ * @param[in]   event_timeout   timeout object to use
+ * @param[in]   timeout         timeout in ticks of the timeout's clock
+ */
+void event_prio_timeout_set(event_prio_timeout_t *event_timeout,
+                            uint32_t timeout);
+
+/**
+ * @brief   Clear a timeout
+ *
+ * If the timeout already expired, the event stays queued.
+ *
+ * @param[in]   event_timeout   timeout object to use
+ */
+static inline void event_prio_timeout_clear(event_prio_timeout_t *event_timeout)
+{
+    ztimer_remove(event_timeout->clock, &event_timeout->timer);
+}
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+/** @} */
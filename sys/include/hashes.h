@@ -169,6 +169,49 @@ uint32_t rotating_hash(const uint8_t *buf, size_t len);
  */
 uint32_t one_at_a_time_hash(const uint8_t *buf, size_t len);
 
+/**
+ * @defgroup sys_hashes_mix32 32 bit mixer
+ * @ingroup sys_hashes_non_crypto
+ * @brief Mixes all bits of a 32 bit value into the lower bits.
+ *
+ * Finalizer of integer hashes: the result can be reduced with a modulo to
+ * index a hash table, even if the input only differs in its upper bits.
+ *
+ * @param x value to mix
+ * @return 32 bit sized hash
+ */
+static inline uint32_t mix32_hash(uint32_t x)
+{
+    x ^= x >> 16;
+    x *= 0x45d9f3bU;
+    x ^= x >> 16;
+    return x;
+}
+
+/**
+ * @defgroup sys_hashes_mult31 Multiplicative hash (k=31)
+ * @ingroup sys_hashes_non_crypto
+ * @brief Continues a multiplicative hash over a buffer.
+ *
+ *      hash(i) = hash(i - 1) * 31 + buf[i];
+ *
+ * Several buffers can be hashed into one value by passing the result for
+ * the previous buffer as @p hash. Combine with @ref mix32_hash() to index
+ * a hash table.
+ *
+ * @param hash hash to continue, e.g. a key that is not part of @p buf
+ * @param buf input buffer to hash
+ * @param len length of buffer
+ * @return 32 bit sized hash
+ */
+static inline uint32_t mult31_hash(uint32_t hash, const uint8_t *buf, size_t len)
+{
+    for (size_t i = 0; i < len; i++) {
+        hash = (hash * 31) + buf[i];
+    }
+    return hash;
+}
+
 #ifdef __cplusplus
 }
 #endif
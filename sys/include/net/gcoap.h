@@ -1028,8 +1028,10 @@ ssize_t gcoap_req_send(const uint8_t *buf, size_t len,
  * @brief   Initializes a CoAP response packet on a buffer
  *
  * Initializes payload location within the buffer based on packet setup.
+ * @p buf does not need to be the buffer the request in @p pdu was parsed
+ * from; @p pdu refers to @p buf afterwards.
  *
- * @param[out] pdu      Response metadata
+ * @param[in,out] pdu   Request metadata in, response metadata out
  * @param[in] buf       Buffer containing the PDU
  * @param[in] len       Length of the buffer
  * @param[in] code      Response code
@@ -101,6 +101,7 @@
 #include "thread.h"
 
 #include "net/ipv6.h"
+#include "net/gnrc/ipv6/dst_cache.h"
 #include "net/gnrc/ipv6/ext.h"
 #include "net/gnrc/ipv6/hdr.h"
 #include "net/gnrc/ipv6/nib.h"
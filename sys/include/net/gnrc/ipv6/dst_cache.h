@@ -0,0 +1,52 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#pragma once
+
+/**
+ * @ingroup     net_gnrc_ipv6
+ * @{
+ *
+ * @file
+ * @brief       Configuration of the IPv6 destination cache
+ *
+ * Kept apart from net/gnrc/ipv6.h, so @ref net/netstats.h can include it
+ * without pulling in the whole IPv6 layer.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Number of entries in the destination cache
+ *
+ * The destination cache maps the destinations of recently sent unicast
+ * packets to their next hop, so sending further packets to them skips
+ * the route lookup and address resolution in the
+ * @ref net_gnrc_ipv6_nib "NIB". Entries are invalidated whenever the NIB
+ * changes (see @ref gnrc_ipv6_nib_version()), and only next hops in
+ * neighbor reachability state REACHABLE or UNMANAGED are cached.
+ *
+ * Destinations are mapped to entries by a hash of their address, so
+ * destinations may evict each other even if not all entries are in use.
+ *
+ * With module `netstats_ipv6`, hits and misses are counted in
+ * netstats_t::dst_cache_hits and netstats_t::dst_cache_misses.
+ *
+ * A value of 0 disables the destination cache.
+ */
+#ifndef CONFIG_GNRC_IPV6_DST_CACHE_NUMOF
+#define CONFIG_GNRC_IPV6_DST_CACHE_NUMOF       (0U)
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
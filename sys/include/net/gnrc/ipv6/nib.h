@@ -358,6 +358,22 @@ int gnrc_ipv6_nib_get_next_hop_l2addr(const ipv6_addr_t *dst,
                                       gnrc_netif_t *netif, gnrc_pktsnip_t *pkt,
                                       gnrc_ipv6_nib_nc_t *nce);
 
+/**
+ * @brief   Gets the version of the NIB
+ *
+ * The version changes whenever the NIB may have changed in a way that affects
+ * the result of gnrc_ipv6_nib_get_next_hop_l2addr() for destinations other
+ * than the one looked up, so a next hop resolved for a destination stays
+ * valid as long as the version does not change.
+ *
+ * @note    Lookups by gnrc_ipv6_nib_get_next_hop_l2addr() only change the
+ *          version if they evict a neighbor cache entry to make room for the
+ *          next hop.
+ *
+ * @return  The current version of the NIB.
+ */
+uint32_t gnrc_ipv6_nib_version(void);
+
 /**
  * @brief   Handles a received ICMPv6 packet
  *
@@ -210,6 +210,23 @@ extern "C" {
 #  endif
 #endif
 
+/**
+ * @brief   (de-)activate lookup indexes for NIB entries
+ *
+ * Keeps a hash table over the addresses of on-link entries and a
+ * path-compressed trie over the prefixes of off-link entries, so neighbor
+ * lookups and longest prefix matches for routing do not need to scan all
+ * @ref CONFIG_GNRC_IPV6_NIB_NUMOF and @ref CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF
+ * entries.
+ *
+ * This costs an additional pointer per entry, a pointer per on-link entry for
+ * the hash table and two trie nodes per off-link entry, so it is only worth
+ * it for large tables, e.g. on border routers.
+ */
+#ifndef CONFIG_GNRC_IPV6_NIB_INDEX
+#  define CONFIG_GNRC_IPV6_NIB_INDEX                  0
+#endif
+
 /**
  * @brief   Support for DNS configuration options
  *
@@ -56,6 +56,34 @@
  * USEMODULE += gnrc_netapi_callbacks
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
  * @}
+ *
+ * @defgroup    net_gnrc_netapi_direct   Direct call extension
+ * @ingroup     net_gnrc_netapi
+ * @brief       Run-to-completion receive path for @ref net_gnrc_netapi
+ * @{
+ * @details The submodule `gnrc_netapi_direct` lets layers that run in their
+ *          own thread be called directly by the thread dispatching a
+ *          received packet to them, saving a message and a context switch
+ *          per layer. A layer opts in by registering a
+ *          @ref GNRC_NETREG_TYPE_DIRECT entry. If its thread is not
+ *          waiting for a message, i.e. still has messages pending or is busy
+ *          with one, the packet is sent to it as a message instead. Packets sent down the stack always take
+ *          the message path.
+ *
+ * With this module, @ref net_gnrc_ipv6 and @ref net_gnrc_udp opt in, so a
+ * packet received by a network interface passes both layers in the thread of
+ * the interface (or of @ref net_gnrc_sixlowpan) and is only queued again for
+ * the receiving socket or application. That thread needs the stack of those
+ * layers in addition to its own, so its stack size has to be increased, e.g.
+ * via `GNRC_NETIF_STACKSIZE_DEFAULT`.
+ *
+ * To use, add the module `gnrc_netapi_direct` to the `USEMODULE` macro in
+ * your application's Makefile:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ {.mk}
+ * USEMODULE += gnrc_netapi_direct
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * @}
  */
 
 #include "thread.h"
@@ -213,6 +241,26 @@ static inline int gnrc_netapi_dispatch_receive(gnrc_nettype_t type, uint32_t dem
     return gnrc_netapi_dispatch(type, demux_ctx, GNRC_NETAPI_MSG_TYPE_RCV, pkt);
 }
 
+/**
+ * @brief   Sends a @ref GNRC_NETAPI_MSG_TYPE_RCV command for each packet of
+ *          a batch to all subscribers to (`pkt->type`, @p demux_ctx).
+ *
+ * Does the same as calling @ref gnrc_netapi_dispatch_receive() for every
+ * packet in @p pkts, but the registry is only acquired once per batch and
+ * the subscribers are only looked up once for consecutive packets of the same
+ * type. Every subscriber still receives one message per packet.
+ *
+ * @param[in] demux_ctx demultiplexing context for all packets.
+ * @param[in] pkts      the packets in the order they are dispatched in.
+ *                      Packets without subscribers are released.
+ * @param[in] numof     number of packets in @p pkts.
+ *
+ * @return Number of packets that had at least one subscriber.
+ */
+unsigned gnrc_netapi_dispatch_receive_batch(uint32_t demux_ctx,
+                                            gnrc_pktsnip_t *const *pkts,
+                                            unsigned numof);
+
 /**
  * @brief   Shortcut function for sending @ref GNRC_NETAPI_MSG_TYPE_GET messages and
  *          parsing the returned @ref GNRC_NETAPI_MSG_TYPE_ACK message
@@ -55,6 +55,24 @@ extern "C" {
 #define CONFIG_GNRC_NETIF_MSG_QUEUE_SIZE_EXP  (4U)
 #endif
 
+/**
+ * @brief       Maximum number of frames fetched from the device per receive
+ *              event
+ *
+ * If the device reports further frames via @ref NETOPT_RX_PENDING, up to this
+ * many frames are fetched in one go and passed up with
+ * @ref gnrc_netapi_dispatch_receive_batch(). With 1 (the default) every frame
+ * is fetched on its own receive event.
+ *
+ * @attention   All frames of a batch are held in the packet buffer until the
+ *              batch is passed up, so the batch should fit into
+ *              @ref CONFIG_GNRC_PKTBUF_SIZE with room to spare. The interface
+ *              thread needs one pointer per frame on its stack.
+ */
+#ifndef CONFIG_GNRC_NETIF_RX_BATCH_SIZE
+#define CONFIG_GNRC_NETIF_RX_BATCH_SIZE       (1U)
+#endif
+
 /**
  * @brief       Packet queue pool size for all network interfaces
  *
@@ -30,13 +30,16 @@
 #ifdef MODULE_GNRC_NETAPI_MBOX
 #include "mbox.h"
 #endif
+#ifdef MODULE_GNRC_NETAPI_DIRECT
+#include "mutex.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS) || \
-    defined(DOXYGEN)
+    defined(MODULE_GNRC_NETAPI_DIRECT) || defined(DOXYGEN)
 /**
  *  @brief  The type of the netreg entry.
  *
@@ -47,8 +50,8 @@ typedef enum {
      * @brief   Use [default IPC](@ref core_msg) for
      *          [netapi](@ref net_gnrc_netapi) operations.
      *
-     * @note    Implicitly chosen without `gnrc_netapi_mbox` and
-     *          `gnrc_netapi_callbacks` modules.
+     * @note    Implicitly chosen without `gnrc_netapi_mbox`,
+     *          `gnrc_netapi_callbacks`, and `gnrc_netapi_direct` modules.
      */
     GNRC_NETREG_TYPE_DEFAULT = 0,
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(DOXYGEN)
@@ -69,9 +72,37 @@ typedef enum {
      */
     GNRC_NETREG_TYPE_CB,
 #endif
+#if defined(MODULE_GNRC_NETAPI_DIRECT) || defined(DOXYGEN)
+    /**
+     * @brief   Call received packets directly in the dispatching thread,
+     *          use [default IPC](@ref core_msg) otherwise.
+     *
+     * @note    Only available with `gnrc_netapi_direct` module.
+     */
+    GNRC_NETREG_TYPE_DIRECT,
+#endif
 } gnrc_netreg_type_t;
 #endif
 
+/**
+ * @defgroup net_gnrc_netreg_conf GNRC network protocol registry compile configurations
+ * @ingroup net_gnrc_conf
+ * @{
+ */
+/**
+ * @brief   Number of hash buckets per protocol type
+ *
+ * The entries of a protocol type are spread over this many lists by their
+ * gnrc_netreg_entry_t::demux_ctx, so a lookup only walks the entries sharing
+ * a bucket instead of all entries of the type. This pays off with many
+ * registrations of one type, e.g. dozens of UDP ports, and costs one pointer
+ * per bucket and protocol type.
+ */
+#ifndef CONFIG_GNRC_NETREG_BUCKETS
+#define CONFIG_GNRC_NETREG_BUCKETS  (1U)
+#endif
+/** @} */
+
 /**
  * @brief   Demux context value to get all packets of a certain type.
  *
@@ -93,7 +124,8 @@ typedef enum {
  *
  * @return  An initialized netreg entry
  */
-#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS)
+#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS) || \
+    defined(MODULE_GNRC_NETAPI_DIRECT)
 #define GNRC_NETREG_ENTRY_INIT_PID(demux_ctx, pid)  { NULL, demux_ctx, \
                                                       GNRC_NETREG_TYPE_DEFAULT, \
                                                       { pid } }
@@ -133,14 +165,35 @@ typedef enum {
 #define GNRC_NETREG_ENTRY_INIT_CB(demux_ctx, _cbd)   { NULL, demux_ctx, \
                                                       GNRC_NETREG_TYPE_CB, \
                                                       { .cbd = _cbd } }
+#endif
+
+#if defined(MODULE_GNRC_NETAPI_DIRECT) || defined(DOXYGEN)
+/**
+ * @brief   Initializes a netreg entry statically with a direct call descriptor
+ *
+ * @param[in] demux_ctx The @ref gnrc_netreg_entry_t::demux_ctx "demux context"
+ *                      for the netreg entry
+ * @param[in] _direct   Target direct call descriptor for the registry entry
+ *
+ * @note    Only available with @ref net_gnrc_netapi_direct.
+ *
+ * @return  An initialized netreg entry
+ */
+#define GNRC_NETREG_ENTRY_INIT_DIRECT(demux_ctx, _direct) { NULL, demux_ctx, \
+                                                      GNRC_NETREG_TYPE_DIRECT, \
+                                                      { .direct = _direct } }
+#endif
 /** @} */
 
+#if defined(MODULE_GNRC_NETAPI_CALLBACKS) || \
+    defined(MODULE_GNRC_NETAPI_DIRECT) || defined(DOXYGEN)
 /**
  * @brief   Packet handler callback for netreg entries with callback.
  *
  * @pre `cmd` &isin; { @ref GNRC_NETAPI_MSG_TYPE_RCV, @ref GNRC_NETAPI_MSG_TYPE_SND }
  *
- * @note    Only available with @ref net_gnrc_netapi_callbacks.
+ * @note    Only available with @ref net_gnrc_netapi_callbacks or
+ *          @ref net_gnrc_netapi_direct.
  *
  * @param[in] cmd   @ref net_gnrc_netapi command type. Must be either
  *                  @ref GNRC_NETAPI_MSG_TYPE_SND or
@@ -150,7 +203,9 @@ typedef enum {
  */
 typedef void (*gnrc_netreg_entry_cb_t)(uint16_t cmd, gnrc_pktsnip_t *pkt,
                                        void *ctx);
+#endif
 
+#if defined(MODULE_GNRC_NETAPI_CALLBACKS) || defined(DOXYGEN)
 /**
  * @brief   Callback + Context descriptor
  * @note    Only available with @ref net_gnrc_netapi_callbacks.
@@ -161,6 +216,41 @@ typedef struct {
 } gnrc_netreg_entry_cbd_t;
 #endif
 
+#if defined(MODULE_GNRC_NETAPI_DIRECT) || defined(DOXYGEN)
+/**
+ * @brief   Direct call descriptor of a layer with its own thread
+ *
+ * A @ref GNRC_NETAPI_MSG_TYPE_RCV command is handed to
+ * gnrc_netreg_entry_direct_t::cb in the dispatching thread if
+ * gnrc_netreg_entry_direct_t::pid is blocked waiting for a message and
+ * gnrc_netreg_entry_direct_t::lock is free. Otherwise, and for all other
+ * commands, the packet is sent to gnrc_netreg_entry_direct_t::pid as with
+ * @ref GNRC_NETREG_TYPE_DEFAULT.
+ *
+ * The thread of the layer must take gnrc_netreg_entry_direct_t::lock after
+ * receiving a message and hold it while handling the message, so the
+ * callback never runs concurrently with it.
+ *
+ * @note    Only available with @ref net_gnrc_netapi_direct.
+ */
+typedef struct {
+    gnrc_netreg_entry_cb_t cb;  /**< handler for received packets */
+    void *ctx;                  /**< context for the handler */
+    mutex_t lock;               /**< held while the layer handles a packet */
+    kernel_pid_t pid;           /**< thread of the layer, the IPC fallback */
+} gnrc_netreg_entry_direct_t;
+
+/**
+ * @brief   Static initializer for @ref gnrc_netreg_entry_direct_t
+ *
+ * @param[in] _cb   Handler for received packets
+ * @param[in] _ctx  Context for @p _cb
+ */
+#define GNRC_NETREG_ENTRY_DIRECT_INIT(_cb, _ctx) { .cb = _cb, .ctx = _ctx, \
+                                                   .lock = MUTEX_INIT, \
+                                                   .pid = KERNEL_PID_UNDEF }
+#endif
+
 /**
  * @brief   Entry to the @ref net_gnrc_netreg
  */
@@ -178,15 +268,17 @@ typedef struct gnrc_netreg_entry {
      * @details This can be defined by the network protocol themselves.
      *          E. g. protocol numbers / next header numbers in IPv4/IPv6,
      *          ports in UDP/TCP, or similar.
+     *
+     * @warning Must not be changed while the entry is registered.
      */
     uint32_t demux_ctx;
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS) || \
-    defined(DOXYGEN)
+    defined(MODULE_GNRC_NETAPI_DIRECT) || defined(DOXYGEN)
     /**
      * @brief   Type of the registry entry
      *
-     * @note    Only available with @ref net_gnrc_netapi_mbox or
-     *          @ref net_gnrc_netapi_callbacks.
+     * @note    Only available with @ref net_gnrc_netapi_mbox,
+     *          @ref net_gnrc_netapi_callbacks, or @ref net_gnrc_netapi_direct.
      */
     gnrc_netreg_type_t type;
 #endif
@@ -209,6 +301,15 @@ typedef struct gnrc_netreg_entry {
          */
         gnrc_netreg_entry_cbd_t *cbd;
 #endif
+
+#if defined(MODULE_GNRC_NETAPI_DIRECT) || defined(DOXYGEN)
+        /**
+         * @brief   Target direct call descriptor for the registry entry
+         *
+         * @note    Only available with @ref net_gnrc_netapi_direct.
+         */
+        gnrc_netreg_entry_direct_t *direct;
+#endif
     } target;                   /**< Target for the registry entry */
 } gnrc_netreg_entry_t;
 
@@ -226,11 +327,19 @@ typedef struct gnrc_netreg_entry {
  *
  * There is an exclusive counterpart to the lock, which is
  * internal to netreg (and used through functions such as @ref
- * gnrc_netreg_register and @ref gnrc_netreg_unregister). The current
- * implementation prioritizes shared locks. This means that shared locks are
- * generally acquired fast (they only block if an exclusive operation has
- * already started), but constant access through shared locks might starve
- * registration and deregistration.
+ * gnrc_netreg_register and @ref gnrc_netreg_unregister). Both are implemented
+ * by a @ref core_sync_rwlock, which prefers exclusive operations: once a
+ * registration or deregistration is waiting, shared locks by threads of the
+ * same or lower priority block until it is done. Constant access through
+ * shared locks therefore can't starve registration and deregistration, but
+ * the shared lock must not be acquired recursively. This includes
+ * @ref GNRC_NETREG_TYPE_CB callbacks, which are called with the shared lock
+ * held and thus must not dispatch packets themselves.
+ *
+ * With @ref net_gnrc_netapi_direct, @ref GNRC_NETREG_TYPE_DIRECT handlers
+ * dispatch further up the stack while the shared lock is held, so the shared
+ * lock then is recursive and does not yield to waiting (de)registrations.
+ * They only get the lock once no packet is being dispatched.
  *
  * @{
  */
@@ -275,7 +384,8 @@ static inline void gnrc_netreg_entry_init_pid(gnrc_netreg_entry_t *entry,
 {
     entry->next = NULL;
     entry->demux_ctx = demux_ctx;
-#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS)
+#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS) || \
+    defined(MODULE_GNRC_NETAPI_DIRECT)
     entry->type = GNRC_NETREG_TYPE_DEFAULT;
 #endif
     entry->target.pid = pid;
@@ -324,6 +434,29 @@ static inline void gnrc_netreg_entry_init_cb(gnrc_netreg_entry_t *entry,
     entry->target.cbd = cbd;
 }
 #endif
+
+#if defined(MODULE_GNRC_NETAPI_DIRECT) || defined(DOXYGEN)
+/**
+ * @brief   Initializes a netreg entry dynamically with a direct call
+ *          descriptor
+ *
+ * @param[out] entry    A netreg entry
+ * @param[in] demux_ctx The @ref gnrc_netreg_entry_t::demux_ctx "demux context"
+ *                      for the netreg entry
+ * @param[in] direct    Target direct call descriptor for the registry entry
+ *
+ * @note    Only available with @ref net_gnrc_netapi_direct.
+ */
+static inline void gnrc_netreg_entry_init_direct(gnrc_netreg_entry_t *entry,
+                                                 uint32_t demux_ctx,
+                                                 gnrc_netreg_entry_direct_t *direct)
+{
+    entry->next = NULL;
+    entry->demux_ctx = demux_ctx;
+    entry->type = GNRC_NETREG_TYPE_DIRECT;
+    entry->target.direct = direct;
+}
+#endif
 /** @} */
 
 /**
@@ -407,6 +540,10 @@ int gnrc_netreg_num(gnrc_nettype_t type, uint32_t demux_ctx);
  * results of this function: It may only be released when none of the pointers
  * are used any more.
  *
+ * Entries with the same gnrc_netreg_entry_t::demux_ctx are returned in
+ * reverse order of their registration, regardless of
+ * @ref CONFIG_GNRC_NETREG_BUCKETS.
+ *
  * @param[in] entry     A registry entry retrieved by gnrc_netreg_lookup() or
  *                      gnrc_netreg_getnext(). Must not be NULL.
  *
@@ -63,6 +63,42 @@ extern "C" {
 #ifndef CONFIG_GNRC_PKTBUF_SIZE
 #define CONFIG_GNRC_PKTBUF_SIZE    (6144)
 #endif
+
+/**
+ * @name    Size classes of the slab packet buffer
+ *
+ * The `gnrc_pktbuf_slab` implementation serves every allocation from a
+ * fixed-size block of the smallest size class fitting the request, falling
+ * back to larger classes when the fitting class is exhausted. Packet snips
+ * come from their own class with blocks of `sizeof(gnrc_pktsnip_t)`.
+ *
+ * The defaults fit two full Ethernet frames and take about as much memory as
+ * the default @ref CONFIG_GNRC_PKTBUF_SIZE. The largest payload that can be
+ * allocated is @ref CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE.
+ * @{
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF
+#define CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF      (32U)   /**< number of snips */
+#endif
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_SMALL_SIZE
+#define CONFIG_GNRC_PKTBUF_SLAB_SMALL_SIZE      (64U)   /**< size of small blocks */
+#endif
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF
+#define CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF     (24U)   /**< number of small blocks */
+#endif
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_SIZE
+#define CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_SIZE     (128U)  /**< size of medium blocks */
+#endif
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_NUMOF
+#define CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_NUMOF    (12U)   /**< number of medium blocks */
+#endif
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE
+#define CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE      (1536U) /**< size of large blocks */
+#endif
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_LARGE_NUMOF
+#define CONFIG_GNRC_PKTBUF_SLAB_LARGE_NUMOF     (2U)    /**< number of large blocks */
+#endif
+/** @} */
 /** @} */
 
 /**
@@ -302,7 +338,10 @@ int gnrc_pktbuf_merge(gnrc_pktsnip_t *pkt);
  *
  * @note    Only available with DEVELHELP defined.
  *
- * @details Statistics include maximum number of reserved bytes.
+ * @details Statistics include maximum number of reserved bytes. With
+ *          `gnrc_pktbuf_slab`, usage, fallbacks to larger blocks, failed
+ *          allocations and bytes lost to internal fragmentation are printed
+ *          for every size class.
  */
 void gnrc_pktbuf_stats(void);
 #endif
@@ -125,6 +125,22 @@ extern "C" {
 #define CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER              (0U)
 #endif
 
+/**
+ * @brief   Look reassembly buffer entries up via a hash index
+ *
+ * @note    Only applicable with
+ *          [gnrc_sixlowpan_frag_rb](@ref net_gnrc_sixlowpan_frag_rb) module
+ *
+ * Entries are hashed by source address, destination address and datagram tag
+ * into @ref CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE buckets, so a received
+ * fragment does not need to be compared against every entry of the reassembly
+ * buffer. This costs two pointers per entry and pays off for large reassembly
+ * buffers, e.g. on border routers.
+ */
+#ifndef CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_INDEX
+#define CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_INDEX                  0
+#endif
+
 /**
  * @brief   Registration lifetime in minutes for the address registration option
  *
@@ -169,6 +185,53 @@ extern "C" {
 #define CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_TIMEOUT_US  (CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_US)
 #endif  /* CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_TIMEOUT_US */
 
+/**
+ * @brief   Look VRB entries up via a hash index
+ *
+ * @note    Only applicable with
+ *          [gnrc_sixlowpan_frag_vrb](@ref net_gnrc_sixlowpan_frag_vrb) module.
+ *
+ * Entries are hashed by source address and tag of the incoming fragments into
+ * @ref CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE buckets, so forwarding a subsequent
+ * fragment does not need to compare against every entry of the VRB. This
+ * costs two pointers per entry.
+ */
+#ifndef CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_INDEX
+#define CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_INDEX       0
+#endif
+
+/**
+ * @brief   Number of forwarding flows to keep statistics for
+ *
+ * @note    Only applicable with the `gnrc_sixlowpan_frag_stats` and
+ *          [gnrc_sixlowpan_frag_vrb](@ref net_gnrc_sixlowpan_frag_vrb)
+ *          modules.
+ *
+ * A flow is identified by the link-layer address fragments are received from
+ * and the link-layer address they are forwarded to. Fragments of further
+ * flows are only counted in total.
+ */
+#ifndef CONFIG_GNRC_SIXLOWPAN_FRAG_STATS_FLOWS
+#define CONFIG_GNRC_SIXLOWPAN_FRAG_STATS_FLOWS     (4U)
+#endif
+
+/**
+ * @brief   Number of flows to cache the compressed IPv6 header for
+ *
+ * @note    Only applicable with
+ *          [gnrc_sixlowpan_iphc](@ref net_gnrc_sixlowpan_iphc) module.
+ *
+ * A flow is identified by the interface, the link-layer destination and the
+ * IPv6 header without the payload length. For a cached flow the compressed
+ * header of the last packet is copied instead of looking up the compression
+ * contexts and the interface identifiers again. The cache is flushed whenever
+ * the compression contexts change. Each entry takes about 110 bytes of RAM.
+ * 0 disables the cache.
+ */
+#ifndef CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE
+#define CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE      (0U)
+#endif
+
 /**
  * @name Selective fragment recovery configuration
  * @see  [RFC 8931, section 7.1]
@@ -120,12 +120,19 @@ gnrc_sixlowpan_ctx_t *gnrc_sixlowpan_ctx_update(uint8_t id, const ipv6_addr_t *p
  *
  * @param[in] id    A context ID.
  */
-static inline void gnrc_sixlowpan_ctx_remove(uint8_t id)
-{
-    if (IS_USED(MODULE_GNRC_SIXLOWPAN_CTX)) {
-        gnrc_sixlowpan_ctx_lookup_id(id)->prefix_len = 0;
-    }
-}
+void gnrc_sixlowpan_ctx_remove(uint8_t id);
+
+/**
+ * @brief   Gets the current generation of the context buffer
+ *
+ * The generation changes whenever a context is updated or removed, or when
+ * the lifetime of a context expires so it may not be used for compression
+ * anymore. This allows users to cache decisions derived from the context
+ * buffer (e.g. a compressed header) as long as the generation stays the same.
+ *
+ * @return  The current generation of the context buffer.
+ */
+uint32_t gnrc_sixlowpan_ctx_generation(void);
 
 /**
  * @brief   Check if a prefix matches a compression context
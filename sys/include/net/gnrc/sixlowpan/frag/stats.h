@@ -20,10 +20,36 @@
  * @author  Martine Lenders <m.lenders@fu-berlin.de>
  */
 
+#include <stddef.h>
+#include <stdint.h>
+
+#include "net/gnrc/sixlowpan/config.h"
+#include "net/ieee802154.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+#if defined(MODULE_GNRC_SIXLOWPAN_FRAG_VRB) || DOXYGEN
+/**
+ * @brief   Statistics on a forwarding flow
+ *
+ * @note    Only available with the `gnrc_sixlowpan_frag_vrb` module
+ */
+typedef struct {
+    uint8_t src[IEEE802154_LONG_ADDRESS_LEN];   /**< link-layer address
+                                                 *   fragments are received
+                                                 *   from */
+    uint8_t dst[IEEE802154_LONG_ADDRESS_LEN];   /**< link-layer address
+                                                 *   fragments are forwarded
+                                                 *   to */
+    uint8_t src_len;        /**< length of gnrc_sixlowpan_frag_stats_flow_t::src,
+                             *   0 if the flow is unused */
+    uint8_t dst_len;        /**< length of gnrc_sixlowpan_frag_stats_flow_t::dst */
+    unsigned fragments;     /**< forwarded fragments */
+} gnrc_sixlowpan_frag_stats_flow_t;
+#endif
+
 /**
  * @brief   Statistics on fragmentation and reassembly
  *
@@ -39,6 +65,13 @@ typedef struct {
 #if defined(MODULE_GNRC_SIXLOWPAN_FRAG_VRB) || DOXYGEN
     unsigned vrb_full;      /**< counts the number of events where the virtual
                              *   reassembly buffer is full */
+    unsigned fwd_fragments; /**< fragments forwarded via the virtual
+                             *   reassembly buffer */
+    /**
+     * @brief   Forwarded fragments per flow, in the order the flows were
+     *          first seen
+     */
+    gnrc_sixlowpan_frag_stats_flow_t flows[CONFIG_GNRC_SIXLOWPAN_FRAG_STATS_FLOWS];
 #endif
 } gnrc_sixlowpan_frag_stats_t;
 
@@ -49,6 +82,21 @@ typedef struct {
  */
 gnrc_sixlowpan_frag_stats_t *gnrc_sixlowpan_frag_stats_get(void);
 
+#if defined(MODULE_GNRC_SIXLOWPAN_FRAG_VRB) || DOXYGEN
+/**
+ * @brief   Counts a fragment forwarded via the virtual reassembly buffer
+ *
+ * @note    Only available with the `gnrc_sixlowpan_frag_vrb` module
+ *
+ * @param[in] src       Link-layer address the fragment was received from.
+ * @param[in] src_len   Length of @p src.
+ * @param[in] dst       Link-layer address the fragment is forwarded to.
+ * @param[in] dst_len   Length of @p dst.
+ */
+void gnrc_sixlowpan_frag_stats_forwarded(const uint8_t *src, size_t src_len,
+                                         const uint8_t *dst, size_t dst_len);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
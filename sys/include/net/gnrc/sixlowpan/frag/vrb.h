@@ -38,6 +38,12 @@
 extern "C" {
 #endif
 
+/**
+ * @brief   Message type for triggering garbage collection of the virtual
+ *          reassembly buffer
+ */
+#define GNRC_SIXLOWPAN_FRAG_VRB_GC_MSG      (0x0229)
+
 /**
  * @brief   Representation of the virtual reassembly buffer entry
  *
@@ -107,9 +113,26 @@ gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_from_route(
 
 /**
  * @brief   Checks timeouts and removes entries if necessary
+ *
+ * Called by the 6LoWPAN thread on @ref GNRC_SIXLOWPAN_FRAG_VRB_GC_MSG. A
+ * single timer sends this message when the oldest entry times out, so the
+ * entries need not be checked on every received fragment.
  */
 void gnrc_sixlowpan_frag_vrb_gc(void);
 
+/**
+ * @brief   Sets the arrival time of a VRB entry
+ *
+ * Use this instead of setting gnrc_sixlowpan_frag_rb_base_t::arrival
+ * directly when the entry may time out earlier than before, so garbage
+ * collection is scheduled accordingly.
+ *
+ * @param[in] vrb       A VRB entry
+ * @param[in] arrival   The new arrival time in microseconds
+ */
+void gnrc_sixlowpan_frag_vrb_set_arrival(gnrc_sixlowpan_frag_vrb_t *vrb,
+                                         uint32_t arrival);
+
 /**
  * @brief   Gets a VRB entry
  *
@@ -146,13 +169,7 @@ gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_reverse(
  *
  * @param[in] vrb   A VRB entry
  */
-static inline void gnrc_sixlowpan_frag_vrb_rm(gnrc_sixlowpan_frag_vrb_t *vrb)
-{
-    if (IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB)) {
-        gnrc_sixlowpan_frag_rb_base_rm(&vrb->super);
-    }
-    vrb->super.src_len = 0;
-}
+void gnrc_sixlowpan_frag_vrb_rm(gnrc_sixlowpan_frag_vrb_t *vrb);
 
 /**
  * @brief   Determines if a VRB entry is empty
@@ -22,6 +22,7 @@
 
 #include <stdbool.h>
 
+#include "net/gnrc/netif.h"
 #include "net/gnrc/pkt.h"
 #include "net/sixlowpan.h"
 
@@ -63,6 +64,27 @@ void gnrc_sixlowpan_iphc_recv(gnrc_pktsnip_t *pkt, void *ctx, unsigned page);
  */
 void gnrc_sixlowpan_iphc_send(gnrc_pktsnip_t *pkt, void *ctx, unsigned page);
 
+#if defined(TEST_SUITES) || defined(DOXYGEN)
+/**
+ * @brief   Compresses only the IPv6 header of a packet
+ *
+ * @note    Only available when @ref TEST_SUITES is defined
+ *
+ * @pre (pkt != NULL) && (iface != NULL)
+ *
+ * @param[in] pkt       A packet starting with a @ref gnrc_netif_hdr_t, followed
+ *                      by the IPv6 header to compress. @p pkt is not changed.
+ * @param[in] iface     The interface @p pkt is sent over.
+ * @param[out] iphc_hdr Buffer for the compressed header. Must be at least
+ *                      the size of the IPv6 header plus 1 byte.
+ *
+ * @return  Length of the compressed header in @p iphc_hdr on success.
+ * @return  0 on error.
+ */
+size_t gnrc_sixlowpan_iphc_encode_hdr(gnrc_pktsnip_t *pkt, gnrc_netif_t *iface,
+                                      uint8_t *iphc_hdr);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
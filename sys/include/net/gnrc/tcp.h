@@ -149,7 +149,6 @@ void gnrc_tcp_tcb_queue_init(gnrc_tcp_tcb_queue_t *queue);
  * @return   -EINVAL if @p remote and @p tcb address_family do not match
  *                    or @p target_addr is invalid.
  * @return   -EISCONN if @p tcb is already connected.
- * @return   -ENOMEM if there are no receive buffer left to use for @p tcb.
  * @return   -EADDRINUSE if @p local_port is already in use.
  * @return   -ETIMEDOUT if the connection attempt timed out.
  * @return   -ECONNREFUSED if the connection attempt was reset by the peer.
@@ -166,6 +165,11 @@ int gnrc_tcp_open(gnrc_tcp_tcb_t *tcb, const gnrc_tcp_ep_t *remote, uint16_t loc
  * @pre @p local len must be NULL.
  * @pre @p local->port must not be 0.
  *
+ * @note The TCBs complete handshakes without waiting for gnrc_tcp_accept(),
+ *       up to @ref CONFIG_GNRC_TCP_LISTEN_BACKLOG connections that are not
+ *       accepted yet. SYNs that find no free TCB or a full backlog are
+ *       dropped and counted in the statistics of @p queue.
+ *
  * @param[in,out] queue   Listening queue for incoming connections.
  * @param[in] tcbs        TCBs associated with @p queue.
  * @param[in] tcbs_len    Number of TCBs behind @p tcbs.
@@ -175,8 +179,6 @@ int gnrc_tcp_open(gnrc_tcp_tcb_t *tcb, const gnrc_tcp_ep_t *remote, uint16_t loc
  * @return   -EAFNOSUPPORT given address family in @p local is not supported.
  * @return   -EINVAL address_family in @p tcbs and @p local do not match.
  * @return   -EISCONN a TCB in @p tcbs is already connected.
- * @return   -ENOMEM all available receive buffers are in use.
- *                   Increase GNRC_TCP_RCV_BUFFERS.
  */
 int gnrc_tcp_listen(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t *tcbs, size_t tcbs_len,
                     const gnrc_tcp_ep_t *local);
@@ -205,6 +207,34 @@ int gnrc_tcp_listen(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t *tcbs, size_t tc
 int gnrc_tcp_accept(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t **tcb,
                     const uint32_t user_timeout_duration_ms);
 
+/**
+ * @brief Accept all established TCP connections from listening queue.
+ *
+ * @pre @p queue must not be NULL
+ * @pre @p tcbs must not be NULL
+ * @pre @p tcbs_len must be greater 0.
+ *
+ * @note Function blocks if @p user_timeout_duration_ms is not zero and no
+ *       connection is ready to accept.
+ *
+ * @param[in]  queue                      Listening queue to accept connections from.
+ * @param[out] tcbs                       Array receiving pointers to the TCBs of
+ *                                        the accepted connections.
+ * @param[in]  tcbs_len                   Maximum number of connections to accept.
+ * @param[in]  user_timeout_duration_ms   User specified timeout in milliseconds. If
+ *                                        GNRC_TCP_NO_TIMEOUT the function blocks until a
+ *                                        connection was established or an error occurred.
+ *
+ * @return The number of accepted connections on success.
+ * @return -ENOMEM if all connection in @p queue were already accepted.
+ * @return -EINVAL if listen was never called on queue.
+ * @return -EAGAIN if @p user_timeout_duration_ms was 0 and no connection is ready to accept.
+ * @return -ETIMEDOUT if @p user_timeout_duration_ms was not 0 and no connection
+ *                    could be established.
+ */
+int gnrc_tcp_accept_multi(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t **tcbs, size_t tcbs_len,
+                          const uint32_t user_timeout_duration_ms);
+
 /**
  * @brief Transmit data to connected peer.
  *
@@ -213,6 +243,8 @@ int gnrc_tcp_accept(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t **tcb,
  * @pre @p data must not be NULL.
  *
  * @note Blocks until up to @p len bytes were transmitted or an error occurred.
+ *       Up to @ref CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE segments are sent
+ *       before their acknowledgment is awaited.
  *
  * @param[in,out] tcb                        TCB holding the connection information.
  * @param[in]     data                       Pointer to the data that should be transmitted.
@@ -341,6 +373,17 @@ int gnrc_tcp_get_remote(gnrc_tcp_tcb_t *tcb, gnrc_tcp_ep_t *ep);
  */
 int gnrc_tcp_queue_get_local(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_ep_t *ep);
 
+/**
+ * @brief Gets the statistics of a TCB queue
+ *
+ * @pre queue must not be NULL
+ * @pre stats must not be NULL
+ *
+ * @param[in] queue    TCB queue to get the statistics of.
+ * @param[out] stats   The statistics of @p queue.
+ */
+void gnrc_tcp_queue_get_stats(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_queue_stats_t *stats);
+
 /**
  * @brief Calculate and set checksum in TCP header.
  *
@@ -85,16 +85,18 @@ extern "C" {
 
 /**
  * @brief Default receive window size
+ *
+ * This is the largest receive window a connection announces. Windows larger
+ * than 65535 bytes require @ref CONFIG_GNRC_TCP_WND_SCALE_EN.
  */
 #ifndef CONFIG_GNRC_TCP_DEFAULT_WINDOW
 #define CONFIG_GNRC_TCP_DEFAULT_WINDOW (CONFIG_GNRC_TCP_MSS * CONFIG_GNRC_TCP_MSS_MULTIPLICATOR)
 #endif
 
 /**
- * @brief Number of preallocated receive buffers.
+ * @brief Number of receive buffers the receive buffer pool is sized for.
  *
- * This value determines how many parallel TCP connections can be active at the
- * same time.
+ * Only used to calculate the default of @ref CONFIG_GNRC_TCP_RCV_BUF_POOL_SIZE.
  */
 #ifndef CONFIG_GNRC_TCP_RCV_BUFFERS
 #define CONFIG_GNRC_TCP_RCV_BUFFERS (1U)
@@ -107,6 +109,30 @@ extern "C" {
 #define GNRC_TCP_RCV_BUF_SIZE (CONFIG_GNRC_TCP_DEFAULT_WINDOW)
 #endif
 
+/**
+ * @brief Size of the receive buffer pool shared by all connections in bytes.
+ *
+ * Connections take blocks of @ref CONFIG_GNRC_TCP_RCV_BUF_BLOCK_SIZE bytes
+ * from the pool for received data and return them as soon as the data was
+ * read. The receive window of a connection is limited by
+ * @ref CONFIG_GNRC_TCP_DEFAULT_WINDOW and by the blocks it could reserve in
+ * the pool: blocks behind an advertised window are kept for the connection
+ * until it is closed.
+ */
+#ifndef CONFIG_GNRC_TCP_RCV_BUF_POOL_SIZE
+#define CONFIG_GNRC_TCP_RCV_BUF_POOL_SIZE (CONFIG_GNRC_TCP_RCV_BUFFERS * GNRC_TCP_RCV_BUF_SIZE)
+#endif
+
+/**
+ * @brief Size of a block in the receive buffer pool in bytes.
+ *
+ * Smaller blocks waste less memory on partially filled blocks, larger blocks
+ * need less list handling per received byte.
+ */
+#ifndef CONFIG_GNRC_TCP_RCV_BUF_BLOCK_SIZE
+#define CONFIG_GNRC_TCP_RCV_BUF_BLOCK_SIZE (128U)
+#endif
+
 /**
  * @brief Lower bound for RTO in milliseconds. Default is 1 sec (see RFC 6298)
  *
@@ -204,6 +230,76 @@ extern "C" {
 #ifndef CONFIG_GNRC_TCP_EXPERIMENTAL_DYN_MSL_RTO_MUL
 #define CONFIG_GNRC_TCP_EXPERIMENTAL_DYN_MSL_RTO_MUL (4U)
 #endif
+
+/**
+ * @brief Number of unacknowledged segments a connection may have in flight.
+ *
+ * Every queued segment stays in the packet buffer until it is acknowledged.
+ * With the default of 1 a connection waits for every segment to be
+ * acknowledged before it sends the next one. Larger values allow duplicate
+ * ACKs to trigger fast retransmit and NewReno fast recovery (RFC 5681,
+ * RFC 6582) instead of waiting for the retransmission timeout. Must not
+ * exceed 32.
+ */
+#ifndef CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE
+#define CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE (1U)
+#endif
+
+/**
+ * @brief Number of duplicate ACKs that trigger a fast retransmit.
+ */
+#ifndef CONFIG_GNRC_TCP_DUP_ACK_THRESHOLD
+#define CONFIG_GNRC_TCP_DUP_ACK_THRESHOLD (3U)
+#endif
+
+/**
+ * @brief Number of out-of-order segments a connection keeps until the missing
+ *        data arrives.
+ *
+ * With the default of 0 segments that do not start at the next expected
+ * sequence number are dropped and have to be retransmitted.
+ */
+#ifndef CONFIG_GNRC_TCP_OOO_QUEUE_SIZE
+#define CONFIG_GNRC_TCP_OOO_QUEUE_SIZE (0U)
+#endif
+
+/**
+ * @brief Enable selective acknowledgments (SACK, RFC 2018). Disabled by default.
+ *
+ * The SACK-permitted option is offered during connection setup. If the peer
+ * agrees, queued out-of-order segments (see
+ * @ref CONFIG_GNRC_TCP_OOO_QUEUE_SIZE) are reported with SACK options and
+ * SACK options received from the peer keep segments it already holds from
+ * being retransmitted during loss recovery.
+ */
+#ifndef CONFIG_GNRC_TCP_SACK_EN
+#define CONFIG_GNRC_TCP_SACK_EN 0
+#endif
+
+/**
+ * @brief Enable the window scale option (RFC 7323). Disabled by default.
+ *
+ * The option is offered during connection setup. If the peer agrees, windows
+ * larger than 65535 bytes can be announced in both directions. The shift
+ * count this side announces is derived from @ref CONFIG_GNRC_TCP_DEFAULT_WINDOW.
+ */
+#ifndef CONFIG_GNRC_TCP_WND_SCALE_EN
+#define CONFIG_GNRC_TCP_WND_SCALE_EN 0
+#endif
+
+/**
+ * @brief Maximum number of connections of a listening queue that are not
+ *        accepted yet.
+ *
+ * Handshakes are completed by the TCBs of a queue without waiting for
+ * gnrc_tcp_accept(). This limits the number of connections that are being
+ * established or wait to be accepted. Further SYNs are dropped, so the peer
+ * retries later, and counted in gnrc_tcp_tcb_queue_stats_t::syn_dropped.
+ * If 0, the backlog is only limited by the number of TCBs of the queue.
+ */
+#ifndef CONFIG_GNRC_TCP_LISTEN_BACKLOG
+#define CONFIG_GNRC_TCP_LISTEN_BACKLOG (0U)
+#endif
 /** @} */
 
 #ifdef __cplusplus
@@ -19,8 +19,8 @@
  * @author      Simon Brummer <simon.brummer@posteo.de>
  */
 
+#include <assert.h>
 #include <stdint.h>
-#include "ringbuffer.h"
 #include "mutex.h"
 #include "evtimer_msg.h"
 #include "evtimer_mbox.h"
@@ -37,6 +37,20 @@
 extern "C" {
 #endif
 
+/* gnrc_tcp_tcb_t::rtx_sacked has one bit per retransmit queue slot */
+static_assert(CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE <= 32,
+              "CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE must not exceed 32");
+
+/**
+ * @brief Block of the receive buffer pool, defined in gnrc_tcp_rcvbuf.c.
+ */
+struct _gnrc_tcp_rcvbuf_block;
+
+/**
+ * @brief Forward declaration of the listening queue a TCB belongs to.
+ */
+struct sock_tcp_queue;
+
 /**
  * @brief Transmission control block of GNRC TCP.
  */
@@ -50,34 +64,64 @@ typedef struct sock_tcp {
     uint16_t local_port;   /**< Local connections port number */
     uint16_t peer_port;    /**< Peer connections port number */
     uint8_t state;         /**< Connections state */
-    uint8_t status;        /**< A connections status flags */
+    uint16_t status;       /**< A connections status flags */
     uint32_t snd_una;      /**< Send unacknowledged */
     uint32_t snd_nxt;      /**< Send next */
-    uint16_t snd_wnd;      /**< Send window */
+    uint32_t snd_wnd;      /**< Send window */
     uint32_t snd_wl1;      /**< SeqNo. from last window update */
     uint32_t snd_wl2;      /**< AckNo. from last window update */
     uint32_t rcv_nxt;      /**< Receive next */
-    uint16_t rcv_wnd;      /**< Receive window */
+    uint32_t rcv_wnd;      /**< Receive window */
     uint32_t iss;          /**< Initial sequence sumber */
     uint32_t irs;          /**< Initial received sequence number */
     uint16_t mss;          /**< The peers MSS */
+    uint8_t snd_wnd_shift; /**< Window scale shift count of the peer */
+    uint8_t rcv_wnd_shift; /**< Window scale shift count announced to the peer */
     uint32_t rtt_start;    /**< Timer value for rtt estimation */
     int32_t rtt_var;       /**< Round trip time variance */
     int32_t srtt;          /**< Smoothed round trip time */
     int32_t rto;           /**< Retransmission timeout duration */
     uint8_t retries;       /**< Number of retransmissions */
+    uint8_t rtx_len;       /**< Number of segments in the retransmit queue */
+    uint8_t dup_acks;      /**< Number of duplicate ACKs received */
+    uint32_t rtx_sacked;   /**< Bitmap of selectively acknowledged segments in retransmit queue */
+    uint32_t rtt_seq;      /**< SeqNo. after the segment used for rtt estimation */
+    uint32_t cwnd;         /**< Congestion window */
+    uint32_t ssthresh;     /**< Slow start threshold */
+    uint32_t recover;      /**< Send next, when loss recovery was entered */
+    uint32_t rtx_high;     /**< SeqNo. after the last segment retransmitted during recovery */
     evtimer_msg_event_t event_retransmit; /**< Retransmission event */
     evtimer_msg_event_t event_timeout;    /**< Timeout event */
     evtimer_mbox_event_t event_misc;      /**< General purpose event */
-    gnrc_pktsnip_t *pkt_retransmit;       /**< Pointer to packet in "retransmit queue" */
+    gnrc_pktsnip_t *pkt_retransmit[CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE]; /**< "Retransmit queue",
+                                                                               oldest first */
+#if CONFIG_GNRC_TCP_OOO_QUEUE_SIZE || defined(DOXYGEN)
+    gnrc_pktsnip_t *pkt_ooo[CONFIG_GNRC_TCP_OOO_QUEUE_SIZE]; /**< Out-of-order received segments,
+                                                                 ordered by SeqNo. */
+    uint8_t ooo_len;       /**< Number of segments in pkt_ooo */
+#endif
     mbox_t *mbox;            /**< TCB mbox for synchronization */
-    uint8_t *rcv_buf_raw;    /**< Pointer to the receive buffer */
-    ringbuffer_t rcv_buf;    /**< Receive buffer data structure */
+    struct sock_tcp_queue *queue; /**< Listening queue this TCB belongs to */
+    struct _gnrc_tcp_rcvbuf_block *rcv_head; /**< Oldest block of the receive buffer */
+    struct _gnrc_tcp_rcvbuf_block *rcv_tail; /**< Newest block of the receive buffer */
+    uint16_t rcv_head_pos;   /**< Read position in rcv_head */
+    uint16_t rcv_tail_pos;   /**< Write position in rcv_tail */
+    uint32_t rcv_buf_len;    /**< Number of bytes in the receive buffer */
+    uint16_t rcv_reserved;   /**< Pool blocks reserved for the advertised window */
     mutex_t fsm_lock;        /**< Mutex for FSM access synchronization */
     mutex_t function_lock;   /**< Mutex for function call synchronization */
     struct sock_tcp *next;   /**< Pointer next TCB */
 } gnrc_tcp_tcb_t;
 
+/**
+ * @brief Statistics of a transmission control block queue.
+ */
+typedef struct {
+    uint32_t syn_rcvd;    /**< SYNs that started a handshake */
+    uint32_t syn_dropped; /**< SYNs dropped because the backlog was full */
+    uint32_t accepted;    /**< Connections returned by accept */
+} gnrc_tcp_tcb_queue_stats_t;
+
 /**
  * @brief Transmission control block queue.
  */
@@ -85,12 +129,13 @@ typedef struct sock_tcp_queue {
     mutex_t lock;         /**< Mutex for access synchronization */
     gnrc_tcp_tcb_t *tcbs; /**< Pointer to TCB sequence */
     size_t tcbs_len;      /**< Number of TCBs behind member tcbs */
+    gnrc_tcp_tcb_queue_stats_t stats; /**< Statistics of this queue */
 } gnrc_tcp_tcb_queue_t;
 
 /**
  * @brief Static initializer for type gnrc_tcp_tcb_queue_t
  */
-#define GNRC_TCP_TCB_QUEUE_INIT   { MUTEX_INIT, NULL, 0 }
+#define GNRC_TCP_TCB_QUEUE_INIT   { MUTEX_INIT, NULL, 0, { 0, 0, 0 } }
 
 #ifdef __cplusplus
 }
@@ -452,6 +452,21 @@ static inline bool ipv6_addr_is_solicited_node(const ipv6_addr_t *addr)
  */
 bool ipv6_addr_equal(const ipv6_addr_t *a, const ipv6_addr_t *b);
 
+/**
+ * @brief   XOR-folds an IPv6 address into 32 bits.
+ *
+ * Combine with @ref mix32_hash() to index a hash table by IPv6 address.
+ *
+ * @param[in] addr  An IPv6 address.
+ *
+ * @return  The XOR of the four 32 bit words of @p addr.
+ */
+static inline uint32_t ipv6_addr_fold32(const ipv6_addr_t *addr)
+{
+    return addr->u32[0].u32 ^ addr->u32[1].u32 ^
+           addr->u32[2].u32 ^ addr->u32[3].u32;
+}
+
 /**
  * @brief   Checks up to which bit-count two IPv6 addresses match in their
  *          prefix.
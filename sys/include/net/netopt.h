@@ -870,6 +870,21 @@ typedef enum {
      */
     NETOPT_GTS_TX,
 
+    /**
+     * @brief   (@ref netopt_enable_t) another received frame is waiting to be
+     *          fetched with netdev_driver_t::recv()
+     *
+     * Read-only. Allows an upper layer to drain several frames per
+     * @ref NETDEV_EVENT_RX_COMPLETE. Drivers that cannot tell without
+     * reading the frame do not implement this option.
+     *
+     * If the option is enabled, the driver may leave it to the upper layer to
+     * fetch the pending frame and not signal it with another event. An upper
+     * layer that stops fetching anyway has to call netdev_driver_t::isr()
+     * later, which signals the pending frame again.
+     */
+    NETOPT_RX_PENDING,
+
     /**
      * @brief   maximum number of options defined here.
      *
@@ -22,6 +22,7 @@
 
 #include <stdint.h>
 #include "cib.h"
+#include "net/gnrc/ipv6/dst_cache.h"
 #include "net/l2util.h"
 #include "mutex.h"
 
@@ -67,6 +68,12 @@ typedef struct {
     uint32_t tx_bytes;          /**< sent bytes */
     uint32_t rx_count;          /**< received (data) packets */
     uint32_t rx_bytes;          /**< received bytes */
+#if CONFIG_GNRC_IPV6_DST_CACHE_NUMOF || DOXYGEN
+    uint32_t dst_cache_hits;    /**< next hops found in the destination
+                                     cache (IPv6 only) */
+    uint32_t dst_cache_misses;  /**< next hops not found in the destination
+                                     cache (IPv6 only) */
+#endif
 } netstats_t;
 
 /**
@@ -133,6 +133,15 @@ extern "C" {
  * for the `sock_async_ctx_t` type.
  */
 #define SOCK_HAS_ASYNC_CTX
+/**
+ * @brief   Received datagrams are provided in a single buffer
+ *
+ * Set by stacks whose `sock_*_recv_buf()` functions always return the
+ * complete payload of a datagram with the first call. Applications can then
+ * parse the payload in place instead of gathering it into a buffer of their
+ * own.
+ */
+#define SOCK_HAS_RECV_BUF_SINGLE
 /** @} */
 #endif
 
@@ -632,6 +632,29 @@ static inline ssize_t sock_udp_recv_buf(sock_udp_t *sock,
     return sock_udp_recv_buf_aux(sock, data, buf_ctx, timeout, remote, NULL);
 }
 
+/**
+ * @brief   Releases the stack-internal buffer space of a UDP message received
+ *          with @ref sock_udp_recv_buf() or @ref sock_udp_recv_buf_aux()
+ *
+ * Skips all remaining segments of the message, so the data provided by the
+ * stack can be used in place until the message is not needed anymore.
+ *
+ * @pre `(sock != NULL) && (buf_ctx != NULL)`
+ *
+ * @param[in] sock          A UDP sock object.
+ * @param[in,out] buf_ctx   Stack-internal buffer context of the message.
+ *                          Points to `NULL` afterwards. Nothing happens if it
+ *                          already points to `NULL`.
+ */
+static inline void sock_udp_recv_buf_release(sock_udp_t *sock, void **buf_ctx)
+{
+    void *data;
+
+    while (*buf_ctx != NULL) {
+        sock_udp_recv_buf(sock, &data, buf_ctx, 0, NULL);
+    }
+}
+
 /**
  * @brief   Sends a UDP message to remote end point with non-continuous payload
  *
@@ -797,6 +820,181 @@ static inline ssize_t sock_udp_sendv(sock_udp_t *sock,
     return sock_udp_sendv_aux(sock, snips, remote, NULL);
 }
 
+#if defined(MODULE_SOCK_UDP_BATCH) || defined(DOXYGEN)
+/**
+ * @brief   Sends multiple UDP messages to the same remote end point
+ *
+ * Does the same as calling @ref sock_udp_sendv_aux() for every message in
+ * @p msgs, but the end points are only resolved once for all of them.
+ *
+ * @pre `((sock != NULL || remote != NULL)) && ((numof == 0) || (msgs != NULL))`
+ *
+ * @note    Select module `sock_udp_batch` and a compatible network stack to
+ *          use this function.
+ *
+ * @param[in] sock      A UDP sock object. May be `NULL`.
+ *                      A sensible local end point should be selected by the
+ *                      implementation in that case.
+ * @param[in] msgs      List of payload chunks for each message. Messages are
+ *                      sent in order. Entries may be `NULL` for an empty
+ *                      message.
+ * @param[in] numof     Number of messages in @p msgs.
+ * @param[in] remote    Remote end point for all messages.
+ *                      May be `NULL`, if @p sock has a remote end point.
+ *                      sock_udp_ep_t::family may be AF_UNSPEC, if local
+ *                      end point of @p sock provides this information.
+ *                      sock_udp_ep_t::port may not be 0.
+ * @param[out] aux      Auxiliary data about the transmission, applies to all
+ *                      messages. May be `NULL`, if it is not required by the
+ *                      application.
+ *
+ * @experimental    This function is quite new, not implemented for all stacks
+ *                  yet, and may be subject to sudden API changes. Do not use in
+ *                  production if this is unacceptable.
+ *
+ * @return  The number of messages sent on success. Sending stops with the
+ *          first message that could not be sent.
+ * @return  Same negative errors as @ref sock_udp_sendv_aux(), if not even the
+ *          first message could be sent.
+ */
+ssize_t sock_udp_sendv_batch_aux(sock_udp_t *sock,
+                                 const iolist_t *const *msgs, unsigned numof,
+                                 const sock_udp_ep_t *remote,
+                                 sock_udp_aux_tx_t *aux);
+
+/**
+ * @brief   Sends multiple UDP messages to the same remote end point
+ *
+ * @see sock_udp_sendv_batch_aux()
+ *
+ * @param[in] sock      A UDP sock object. May be `NULL`.
+ * @param[in] msgs      List of payload chunks for each message.
+ * @param[in] numof     Number of messages in @p msgs.
+ * @param[in] remote    Remote end point for all messages.
+ *                      May be `NULL`, if @p sock has a remote end point.
+ *
+ * @return  The number of messages sent on success.
+ * @return  Same negative errors as @ref sock_udp_sendv_aux(), if not even the
+ *          first message could be sent.
+ */
+static inline ssize_t sock_udp_sendv_batch(sock_udp_t *sock,
+                                           const iolist_t *const *msgs,
+                                           unsigned numof,
+                                           const sock_udp_ep_t *remote)
+{
+    return sock_udp_sendv_batch_aux(sock, msgs, numof, remote, NULL);
+}
+
+/**
+ * @brief   Starts to collect the payload of a UDP message in the buffer of
+ *          the network stack
+ *
+ * Payload is appended with @ref sock_udp_cork_appendv() and the message is
+ * sent with @ref sock_udp_uncork_aux(). The payload is written into the
+ * buffer of the stack directly, so it is neither copied nor allocated again
+ * when the message is sent.
+ *
+ * @pre `sock != NULL`
+ *
+ * @note    Select module `sock_udp_batch` and a compatible network stack to
+ *          use this function.
+ *
+ * @param[in] sock      A UDP sock object.
+ * @param[in] max_len   Maximum payload length of the message.
+ *
+ * @experimental    This function is quite new, not implemented for all stacks
+ *                  yet, and may be subject to sudden API changes. Do not use in
+ *                  production if this is unacceptable.
+ *
+ * @return  0 on success.
+ * @return  -EALREADY, if @p sock already collects a message.
+ * @return  -ENOMEM, if no memory was available for @p max_len bytes.
+ */
+int sock_udp_cork(sock_udp_t *sock, size_t max_len);
+
+/**
+ * @brief   Appends payload to the message started with @ref sock_udp_cork()
+ *
+ * @pre `sock != NULL`
+ *
+ * @param[in] sock      A UDP sock object.
+ * @param[in] snips     List of payload chunks, will be processed in order.
+ *                      May be `NULL`.
+ *
+ * @return  The payload length of the message so far on success.
+ * @return  -ENOBUFS, if @p snips does not fit into the message. Nothing is
+ *          appended in that case.
+ * @return  -ENOENT, if @p sock does not collect a message.
+ */
+ssize_t sock_udp_cork_appendv(sock_udp_t *sock, const iolist_t *snips);
+
+/**
+ * @brief   Appends payload to the message started with @ref sock_udp_cork()
+ *
+ * @pre `(sock != NULL) && (if (len != 0): (data != NULL))`
+ *
+ * @param[in] sock      A UDP sock object.
+ * @param[in] data      Payload to append.
+ * @param[in] len       Length of @p data.
+ *
+ * @return  The payload length of the message so far on success.
+ * @return  -ENOBUFS, if @p data does not fit into the message. Nothing is
+ *          appended in that case.
+ * @return  -ENOENT, if @p sock does not collect a message.
+ */
+static inline ssize_t sock_udp_cork_append(sock_udp_t *sock,
+                                           const void *data, size_t len)
+{
+    const iolist_t snip = {
+        NULL,
+        (void *)data,
+        len,
+    };
+
+    return sock_udp_cork_appendv(sock, &snip);
+}
+
+/**
+ * @brief   Sends the message started with @ref sock_udp_cork()
+ *
+ * The message is discarded if it can not be sent and @p sock does not
+ * collect a message anymore in any case.
+ *
+ * @pre `sock != NULL`
+ *
+ * @param[in] sock      A UDP sock object.
+ * @param[in] remote    Remote end point for the message.
+ *                      May be `NULL`, if @p sock has a remote end point.
+ * @param[out] aux      Auxiliary data about the transmission.
+ *                      May be `NULL`, if it is not required by the application.
+ *
+ * @return  The number of bytes sent on success.
+ * @return  Same negative errors as @ref sock_udp_sendv_aux().
+ * @return  -ENOENT, if @p sock does not collect a message.
+ */
+ssize_t sock_udp_uncork_aux(sock_udp_t *sock, const sock_udp_ep_t *remote,
+                            sock_udp_aux_tx_t *aux);
+
+/**
+ * @brief   Sends the message started with @ref sock_udp_cork()
+ *
+ * @see sock_udp_uncork_aux()
+ *
+ * @param[in] sock      A UDP sock object.
+ * @param[in] remote    Remote end point for the message.
+ *                      May be `NULL`, if @p sock has a remote end point.
+ *
+ * @return  The number of bytes sent on success.
+ * @return  Same negative errors as @ref sock_udp_sendv_aux().
+ * @return  -ENOENT, if @p sock does not collect a message.
+ */
+static inline ssize_t sock_udp_uncork(sock_udp_t *sock,
+                                      const sock_udp_ep_t *remote)
+{
+    return sock_udp_uncork_aux(sock, remote, NULL);
+}
+#endif /* MODULE_SOCK_UDP_BATCH */
+
 /**
  * @brief   Checks if the IP address of an endpoint is multicast
  *
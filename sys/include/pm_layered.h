@@ -28,6 +28,19 @@
  *
  * In order to use this module, you'll need to implement pm_set().
  *
+ * Predictive mode selection
+ * -------------------------
+ *
+ * Waking up from a deep power mode takes time, e.g. to restart oscillators.
+ * If the next timer is due sooner than that, entering the mode only delays
+ * the timer. With the `pm_layered_predictive` pseudomodule, the idle thread
+ * checks how long it is until the next timer on the @ref ZTIMER_USEC,
+ * @ref ZTIMER_MSEC and @ref ZTIMER_SEC clocks (those that are used) is due.
+ * It then selects the lowest unblocked mode whose wake-up latency, as given
+ * by @ref PM_EXIT_LATENCY_US, fits into that time. How often each mode was
+ * entered, and how often it was skipped for a shallower one, can be read
+ * using pm_get_residency().
+ *
  * @file
  * @brief       Layered low power mode infrastructure
  *
@@ -37,6 +50,7 @@
 #include <stdint.h>
 #include "periph_cpu.h"
 #include "architecture.h"
+#include "modules.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -57,6 +71,35 @@ typedef struct {
     uint8_t blockers[PM_NUM_MODES];     /**< number of blockers for the mode */
 } WORD_ALIGNED pm_blocker_t;
 
+#if IS_USED(MODULE_PM_LAYERED_PREDICTIVE) || DOXYGEN
+/**
+ * @brief   Wake-up latency of each power mode in µs
+ *
+ * Array initializer with PM_NUM_MODES entries, to be defined by the CPU or
+ * board. Modes without an entry can always be selected.
+ */
+#ifndef PM_EXIT_LATENCY_US
+#define PM_EXIT_LATENCY_US  { 0 }
+#endif
+
+/**
+ * @brief   Per mode counters of the predictive mode selection
+ */
+typedef struct {
+    uint32_t entered[PM_NUM_MODES];     /**< number of times the mode was set */
+    uint32_t skipped[PM_NUM_MODES];     /**< number of times the mode was the
+                                             lowest unblocked one, but its
+                                             wake-up latency did not fit */
+} pm_residency_t;
+
+/**
+ * @brief   Get the counters of the predictive mode selection
+ *
+ * @param[out]  residency   counters
+ */
+void pm_get_residency(pm_residency_t *residency);
+#endif
+
 /**
  * @brief   Block a power mode
  *
@@ -28,12 +28,48 @@
  *
  */
 
+#include <stdbool.h>
 #include <stdint.h>
 
+#include "modules.h"
+#include "sched.h"
+
 #ifdef __cplusplus
  extern "C" {
 #endif
 
+/**
+ * @name    Histogram configuration (module `schedstatistics_histogram`)
+ * @{
+ */
+/**
+ * @brief   Number of buckets per histogram
+ *
+ * Bucket 0 counts samples below 2^@ref CONFIG_SCHEDSTATISTICS_HIST_SHIFT
+ * microseconds, every following bucket covers twice the range of its
+ * predecessor and the last bucket counts everything above.
+ */
+#ifndef CONFIG_SCHEDSTATISTICS_HIST_NUMOF
+#define CONFIG_SCHEDSTATISTICS_HIST_NUMOF   (8U)
+#endif
+
+/**
+ * @brief   Log2 of the upper bound of the first histogram bucket in
+ *          microseconds
+ */
+#ifndef CONFIG_SCHEDSTATISTICS_HIST_SHIFT
+#define CONFIG_SCHEDSTATISTICS_HIST_SHIFT   (4U)
+#endif
+/** @} */
+
+/**
+ * @brief   Logarithmic histogram of durations in microseconds
+ */
+typedef struct {
+    uint32_t count[CONFIG_SCHEDSTATISTICS_HIST_NUMOF]; /**< Samples per bucket */
+    uint32_t max_us;        /**< Largest sample seen */
+} schedstat_hist_t;
+
 /**
  *  Scheduler statistics
  */
@@ -42,6 +78,15 @@ typedef struct {
                                   scheduled to run */
     unsigned int schedules;  /**< How often the thread was scheduled to run */
     uint64_t runtime_us;     /**< The total runtime of this thread in microseconds */
+#if IS_USED(MODULE_SCHEDSTATISTICS_HISTOGRAM) || defined(DOXYGEN)
+    uint32_t wakeup;         /**< Time stamp of the last time this thread
+                                  became runnable */
+    bool pending;            /**< Thread became runnable but did not run yet */
+    schedstat_hist_t latency;   /**< Wake-up latency histogram: time from
+                                     becoming runnable to running */
+    schedstat_hist_t runtime;   /**< Runtime slice histogram: time the thread
+                                     ran before it was descheduled */
+#endif
 } schedstat_t;
 
 /**
@@ -55,6 +100,38 @@ extern schedstat_t sched_pidlist[KERNEL_PID_LAST + 1];
  */
 void init_schedstatistics(void);
 
+#if IS_USED(MODULE_SCHEDSTATISTICS_HISTOGRAM) || defined(DOXYGEN)
+/**
+ * @brief   Get the lower bound of a histogram bucket
+ *
+ * @param[in] idx   Index of the bucket, must be smaller than
+ *                  @ref CONFIG_SCHEDSTATISTICS_HIST_NUMOF
+ *
+ * @return  Smallest duration in microseconds counted in bucket @p idx
+ */
+static inline uint32_t schedstatistics_hist_bucket_min_us(unsigned idx)
+{
+    return idx ? (1UL << (CONFIG_SCHEDSTATISTICS_HIST_SHIFT + idx - 1)) : 0;
+}
+
+/**
+ * @brief   Get a consistent copy of the histograms of a thread
+ *
+ * @param[in]  pid      PID of the thread
+ * @param[out] latency  Wake-up latency histogram, may be NULL
+ * @param[out] runtime  Runtime slice histogram, may be NULL
+ */
+void schedstatistics_hist_get(kernel_pid_t pid, schedstat_hist_t *latency,
+                              schedstat_hist_t *runtime);
+
+/**
+ * @brief   Clear the histograms of a thread
+ *
+ * @param[in]  pid      PID of the thread
+ */
+void schedstatistics_hist_reset(kernel_pid_t pid);
+#endif /* MODULE_SCHEDSTATISTICS_HISTOGRAM */
+
 #ifdef __cplusplus
 }
 #endif
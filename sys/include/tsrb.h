@@ -42,6 +42,14 @@ typedef struct tsrb {
     unsigned writes;            /**< total number of writes */
 } tsrb_t;
 
+/**
+ * @brief     contiguous region of a tsrb's buffer
+ */
+typedef struct {
+    uint8_t *data;              /**< start of the region */
+    size_t len;                 /**< length of the region in bytes */
+} tsrb_region_t;
+
 /**
  * @brief Static initializer
  *
@@ -198,6 +206,47 @@ int tsrb_add_one(tsrb_t *rb, uint8_t c);
  */
 int tsrb_add(tsrb_t *rb, const uint8_t *src, size_t n);
 
+/**
+ * @brief       Get the data in the ringbuffer without copying
+ *
+ * The readable data is returned as up to two contiguous regions of the
+ * buffer, `regions[1]` is only non-empty if the data wraps around the end
+ * of the buffer. Once processed, the data is removed using tsrb_drop().
+ *
+ * The regions stay valid until dropped, as long as there is only one reader.
+ *
+ * @param[in]   rb      Ringbuffer to operate on
+ * @param[out]  regions readable regions, in order
+ * @return      nr of bytes available in @p regions
+ */
+unsigned int tsrb_peek_regions(tsrb_t *rb, tsrb_region_t regions[2]);
+
+/**
+ * @brief       Get the free space of the ringbuffer for writing without copying
+ *
+ * The free space is returned as up to two contiguous regions of the buffer,
+ * to be filled in order. Data written there is only added to the ringbuffer
+ * by calling tsrb_commit().
+ *
+ * The regions stay valid until committed, as long as there is only one
+ * writer.
+ *
+ * @param[in]   rb      Ringbuffer to operate on
+ * @param[out]  regions writable regions, in order
+ * @return      nr of bytes that can be written to @p regions
+ */
+unsigned int tsrb_free_regions(tsrb_t *rb, tsrb_region_t regions[2]);
+
+/**
+ * @brief       Add bytes written to the regions returned by tsrb_free_regions()
+ *
+ * @pre         @p n is not larger than the free space of the ringbuffer
+ *
+ * @param[in]   rb      Ringbuffer to operate on
+ * @param[in]   n       nr of bytes written
+ */
+void tsrb_commit(tsrb_t *rb, size_t n);
+
 #ifdef __cplusplus
 }
 #endif
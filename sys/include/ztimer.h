@@ -151,14 +151,15 @@
  * - constant get_min() (important for timer triggering)
  * - O(n) insertion / removal of timer objects
  *
- * By making the list doubly-linked, removal of timer objects could be easily
- * made a constant operation, at the price of another pointer per timer object
- * (for "previous" element).
+ * For clocks with many active timers, the list can be augmented with a
+ * hashed timing wheel (see @ref sys_ztimer_wheel), which keeps timers that
+ * are not due soon out of the list and makes their insertion and removal a
+ * constant operation, at the price of another pointer per timer object.
  *
- * If deemed necessary, the linked list can be exchanged our augmented with
- * another data structure providing better algorithmic guarantees. It remains
- * to be shown whether the increased complexity would lead to better
- * performance for any reasonable amount of active timers.
+ * Timers that don't need to expire at an exact tick can be set using
+ * ztimer_set_with_slack(). If the `ztimer_slack` module is used, such a timer
+ * is moved onto an already scheduled expiration within its slack window, so
+ * that both are handled by the same interrupt.
  *
  *
  * ## Clock extension
@@ -289,6 +290,13 @@ typedef struct ztimer_base ztimer_base_t;
  */
 typedef struct ztimer_clock ztimer_clock_t;
 
+#if MODULE_ZTIMER_WHEEL || DOXYGEN
+/**
+ * @brief ztimer_wheel_t forward declaration
+ */
+typedef struct ztimer_wheel ztimer_wheel_t;
+#endif
+
 /**
  * @brief Type of callbacks in @ref ztimer_t "timers"
  */
@@ -300,6 +308,10 @@ typedef void (*ztimer_callback_t)(void *arg);
 struct ztimer_base {
     ztimer_base_t *next;        /**< next timer in list */
     uint32_t offset;            /**< offset from last timer in list */
+#if MODULE_ZTIMER_WHEEL || DOXYGEN
+    ztimer_base_t *prev;        /**< previous timer in timing wheel slot,
+                                     only valid while in a timing wheel */
+#endif
 };
 
 /**
@@ -386,6 +398,15 @@ struct ztimer_clock {
     uint32_t lower_last;            /**< timer value at last now() call     */
     ztimer_now_t checkpoint;        /**< cumulated time at last now() call  */
 #endif
+#if MODULE_ZTIMER_SLACK || DOXYGEN
+    uint32_t coalesced;             /**< number of timers that were merged
+                                         into an already scheduled expiration,
+                                         i.e., interrupts saved             */
+#endif
+#if MODULE_ZTIMER_WHEEL || DOXYGEN
+    ztimer_wheel_t *wheel;          /**< timing wheel for far away timers,
+                                         see @ref sys_ztimer_wheel          */
+#endif
 #if MODULE_PM_LAYERED && !MODULE_ZTIMER_ONDEMAND || DOXYGEN
     uint8_t block_pm_mode;          /**< min. pm mode to block for the clock to run
                                          don't use in combination with ztimer_ondemand! */
@@ -460,6 +481,35 @@ static inline bool ztimer_release(ztimer_clock_t *clock)
  */
 uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val);
 
+/**
+ * @brief   Set a timer on a clock, allowing it to expire late
+ *
+ * Like @ref ztimer_set(), but @p timer may fire up to @p slack ticks after
+ * @p val. If the `ztimer_slack` module is used and another timer is already
+ * scheduled to expire within [@p val, @p val + @p slack], @p timer is set to
+ * expire together with that timer, saving an interrupt.
+ * Without `ztimer_slack`, this is equivalent to @ref ztimer_set().
+ *
+ * @param[in]   clock       ztimer clock to operate on
+ * @param[in]   timer       timer entry to set
+ * @param[in]   val         timer target (relative ticks from now)
+ * @param[in]   slack       ticks @p timer may expire after @p val
+ *
+ * @return The value of @ref ztimer_now() that @p timer was set against
+ */
+#if MODULE_ZTIMER_SLACK || DOXYGEN
+uint32_t ztimer_set_with_slack(ztimer_clock_t *clock, ztimer_t *timer,
+                               uint32_t val, uint32_t slack);
+#else
+static inline uint32_t ztimer_set_with_slack(ztimer_clock_t *clock,
+                                             ztimer_t *timer, uint32_t val,
+                                             uint32_t slack)
+{
+    (void)slack;
+    return ztimer_set(clock, timer, val);
+}
+#endif
+
 /**
  * @brief   Check if a timer is currently active
  *
@@ -471,6 +521,21 @@ uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val);
  */
 unsigned ztimer_is_set(const ztimer_clock_t *clock, const ztimer_t *timer);
 
+/**
+ * @brief   Get the time until the next timer on a clock is due
+ *
+ * This is meant for power management, e.g. to decide whether a low power mode
+ * is worth its wake-up latency. The clock may have to be serviced a bit
+ * earlier than the timer is due, e.g. to move timers out of a
+ * @ref sys_ztimer_wheel "timing wheel"; the time until then is returned.
+ *
+ * @param[in]   clock       ztimer clock to operate on
+ *
+ * @return  ticks until the next timer on @p clock is due, 0 if overdue
+ * @return  UINT32_MAX if no timer is set on @p clock
+ */
+uint32_t ztimer_until_next(ztimer_clock_t *clock);
+
 /**
  * @brief   Remove a timer from a clock
  *
@@ -0,0 +1,184 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#pragma once
+
+/**
+ * @defgroup    sys_ztimer_wheel    ztimer hashed timing wheel
+ * @ingroup     sys_ztimer
+ * @brief       Constant time ztimer_set() / ztimer_remove() for clocks with
+ *              many timers
+ *
+ * By default, a ztimer clock keeps all timers in a sorted, singly linked list,
+ * making ztimer_set() and ztimer_remove() O(n) in the number of active timers.
+ * When a timing wheel is attached to a clock using ztimer_wheel_init(), only
+ * timers expiring before the end of the current wheel slot are kept in that
+ * list. All other timers are put into one of @ref CONFIG_ZTIMER_WHEEL_SLOTS
+ * unsorted, doubly linked slots by their absolute target time, which makes
+ * setting and removing them O(1).
+ *
+ * Whenever the clock reaches the start of an occupied slot, the timers of that
+ * slot that are due within it are moved into the sorted list. Timers further
+ * away than one revolution of the wheel (@ref CONFIG_ZTIMER_WHEEL_SLOTS
+ * slots of 2^`shift` ticks each) stay in their slot until their revolution
+ * comes. The underlying clock is only armed for occupied slots, so empty
+ * slots do not cause any interrupts.
+ *
+ * The semantics of the ztimer API are not changed by attaching a wheel. Each
+ * timer grows by one pointer when this module is used.
+ *
+ * Example:
+ *
+ * ```
+ * #include "ztimer/wheel.h"
+ *
+ * static ztimer_wheel_t wheel;
+ *
+ * int main(void)
+ * {
+ *     // slots of 16ms each, i.e. one revolution every 512ms
+ *     ztimer_wheel_init(ZTIMER_MSEC, &wheel, 4);
+ *     ...
+ * }
+ * ```
+ *
+ * @{
+ *
+ * @file
+ * @brief       ztimer hashed timing wheel API
+ *
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ztimer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Number of slots of a timing wheel
+ *
+ * Must be a power of two.
+ */
+#ifndef CONFIG_ZTIMER_WHEEL_SLOTS
+#define CONFIG_ZTIMER_WHEEL_SLOTS   (32U)
+#endif
+
+/**
+ * @brief   Number of bits per word of the slot occupancy bitmap
+ */
+#define ZTIMER_WHEEL_MAP_BITS       (sizeof(unsigned) * 8)
+
+/**
+ * @brief   ztimer timing wheel
+ */
+struct ztimer_wheel {
+    ztimer_base_t slots[CONFIG_ZTIMER_WHEEL_SLOTS]; /**< slot list heads */
+    /**
+     * @brief   bitmap of occupied slots
+     */
+    unsigned map[(CONFIG_ZTIMER_WHEEL_SLOTS + ZTIMER_WHEEL_MAP_BITS - 1) /
+                 ZTIMER_WHEEL_MAP_BITS];
+    uint32_t horizon;       /**< start of the first slot still in the wheel */
+    unsigned count;         /**< number of timers in the wheel */
+    uint8_t shift;          /**< log2 of the slot width in ticks */
+};
+
+/**
+ * @brief   Attach a timing wheel to a clock
+ *
+ * @pre     No timer is set on @p clock
+ * @pre     `CONFIG_ZTIMER_WHEEL_SLOTS << shift` does not exceed 2^31
+ *
+ * @param[in]   clock   ztimer clock to operate on
+ * @param[out]  wheel   timing wheel to attach, must stay valid as long as it
+ *                      is attached to @p clock
+ * @param[in]   shift   log2 of the width of a slot in ticks of @p clock.
+ *                      Should be chosen so that most timers on the clock
+ *                      expire later than one slot width.
+ */
+void ztimer_wheel_init(ztimer_clock_t *clock, ztimer_wheel_t *wheel,
+                       uint8_t shift);
+
+/**
+ * @name    Internal functions used by the ztimer core
+ *
+ * All of these must be called with interrupts disabled.
+ * @{
+ */
+/**
+ * @brief   Add a timer to the wheel if it expires after the current slot
+ *
+ * @param[in]   wheel   timing wheel
+ * @param[in]   entry   timer to add, `entry->offset` holds the timeout
+ *                      relative to @p now
+ * @param[in]   now     current time of the clock
+ *
+ * @retval  true    @p entry was added to the wheel
+ * @retval  false   @p entry expires too soon and needs to be put into the
+ *                  clock's list
+ */
+bool ztimer_wheel_add(ztimer_wheel_t *wheel, ztimer_base_t *entry,
+                      uint32_t now);
+
+/**
+ * @brief   Remove a timer from the wheel
+ *
+ * @param[in]   wheel   timing wheel
+ * @param[in]   entry   timer to remove, must be in @p wheel
+ */
+void ztimer_wheel_del(ztimer_wheel_t *wheel, ztimer_base_t *entry);
+
+/**
+ * @brief   Check if a timer is in the wheel
+ *
+ * Only walks the slot @p entry would be hashed to, so this is safe to call
+ * for timers that were never set and hold arbitrary memory contents.
+ *
+ * @param[in]   wheel   timing wheel
+ * @param[in]   entry   timer to look for
+ *
+ * @retval  true    @p entry is in @p wheel
+ * @retval  false   @p entry is not in @p wheel
+ */
+bool ztimer_wheel_contains(const ztimer_wheel_t *wheel,
+                           const ztimer_base_t *entry);
+
+/**
+ * @brief   Get the time at which the wheel needs to be advanced next
+ *
+ * @param[in]   wheel   timing wheel
+ * @param[out]  start   absolute start time of the next occupied slot
+ *
+ * @retval  true    @p start was written
+ * @retval  false   the wheel is empty
+ */
+bool ztimer_wheel_next(const ztimer_wheel_t *wheel, uint32_t *start);
+
+/**
+ * @brief   Take all timers that are due before the end of the current slot
+ *          out of the wheel
+ *
+ * @param[in]   wheel   timing wheel
+ * @param[in]   now     current time of the clock
+ *
+ * @return  list of timers linked by ztimer_base_t::next, `offset` holds their
+ *          absolute target time
+ * @retval  NULL    no timer is due
+ */
+ztimer_base_t *ztimer_wheel_advance(ztimer_wheel_t *wheel, uint32_t now);
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
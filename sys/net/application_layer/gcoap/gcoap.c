@@ -55,6 +55,16 @@
 /* End of the range to pick a random timeout */
 #define TIMEOUT_RANGE_END ((uint32_t)CONFIG_COAP_ACK_TIMEOUT_MS * CONFIG_COAP_RANDOM_FACTOR_1000 / 1000)
 
+/* Parse received UDP requests in the buffer of the stack if it provides them
+ * in one piece. Responses are still copied to _listen_buf, as response
+ * handlers (and the forward proxy) may reuse their buffer, e.g. to build the
+ * request for the next Block2 block. */
+#if defined(SOCK_HAS_RECV_BUF_SINGLE)
+#define GCOAP_RECV_IN_PLACE (1)
+#else
+#define GCOAP_RECV_IN_PLACE (0)
+#endif
+
 /* Internal functions */
 static void *_event_loop(void *arg);
 static void _on_sock_udp_evt(sock_udp_t *sock, sock_async_flags_t type, void *arg);
@@ -322,6 +332,17 @@ static void _dtls_free_up_session(void *arg) {
 }
 #endif /* MODULE_GCOAP_DTLS */
 
+#if GCOAP_RECV_IN_PLACE
+/* Checks for a request or empty message, only these are parsed in place */
+static bool _is_req_or_empty(const uint8_t *buf, size_t len)
+{
+    return (len >= sizeof(coap_hdr_t)) &&
+           ((((const coap_hdr_t *)buf)->code >> 5) == COAP_CLASS_REQ);
+}
+#else
+#define _is_req_or_empty(buf, len)  (false)
+#endif
+
 /* Handles UDP socket events from the event queue. */
 static void _on_sock_udp_evt(sock_udp_t *sock, sock_async_flags_t type, void *arg)
 {
@@ -331,22 +352,19 @@ static void _on_sock_udp_evt(sock_udp_t *sock, sock_async_flags_t type, void *ar
     if (type & SOCK_ASYNC_MSG_RECV) {
         void *stackbuf;
         void *buf_ctx = NULL;
+        uint8_t *pdu_buf = _listen_buf;
         bool truncated = false;
         size_t cursor = 0;
         sock_udp_aux_rx_t aux_in = {
             .flags = SOCK_AUX_GET_LOCAL,
         };
 
-        /* The zero-copy _buf API is not used to its full potential here -- we
-         * still copy out data in what is a manual version of sock_udp_recv,
-         * but this gives the direly needed overflow information.
-         *
-         * A version that actually doesn't copy would vastly change the way
-         * gcoap passes the buffer to be read from and written into to the
-         * handler. Also, given that neither nanocoap nor the handler expects
-         * to gather scattered data, it'd need to rely on the data coming in a
-         * single slice (but that may be a realistic assumption).
-         */
+        /* Requests are read from the buffer of the stack if it provides them
+         * in one piece, as neither nanocoap nor the handlers expect to gather
+         * scattered data. Responses to them are always written into
+         * _listen_buf. Otherwise, the data is copied out in what is a manual
+         * version of sock_udp_recv, but this gives the direly needed overflow
+         * information. */
         while (true) {
             ssize_t res = sock_udp_recv_buf_aux(sock, &stackbuf, &buf_ctx, 0, &remote, &aux_in);
             if (res < 0) {
@@ -356,6 +374,14 @@ static void _on_sock_udp_evt(sock_udp_t *sock, sock_async_flags_t type, void *ar
             if (res == 0) {
                 break;
             }
+            if (GCOAP_RECV_IN_PLACE && (cursor == 0) &&
+                ((size_t)res <= sizeof(_listen_buf)) &&
+                _is_req_or_empty(stackbuf, res)) {
+                /* larger messages are still truncated into _listen_buf */
+                pdu_buf = stackbuf;
+                cursor = res;
+                break;
+            }
             if (cursor + res > sizeof(_listen_buf)) {
                 res = sizeof(_listen_buf) - cursor;
                 truncated = true;
@@ -384,7 +410,9 @@ static void _on_sock_udp_evt(sock_udp_t *sock, sock_async_flags_t type, void *ar
             .socket.udp = sock,
          };
 
-        _process_coap_pdu(&socket, &remote, aux_out_ptr, _listen_buf, cursor, truncated);
+        _process_coap_pdu(&socket, &remote, aux_out_ptr, pdu_buf, cursor, truncated);
+        /* release the message if it was read in place */
+        sock_udp_recv_buf_release(sock, &buf_ctx);
     }
 }
 
@@ -584,16 +612,19 @@ static void _process_coap_pdu(gcoap_socket_t *sock, sock_udp_ep_t *remote, sock_
     }
 
     if (messagelayer_emptyresponse_type != NO_IMMEDIATE_REPLY) {
-        coap_hdr_set_type(pdu.hdr, (uint8_t)messagelayer_emptyresponse_type);
-        coap_pkt_set_code(&pdu, COAP_CODE_EMPTY);
+        /* buf may belong to the stack, so the reply is built in a copy */
+        coap_hdr_t empty = *(coap_hdr_t *)buf;
+
+        coap_hdr_set_type(&empty, (uint8_t)messagelayer_emptyresponse_type);
+        coap_hdr_set_code(&empty, COAP_CODE_EMPTY);
         /* Set the token length to 0, preserving the CoAP version as it was and
          * the empty message type that was just set.
          *
          * FIXME: Introduce an internal function to set or truncate the token
          * */
-        pdu.hdr->ver_t_tkl &= 0xf0;
+        empty.ver_t_tkl &= 0xf0;
 
-        ssize_t bytes = _tl_send(sock, buf, sizeof(coap_hdr_t), remote, aux);
+        ssize_t bytes = _tl_send(sock, &empty, sizeof(empty), remote, aux);
         if (bytes <= 0) {
             DEBUG("gcoap: empty response failed: %" PRIdSIZE "\n", bytes);
         }
@@ -1926,6 +1957,8 @@ int gcoap_resp_init(coap_pkt_t *pdu, uint8_t *buf, size_t len, unsigned code)
         return -1;
     }
 
+    /* the request may have been parsed from a different buffer */
+    pdu->hdr         = (coap_hdr_t *)buf;
     pdu->options_len = 0;
     pdu->payload     = buf + header_len;
     pdu->payload_len = len - header_len;
@@ -13,8 +13,13 @@
  */
 
 #include <inttypes.h>
+#include <stdbool.h>
 #include <stdio.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 
+#include "byteorder.h"
 #include "modules.h"
 #include "od.h"
 #include "net/inet_csum.h"
@@ -22,6 +27,95 @@
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+/* words that may alias the byte buffer they are read from */
+typedef uint16_t __attribute__((may_alias)) _half_t;
+typedef uint32_t __attribute__((may_alias)) _word_t;
+
+static inline uint16_t _fold(uint64_t sum)
+{
+    while (sum >> 16) {
+        sum = (sum & 0xffff) + (sum >> 16);
+    }
+    return sum;
+}
+
+#ifdef __SSE2__
+/* sums 32 byte blocks as 16 bit words in host byte order into four 32 bit
+ * lanes, which can not overflow for len <= UINT16_MAX */
+static uint64_t _sum_blocks(const uint8_t **buf, size_t *len)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i acc = zero;
+    uint32_t lanes[4];
+
+    for (; *len >= 32; *buf += 32, *len -= 32) {
+        __m128i a = _mm_loadu_si128((const __m128i *)*buf);
+        __m128i b = _mm_loadu_si128((const __m128i *)(*buf + 16));
+
+        acc = _mm_add_epi32(acc, _mm_unpacklo_epi16(a, zero));
+        acc = _mm_add_epi32(acc, _mm_unpackhi_epi16(a, zero));
+        acc = _mm_add_epi32(acc, _mm_unpacklo_epi16(b, zero));
+        acc = _mm_add_epi32(acc, _mm_unpackhi_epi16(b, zero));
+    }
+    _mm_storeu_si128((__m128i *)lanes, acc);
+    return (uint64_t)lanes[0] + lanes[1] + lanes[2] + lanes[3];
+}
+#else
+/* sums 16 byte blocks as 32 bit words, which can not overflow the 64 bit
+ * accumulator for len <= UINT16_MAX */
+static uint64_t _sum_blocks(const uint8_t **buf, size_t *len)
+{
+    uint64_t sum = 0;
+
+    for (; *len >= 16; *buf += 16, *len -= 16) {
+        const _word_t *w = (const _word_t *)(uintptr_t)*buf;
+
+        sum += w[0];
+        sum += w[1];
+        sum += w[2];
+        sum += w[3];
+    }
+    return sum;
+}
+#endif
+
+/* sum of buf as big endian 16 bit words, the last byte of an odd len padded
+ * with zero */
+static uint16_t _sum(const uint8_t *buf, size_t len)
+{
+    uint64_t sum = 0;
+    /* starting at an odd address, every byte is summed in the wrong half of
+     * its word. The one's complement sum is invariant to byte swapping, so
+     * this is fixed by swapping the result */
+    bool odd = (uintptr_t)buf & 1;
+
+    if (odd && len) {
+        sum = htons(*buf);
+        buf++;
+        len--;
+    }
+    if (((uintptr_t)buf & 2) && (len >= 2)) {
+        sum += *(const _half_t *)(uintptr_t)buf;
+        buf += 2;
+        len -= 2;
+    }
+    sum += _sum_blocks(&buf, &len);
+    for (; len >= 4; buf += 4, len -= 4) {
+        sum += *(const _word_t *)(uintptr_t)buf;
+    }
+    if (len >= 2) {
+        sum += *(const _half_t *)(uintptr_t)buf;
+        buf += 2;
+        len -= 2;
+    }
+    if (len) {
+        sum += ntohs(*buf << 8);
+    }
+
+    uint16_t res = htons(_fold(sum));
+    return odd ? byteorder_swaps(res) : res;
+}
+
 uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t accum_len)
 {
     uint32_t csum = sum;
@@ -44,16 +138,9 @@ uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t
         csum += *buf;         /* add first byte as bottom half of 16-byte word */
         buf++;
         len--;
-        accum_len++;
-    }
-
-    for (unsigned i = 0; i < (len >> 1); buf += 2, i++) {
-        csum += (uint16_t)(*buf << 8) + *(buf + 1); /* group bytes by 16-byte words */
-                                                    /* and add them */
     }
 
-    if ((accum_len + len) & 1)          /* if accumulated length is odd */
-        csum += (uint16_t)(*buf << 8);  /* add last byte as top half of 16-byte word */
+    csum += _sum(buf, len);
 
     while (csum >> 16) {
         uint16_t carry = csum >> 16;
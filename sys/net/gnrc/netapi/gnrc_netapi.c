@@ -20,9 +20,13 @@
 
 #include <assert.h>
 #include <errno.h>
+#include <stdbool.h>
 
+#include "irq.h"
 #include "mbox.h"
 #include "msg.h"
+#include "mutex.h"
+#include "thread.h"
 #include "net/gnrc/netreg.h"
 #include "net/gnrc/pktbuf.h"
 #include "net/gnrc/netapi.h"
@@ -82,62 +86,136 @@ static inline int _snd_rcv_mbox(mbox_t *mbox, uint16_t type, gnrc_pktsnip_t *pkt
 }
 #endif
 
-int gnrc_netapi_dispatch(gnrc_nettype_t type, uint32_t demux_ctx,
-                         uint16_t cmd, gnrc_pktsnip_t *pkt)
+#ifdef MODULE_GNRC_NETAPI_DIRECT
+static inline int _snd_rcv_direct(gnrc_netreg_entry_direct_t *direct,
+                                  uint16_t type, gnrc_pktsnip_t *pkt)
 {
-    gnrc_netreg_acquire_shared();
+    if ((type == GNRC_NETAPI_MSG_TYPE_RCV) && !irq_is_in()) {
+        /* run to completion only if the layer's thread waits for a message:
+         * then it has no packets queued that would be overtaken, and it is
+         * not handling one, neither already holding the lock nor between
+         * receiving a message and taking the lock. A layer dispatching to
+         * itself is not waiting either. Once the lock is taken, the thread
+         * can not start handling a message before the packet is done. */
+        unsigned state = irq_disable();
+        bool direct_call = (thread_get_status(thread_get(direct->pid)) ==
+                            STATUS_RECEIVE_BLOCKED) &&
+                           mutex_trylock(&direct->lock);
 
-    int numof = gnrc_netreg_num(type, demux_ctx);
+        irq_restore(state);
+        if (direct_call) {
+            direct->cb(type, pkt, direct->ctx);
+            mutex_unlock(&direct->lock);
+            return 1;
+        }
+    }
+    return _gnrc_netapi_send_recv(direct->pid, pkt, type);
+}
+#endif
 
-    if (numof != 0) {
-        gnrc_netreg_entry_t *sendto = gnrc_netreg_lookup(type, demux_ctx);
-
-        /* the packet is replicated over all interfaces that is's being sent on */
-        gnrc_pktbuf_hold(pkt, numof - 1);
-
-        while (sendto) {
-#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS)
-            uint32_t status = 0;
-            switch (sendto->type) {
-                case GNRC_NETREG_TYPE_DEFAULT:
-                    if (_gnrc_netapi_send_recv(sendto->target.pid, pkt,
-                                               cmd) < 1) {
-                        /* unable to dispatch packet */
-                        status = EIO;
-                    }
-                    break;
+/* registry must be acquired */
+static void _dispatch(gnrc_netreg_entry_t *sendto, int numof, uint16_t cmd,
+                      gnrc_pktsnip_t *pkt)
+{
+    /* the packet is replicated over all interfaces that is's being sent on */
+    gnrc_pktbuf_hold(pkt, numof - 1);
+
+    while (sendto) {
+#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS) || \
+    defined(MODULE_GNRC_NETAPI_DIRECT)
+        uint32_t status = 0;
+        switch (sendto->type) {
+            case GNRC_NETREG_TYPE_DEFAULT:
+                if (_gnrc_netapi_send_recv(sendto->target.pid, pkt,
+                                           cmd) < 1) {
+                    /* unable to dispatch packet */
+                    status = EIO;
+                }
+                break;
 #ifdef MODULE_GNRC_NETAPI_MBOX
-                case GNRC_NETREG_TYPE_MBOX:
-                    if (_snd_rcv_mbox(sendto->target.mbox, cmd, pkt) < 1) {
-                        /* unable to dispatch packet */
-                        status = EIO;
-                    }
-                    break;
+            case GNRC_NETREG_TYPE_MBOX:
+                if (_snd_rcv_mbox(sendto->target.mbox, cmd, pkt) < 1) {
+                    /* unable to dispatch packet */
+                    status = EIO;
+                }
+                break;
 #endif
 #ifdef MODULE_GNRC_NETAPI_CALLBACKS
-                case GNRC_NETREG_TYPE_CB:
-                    sendto->target.cbd->cb(cmd, pkt, sendto->target.cbd->ctx);
-                    break;
+            case GNRC_NETREG_TYPE_CB:
+                sendto->target.cbd->cb(cmd, pkt, sendto->target.cbd->ctx);
+                break;
 #endif
-                default:
-                    /* unknown dispatch type */
-                    status = ECANCELED;
-                    break;
-            }
-            if (status != 0) {
-                gnrc_pktbuf_release_error(pkt, status);
-            }
-#else
-            if (_gnrc_netapi_send_recv(sendto->target.pid, pkt, cmd) < 1) {
-                /* unable to dispatch packet */
-                gnrc_pktbuf_release_error(pkt, EIO);
-            }
+#ifdef MODULE_GNRC_NETAPI_DIRECT
+            case GNRC_NETREG_TYPE_DIRECT:
+                if (_snd_rcv_direct(sendto->target.direct, cmd, pkt) < 1) {
+                    /* unable to dispatch packet */
+                    status = EIO;
+                }
+                break;
 #endif
-            sendto = gnrc_netreg_getnext(sendto);
+            default:
+                /* unknown dispatch type */
+                status = ECANCELED;
+                break;
+        }
+        if (status != 0) {
+            gnrc_pktbuf_release_error(pkt, status);
+        }
+#else
+        if (_gnrc_netapi_send_recv(sendto->target.pid, pkt, cmd) < 1) {
+            /* unable to dispatch packet */
+            gnrc_pktbuf_release_error(pkt, EIO);
         }
+#endif
+        sendto = gnrc_netreg_getnext(sendto);
+    }
+}
+
+int gnrc_netapi_dispatch(gnrc_nettype_t type, uint32_t demux_ctx,
+                         uint16_t cmd, gnrc_pktsnip_t *pkt)
+{
+    gnrc_netreg_acquire_shared();
+
+    int numof = gnrc_netreg_num(type, demux_ctx);
+
+    if (numof != 0) {
+        _dispatch(gnrc_netreg_lookup(type, demux_ctx), numof, cmd, pkt);
     }
 
     gnrc_netreg_release_shared();
 
     return numof;
 }
+
+unsigned gnrc_netapi_dispatch_receive_batch(uint32_t demux_ctx,
+                                            gnrc_pktsnip_t *const *pkts,
+                                            unsigned numof)
+{
+    gnrc_netreg_entry_t *sendto = NULL;
+    gnrc_nettype_t type = GNRC_NETTYPE_UNDEF;
+    int subscribers = -1;
+    unsigned res = 0;
+
+    gnrc_netreg_acquire_shared();
+
+    for (unsigned i = 0; i < numof; i++) {
+        gnrc_pktsnip_t *pkt = pkts[i];
+
+        if ((subscribers < 0) || (pkt->type != type)) {
+            type = pkt->type;
+            subscribers = gnrc_netreg_num(type, demux_ctx);
+            sendto = gnrc_netreg_lookup(type, demux_ctx);
+        }
+        if (subscribers == 0) {
+            DEBUG("gnrc_netapi: no subscribers for packet of type %i\n", type);
+            gnrc_pktbuf_release(pkt);
+            continue;
+        }
+        _dispatch(sendto, subscribers, GNRC_NETAPI_MSG_TYPE_RCV, pkt);
+        res++;
+    }
+
+    gnrc_netreg_release_shared();
+
+    return res;
+}
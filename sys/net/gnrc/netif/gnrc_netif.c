@@ -2064,6 +2064,48 @@ static void *_gnrc_netif_thread(void *args)
     return NULL;
 }
 
+#if CONFIG_GNRC_NETIF_RX_BATCH_SIZE > 1
+static bool _rx_pending(gnrc_netif_t *netif)
+{
+    netdev_t *dev = netif->dev;
+    netopt_enable_t pending = NETOPT_DISABLE;
+
+    /* drivers that can't tell return -ENOTSUP */
+    return (dev->driver->get(dev, NETOPT_RX_PENDING, &pending,
+                             sizeof(pending)) == sizeof(pending)) &&
+           (pending == NETOPT_ENABLE);
+}
+
+static void _recv(gnrc_netif_t *netif)
+{
+    gnrc_pktsnip_t *pkts[CONFIG_GNRC_NETIF_RX_BATCH_SIZE];
+    unsigned numof = 0;
+    unsigned fetched = 0;
+    bool pending;
+
+    /* the first frame was announced by the event itself */
+    do {
+        gnrc_pktsnip_t *pkt = netif->ops->recv(netif);
+
+        if (pkt) {
+            _process_receive_stats(netif, pkt);
+            pkts[numof++] = pkt;
+        }
+        pending = _rx_pending(netif);
+    } while (pending && (++fetched < CONFIG_GNRC_NETIF_RX_BATCH_SIZE));
+    if (pending) {
+        /* the device leaves the remaining frames to us, fetch them after the
+         * other events */
+        event_post(&netif->evq[GNRC_NETIF_EVQ_INDEX_PRIO_LOW],
+                   &netif->event_isr);
+    }
+    /* send packet previously queued within netif due to the lower
+     * layer being busy.
+     * Further packets will be sent on later TX_COMPLETE */
+    _send_queued_pkt(netif);
+    gnrc_netapi_dispatch_receive_batch(GNRC_NETREG_DEMUX_CTX_ALL, pkts, numof);
+}
+#else   /* CONFIG_GNRC_NETIF_RX_BATCH_SIZE > 1 */
 static void _pass_on_packet(gnrc_pktsnip_t *pkt)
 {
     /* throw away packet if no one is interested */
@@ -2075,6 +2117,21 @@ static void _pass_on_packet(gnrc_pktsnip_t *pkt)
     }
 }
 
+static void _recv(gnrc_netif_t *netif)
+{
+    gnrc_pktsnip_t *pkt = netif->ops->recv(netif);
+
+    /* send packet previously queued within netif due to the lower
+     * layer being busy.
+     * Further packets will be sent on later TX_COMPLETE */
+    _send_queued_pkt(netif);
+    if (pkt) {
+        _process_receive_stats(netif, pkt);
+        _pass_on_packet(pkt);
+    }
+}
+#endif  /* CONFIG_GNRC_NETIF_RX_BATCH_SIZE > 1 */
+
 static void _event_cb(netdev_t *dev, netdev_event_t event)
 {
     gnrc_netif_t *netif = (gnrc_netif_t *)dev->context;
@@ -2091,7 +2148,6 @@ static void _event_cb(netdev_t *dev, netdev_event_t event)
 #endif
     else {
         DEBUG("gnrc_netif: event triggered -> %i\n", event);
-        gnrc_pktsnip_t *pkt = NULL;
         switch (event) {
             case NETDEV_EVENT_LINK_UP:
                 if (IS_USED(MODULE_GNRC_IPV6)) {
@@ -2108,15 +2164,7 @@ static void _event_cb(netdev_t *dev, netdev_event_t event)
                 }
                 break;
             case NETDEV_EVENT_RX_COMPLETE:
-                pkt = netif->ops->recv(netif);
-                /* send packet previously queued within netif due to the lower
-                 * layer being busy.
-                 * Further packets will be sent on later TX_COMPLETE */
-                _send_queued_pkt(netif);
-                if (pkt) {
-                    _process_receive_stats(netif, pkt);
-                    _pass_on_packet(pkt);
-                }
+                _recv(netif);
                 break;
 #if IS_USED(MODULE_NETDEV_LEGACY_API)
 #  if IS_USED(MODULE_NETSTATS_L2) || IS_USED(MODULE_GNRC_NETIF_PKTQ)
@@ -14,10 +14,11 @@
 
 #include <errno.h>
 #include <string.h>
-#include <limits.h>
 
 #include "assert.h"
+#include "hashes.h"
 #include "log.h"
+#include "rwlock.h"
 #include "utlist.h"
 #include "net/gnrc/netreg.h"
 #include "net/gnrc/nettype.h"
@@ -31,108 +32,61 @@
 
 #define _INVALID_TYPE(type) (((type) < GNRC_NETTYPE_UNDEF) || ((type) >= GNRC_NETTYPE_NUMOF))
 
-/* The registry as lookup table by gnrc_nettype_t */
-static gnrc_netreg_entry_t *netreg[GNRC_NETTYPE_NUMOF];
+/* The registry as lookup table by gnrc_nettype_t and hash of the demux
+ * context. Entries with the same demux context always share a list, so
+ * gnrc_netreg_getnext() only needs to walk that list */
+static gnrc_netreg_entry_t *netreg[GNRC_NETTYPE_NUMOF][CONFIG_GNRC_NETREG_BUCKETS];
 
-/** Held while accessing _lock_counter, and also while the exclusive lock is held */
-static mutex_t _lock_for_counter = MUTEX_INIT;
-/** Number of shared locks on netreg. Saturating arithmetic is used; if this
- * reaches UINT_MAX, the lock will never be freed again. This is likely
- * accurate, given that it will only happen when the lock was leaked, so it
- * can't be freed any more anyway.
- *
- * This can be accessed only when _lock_for_counter is held; an alternative
- * implementation with atomics would likely be possible, but for the case of "I
- * can't do that right now" it would still need a mutex. But that's
- * optimization that could be done without changing the public API.
- * */
-static unsigned int _lock_counter = 0;
-/** Held while the netreg lists are being read. This is what the exclusive
- * users block on if they can't grab the exclusive lock right away.
- *
- * This is largely used as a boolean flag (is locked / is unlocked) that is
- * modified while the _lock_for_counter is held, and will not block because it
- * is synchronized to _lock_counter being 0. It is only ever accessed outside
- * _lock_for_counter when waiting for the counter to reach 0, and even then is
- * released immediately to avoid deadlocks. (Instead, the exclusive acquisition
- * tries to acquire the _lock_for_counter, and if that fails it queues up again
- * after the reader that just snatched it).
- * */
-static mutex_t _lock_wait_exclusive = MUTEX_INIT;
+/** Shared lock for lookups, exclusive lock for (de)registration */
+static rwlock_t _lock = RWLOCK_INIT;
 
 void gnrc_netreg_init(void)
 {
     /* set all pointers in registry to NULL */
-    memset(netreg, 0, GNRC_NETTYPE_NUMOF * sizeof(gnrc_netreg_entry_t *));
+    memset(netreg, 0, sizeof(netreg));
 }
 
-void gnrc_netreg_acquire_shared(void) {
-    mutex_lock(&_lock_for_counter);
-    if (_lock_counter == 0) {
-        /* At most, this blocks for the very short time until
-         * _gnrc_netreg_acquire_exclusive returns it immediately */
-        mutex_lock(&_lock_wait_exclusive);
-    }
-    if (_lock_counter != UINT_MAX) {
-        _lock_counter += 1;
+static gnrc_netreg_entry_t **_bucket(gnrc_nettype_t type, uint32_t demux_ctx)
+{
+    if (CONFIG_GNRC_NETREG_BUCKETS == 1) {
+        return &netreg[type][0];
     }
-    mutex_unlock(&_lock_for_counter);
+    /* mix all bits, GNRC_NETREG_DEMUX_CTX_ALL only differs in the upper ones */
+    return &netreg[type][mix32_hash(demux_ctx) % CONFIG_GNRC_NETREG_BUCKETS];
 }
 
-void gnrc_netreg_release_shared(void) {
-    mutex_lock(&_lock_for_counter);
-
-    assert(_lock_counter != 0); /* Release without acquire */
+void gnrc_netreg_acquire_shared(void) {
+#ifdef MODULE_GNRC_NETAPI_DIRECT
+    /* direct handlers dispatch again while the lock is held */
+    rwlock_read_lock_recursive(&_lock);
+#else
+    rwlock_read_lock(&_lock);
+#endif
+}
 
-    if (_lock_counter != UINT_MAX) {
-        _lock_counter -= 1;
-    }
-    if (_lock_counter == 0) {
-        mutex_unlock(&_lock_wait_exclusive);
-    }
-    mutex_unlock(&_lock_for_counter);
+void gnrc_netreg_release_shared(void) {
+    rwlock_read_unlock(&_lock);
 }
 
 /** Assert that there is a shared lock on gnrc_netreg -- this should help weed
  * out callers to @ref gnrc_netreg_lookup that don't properly lock. */
 static void _gnrc_netreg_assert_shared(void) {
-#if DEVELHELP
-    /* Even if we just peek: It's not an atomic, so it needs synchronization */
-    mutex_lock(&_lock_for_counter);
-    assert(_lock_counter != 0);
-    mutex_unlock(&_lock_for_counter);
-#endif
+    assert(rwlock_is_read_locked(&_lock));
 }
 
 static void _gnrc_netreg_acquire_exclusive(void) {
-    while (true) {
-        mutex_lock(&_lock_for_counter);
-        if (_lock_counter == 0) {
-            /* At most, this blocks for the very short time until
-             * another caller of _gnrc_netreg_acquire_exclusive returns it
-             * immediately */
-            mutex_lock(&_lock_wait_exclusive);
-            /* Leaving both locked */
-            return;
-        }
-        mutex_unlock(&_lock_for_counter);
-
-        mutex_lock(&_lock_wait_exclusive);
-        /* ... but maybe someone just started grabbing _lock_for_counter, so we
-         * give them a chance to finish rather than deadlocking them */
-        mutex_unlock(&_lock_wait_exclusive);
-    }
+    rwlock_write_lock(&_lock);
 }
 
 static void _gnrc_netreg_release_exclusive(void) {
-     mutex_unlock(&_lock_wait_exclusive);
-     mutex_unlock(&_lock_for_counter);
+    rwlock_write_unlock(&_lock);
 }
 
 int gnrc_netreg_register(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
 {
 #if DEVELHELP
-# if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS)
+# if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS) || \
+     defined(MODULE_GNRC_NETAPI_DIRECT)
     bool has_msg_q = (entry->type != GNRC_NETREG_TYPE_DEFAULT) ||
                      thread_has_msg_queue(thread_get(entry->target.pid));
 # else
@@ -153,13 +107,15 @@ int gnrc_netreg_register(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
 
     _gnrc_netreg_acquire_exclusive();
 
+    gnrc_netreg_entry_t **bucket = _bucket(type, entry->demux_ctx);
+
     /* don't add the same entry twice */
     gnrc_netreg_entry_t *e;
-    LL_FOREACH(netreg[type], e) {
+    LL_FOREACH(*bucket, e) {
         assert(entry != e);
     }
 
-    LL_PREPEND(netreg[type], entry);
+    LL_PREPEND(*bucket, entry);
     _gnrc_netreg_release_exclusive();
 
     return 0;
@@ -172,7 +128,7 @@ void gnrc_netreg_unregister(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
     }
 
     _gnrc_netreg_acquire_exclusive();
-    LL_DELETE(netreg[type], entry);
+    LL_DELETE(*_bucket(type, entry->demux_ctx), entry);
     /* We can release now already: No new references to this entry can be made
      * any more, and the caller is only allowed to reuse the entry and the mbox
      * target referenced by it after *this* function returned, not when the
@@ -214,7 +170,8 @@ static gnrc_netreg_entry_t *_netreg_lookup(gnrc_netreg_entry_t *from,
     gnrc_netreg_entry_t *res = NULL;
 
     if (from || !_INVALID_TYPE(type)) {
-        gnrc_netreg_entry_t *head = (from) ? from->next : netreg[type];
+        gnrc_netreg_entry_t *head = (from) ? from->next
+                                           : *_bucket(type, demux_ctx);
         LL_SEARCH_SCALAR(head, res, demux_ctx, demux_ctx);
     }
 
@@ -231,13 +188,14 @@ int gnrc_netreg_num(gnrc_nettype_t type, uint32_t demux_ctx)
     int num = 0;
     gnrc_netreg_entry_t *entry = NULL;
 
-    gnrc_netreg_acquire_shared();
+    /* callers may already hold the shared lock to keep the number constant */
+    rwlock_read_lock_recursive(&_lock);
 
     while((entry = _netreg_lookup(entry, type, demux_ctx)) != NULL) {
         num++;
     }
 
-    gnrc_netreg_release_shared();
+    rwlock_read_unlock(&_lock);
 
     return num;
 }
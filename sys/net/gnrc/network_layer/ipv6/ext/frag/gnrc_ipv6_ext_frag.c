@@ -434,8 +434,9 @@ gnrc_pktsnip_t *gnrc_ipv6_ext_frag_reass(gnrc_pktsnip_t *pkt)
         goto error_release;
     }
     rbuf->arrival = xtimer_now_usec();
+    /* not necessarily called by the IPv6 thread, see gnrc_netapi_direct */
     xtimer_set_msg(&_gc_xtimer, CONFIG_GNRC_IPV6_EXT_FRAG_RBUF_TIMEOUT_US, &_gc_msg,
-                   thread_getpid());
+                   gnrc_ipv6_pid);
     nh = fh->nh;
     offset = ipv6_ext_frag_get_offset(fh);
     switch (_overlaps(rbuf, offset, pkt->size)) {
@@ -19,6 +19,7 @@
 
 #include "byteorder.h"
 #include "cpu_conf.h"
+#include "hashes.h"
 #include "sched.h"
 #include "net/gnrc.h"
 #include "net/gnrc/icmpv6.h"
@@ -64,6 +65,27 @@ static fib_entry_t _fib_entries[GNRC_IPV6_FIB_TABLE_SIZE];
 fib_table_t gnrc_ipv6_fib_table;
 #endif
 
+#if CONFIG_GNRC_IPV6_DST_CACHE_NUMOF
+/**
+ * @brief   Entry of the destination cache
+ */
+typedef struct {
+    ipv6_addr_t dst;            /**< destination */
+    gnrc_ipv6_nib_nc_t nce;     /**< next hop to dst */
+    uint32_t nib_version;       /**< version of the NIB nce was taken from */
+    kernel_pid_t iface;         /**< interface dst was looked up for, if any */
+} _dst_cache_entry_t;
+
+/**
+ * @brief   The destination cache
+ *
+ * Only accessed while handling a packet in the IPv6 layer. With
+ * @ref net_gnrc_netapi_direct this also happens on the thread that dispatched
+ * the packet, e.g. a network interface, but always with _direct.lock held.
+ */
+static _dst_cache_entry_t _dst_cache[CONFIG_GNRC_IPV6_DST_CACHE_NUMOF];
+#endif
+
 static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 
 kernel_pid_t gnrc_ipv6_pid = KERNEL_PID_UNDEF;
@@ -81,6 +103,19 @@ static void _send_by_netif_hdr(gnrc_pktsnip_t *pkt);
 /* Main event loop for IPv6 */
 static void *_event_loop(void *args);
 
+#ifdef MODULE_GNRC_NETAPI_DIRECT
+/* handles GNRC_NETAPI_MSG_TYPE_RCV commands in the dispatching thread */
+static void _direct_receive(uint16_t cmd, gnrc_pktsnip_t *pkt, void *ctx)
+{
+    (void)cmd;
+    (void)ctx;
+    _receive(pkt);
+}
+
+static gnrc_netreg_entry_direct_t _direct =
+    GNRC_NETREG_ENTRY_DIRECT_INIT(_direct_receive, NULL);
+#endif
+
 kernel_pid_t gnrc_ipv6_init(void)
 {
     if (gnrc_ipv6_pid == KERNEL_PID_UNDEF) {
@@ -174,8 +209,15 @@ static void _dispatch_next_header(gnrc_pktsnip_t *pkt, unsigned nh,
 static void *_event_loop(void *args)
 {
     msg_t msg, reply;
+#ifdef MODULE_GNRC_NETAPI_DIRECT
+    gnrc_netreg_entry_t me_reg = GNRC_NETREG_ENTRY_INIT_DIRECT(GNRC_NETREG_DEMUX_CTX_ALL,
+                                                               &_direct);
+
+    _direct.pid = thread_getpid();
+#else
     gnrc_netreg_entry_t me_reg = GNRC_NETREG_ENTRY_INIT_PID(GNRC_NETREG_DEMUX_CTX_ALL,
                                                             thread_getpid());
+#endif
 
     (void)args;
     msg_init_queue(_msg_q, GNRC_IPV6_MSG_QUEUE_SIZE);
@@ -194,6 +236,10 @@ static void *_event_loop(void *args)
     while (1) {
         DEBUG("ipv6: waiting for incoming message.\n");
         msg_receive(&msg);
+#ifdef MODULE_GNRC_NETAPI_DIRECT
+        /* keep _direct_receive() out while handling the message */
+        mutex_lock(&_direct.lock);
+#endif
 
         switch (msg.type) {
             case GNRC_NETAPI_MSG_TYPE_RCV:
@@ -254,6 +300,9 @@ static void *_event_loop(void *args)
             default:
                 break;
         }
+#ifdef MODULE_GNRC_NETAPI_DIRECT
+        mutex_unlock(&_direct.lock);
+#endif
     }
 
     return NULL;
@@ -490,15 +539,90 @@ static void _send_by_netif_hdr(gnrc_pktsnip_t *pkt)
 }
 #endif  /* MODULE_GNRC_IPV6_EXT_FRAG */
 
+#if CONFIG_GNRC_IPV6_DST_CACHE_NUMOF
+static _dst_cache_entry_t *_dst_cache_entry(const ipv6_addr_t *dst)
+{
+    uint32_t hash = mix32_hash(ipv6_addr_fold32(dst));
+
+    return &_dst_cache[hash % CONFIG_GNRC_IPV6_DST_CACHE_NUMOF];
+}
+
+static bool _dst_cache_get(const ipv6_addr_t *dst, const gnrc_netif_t *netif,
+                           gnrc_ipv6_nib_nc_t *nce)
+{
+    const _dst_cache_entry_t *entry = _dst_cache_entry(dst);
+
+    if ((entry->nib_version == gnrc_ipv6_nib_version()) &&
+        (entry->iface == ((netif) ? netif->pid : KERNEL_PID_UNDEF)) &&
+        ipv6_addr_equal(&entry->dst, dst)) {
+        *nce = entry->nce;
+        return true;
+    }
+    return false;
+}
+
+static void _dst_cache_set(const ipv6_addr_t *dst, const gnrc_netif_t *netif,
+                           const gnrc_ipv6_nib_nc_t *nce, uint32_t nib_version)
+{
+    _dst_cache_entry_t *entry = _dst_cache_entry(dst);
+
+    switch (gnrc_ipv6_nib_nc_get_nud_state(nce)) {
+    case GNRC_IPV6_NIB_NC_INFO_NUD_STATE_UNMANAGED:
+    case GNRC_IPV6_NIB_NC_INFO_NUD_STATE_REACHABLE:
+        break;
+    default:
+        /* the NIB needs to see further packets to verify reachability */
+        return;
+    }
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ROUTER)
+    gnrc_netif_t *out = gnrc_netif_get_by_pid(gnrc_ipv6_nib_nc_get_iface(nce));
+
+    if ((out == NULL) || (out->ipv6.route_info_cb != NULL)) {
+        /* the routing protocol wants to be informed about every route usage */
+        return;
+    }
+#endif
+    entry->dst = *dst;
+    entry->nce = *nce;
+    entry->nib_version = nib_version;
+    entry->iface = (netif) ? netif->pid : KERNEL_PID_UNDEF;
+}
+#endif  /* CONFIG_GNRC_IPV6_DST_CACHE_NUMOF */
+
+static int _get_next_hop_l2addr(const ipv6_addr_t *dst, gnrc_netif_t *netif,
+                                gnrc_pktsnip_t *pkt, gnrc_ipv6_nib_nc_t *nce,
+                                bool *cached)
+{
+#if CONFIG_GNRC_IPV6_DST_CACHE_NUMOF
+    /* take version before the lookup, in case the NIB changes meanwhile */
+    uint32_t nib_version = gnrc_ipv6_nib_version();
+    int res;
+
+    if (_dst_cache_get(dst, netif, nce)) {
+        *cached = true;
+        return 0;
+    }
+    *cached = false;
+    res = gnrc_ipv6_nib_get_next_hop_l2addr(dst, netif, pkt, nce);
+    if (res == 0) {
+        _dst_cache_set(dst, netif, nce, nib_version);
+    }
+    return res;
+#else   /* CONFIG_GNRC_IPV6_DST_CACHE_NUMOF */
+    *cached = false;
+    return gnrc_ipv6_nib_get_next_hop_l2addr(dst, netif, pkt, nce);
+#endif  /* CONFIG_GNRC_IPV6_DST_CACHE_NUMOF */
+}
+
 static void _send_unicast(gnrc_pktsnip_t *pkt, bool prep_hdr,
                           gnrc_netif_t *netif, ipv6_hdr_t *ipv6_hdr,
                           uint8_t netif_hdr_flags)
 {
     gnrc_ipv6_nib_nc_t nce;
+    bool cached;
 
     DEBUG("ipv6: send unicast\n");
-    if (gnrc_ipv6_nib_get_next_hop_l2addr(&ipv6_hdr->dst, netif, pkt,
-                                          &nce) < 0) {
+    if (_get_next_hop_l2addr(&ipv6_hdr->dst, netif, pkt, &nce, &cached) < 0) {
         /* packet is released by NIB */
         DEBUG("ipv6: no link-layer address or interface for next hop to %s\n",
               ipv6_addr_to_str(addr_str, &ipv6_hdr->dst, sizeof(addr_str)));
@@ -525,6 +649,14 @@ static void _send_unicast(gnrc_pktsnip_t *pkt, bool prep_hdr,
          * have to guarantee mutually exclusive access */
         unsigned irq_state = irq_disable();
         netif->ipv6.stats.tx_unicast_count++;
+#if CONFIG_GNRC_IPV6_DST_CACHE_NUMOF
+        if (cached) {
+            netif->ipv6.stats.dst_cache_hits++;
+        }
+        else {
+            netif->ipv6.stats.dst_cache_misses++;
+        }
+#endif
         irq_restore(irq_state);
 #endif
         _send_to_iface(netif, pkt);
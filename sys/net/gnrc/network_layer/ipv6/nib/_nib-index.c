@@ -0,0 +1,264 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief   Lookup indexes for on-link and off-link entries
+ *
+ * On-link entries are hashed by their address into
+ * @ref CONFIG_GNRC_IPV6_NIB_NUMOF buckets. Off-link entries are kept in a
+ * binary path-compressed (Patricia) trie over their prefixes, so a longest
+ * prefix match visits at most one node per distinct prefix length on the
+ * path to the destination instead of every entry.
+ */
+
+#include <assert.h>
+#include <kernel_defines.h>
+
+#include "hashes.h"
+#include "net/ipv6/addr.h"
+
+#include "_nib-internal.h"
+
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_INDEX)
+
+/**
+ * @brief   Node of the off-link trie
+ *
+ * Every prefix in the NIB has a node. Nodes without entries are branches
+ * and always have two children.
+ */
+typedef struct _trie_node {
+    struct _trie_node *child[2];    /**< children, by the bit after the prefix */
+    _nib_offl_entry_t *entries;     /**< entries with exactly this prefix */
+    ipv6_addr_t pfx;                /**< prefix, bits after pfx_len are 0 */
+    uint8_t pfx_len;                /**< length of the prefix in bits */
+} _trie_node_t;
+
+static _nib_onl_entry_t *_buckets[CONFIG_GNRC_IPV6_NIB_NUMOF];
+
+/* every off-link entry adds at most one leaf and one branch to the trie */
+static _trie_node_t _trie_nodes[2 * CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF];
+static _trie_node_t *_trie_root;
+static _trie_node_t *_trie_free;
+static unsigned _trie_used;
+
+void _nib_index_init(void)
+{
+    memset(_buckets, 0, sizeof(_buckets));
+    _trie_root = NULL;
+    _trie_free = NULL;
+    _trie_used = 0;
+}
+
+static _nib_onl_entry_t **_bucket(const ipv6_addr_t *addr)
+{
+    uint32_t hash = mix32_hash(ipv6_addr_fold32(addr));
+
+    return &_buckets[hash % CONFIG_GNRC_IPV6_NIB_NUMOF];
+}
+
+void _nib_onl_index_add(_nib_onl_entry_t *node)
+{
+    if (ipv6_addr_is_unspecified(&node->ipv6)) {
+        return;
+    }
+    _nib_onl_entry_t **link = _bucket(&node->ipv6);
+
+    /* keep bucket in NIB order, so lookups find the same entry as a scan */
+    while ((*link != NULL) && (*link < node)) {
+        link = &(*link)->idx_next;
+    }
+    node->idx_next = *link;
+    *link = node;
+}
+
+void _nib_onl_index_remove(_nib_onl_entry_t *node)
+{
+    if (ipv6_addr_is_unspecified(&node->ipv6)) {
+        return;
+    }
+    for (_nib_onl_entry_t **link = _bucket(&node->ipv6); *link != NULL;
+         link = &(*link)->idx_next) {
+        if (*link == node) {
+            *link = node->idx_next;
+            node->idx_next = NULL;
+            return;
+        }
+    }
+}
+
+_nib_onl_entry_t *_nib_onl_index_next(const ipv6_addr_t *addr,
+                                      const _nib_onl_entry_t *last)
+{
+    assert(!ipv6_addr_is_unspecified(addr));
+    for (_nib_onl_entry_t *node = (last) ? last->idx_next : *_bucket(addr);
+         node != NULL; node = node->idx_next) {
+        if (ipv6_addr_equal(&node->ipv6, addr)) {
+            return node;
+        }
+    }
+    return NULL;
+}
+
+static inline unsigned _bit(const ipv6_addr_t *addr, unsigned pos)
+{
+    return (addr->u8[pos / 8] >> (7 - (pos % 8))) & 0x1;
+}
+
+static _trie_node_t *_trie_node_alloc(const ipv6_addr_t *pfx, unsigned pfx_len)
+{
+    _trie_node_t *node = _trie_free;
+
+    if (node != NULL) {
+        _trie_free = node->child[0];
+    }
+    else {
+        assert(_trie_used < ARRAY_SIZE(_trie_nodes));
+        node = &_trie_nodes[_trie_used++];
+    }
+    memset(node, 0, sizeof(*node));
+    ipv6_addr_init_prefix(&node->pfx, pfx, pfx_len);
+    node->pfx_len = pfx_len;
+    return node;
+}
+
+static void _trie_node_free(_trie_node_t *node)
+{
+    node->child[0] = _trie_free;
+    _trie_free = node;
+}
+
+/* replaces a node with less than two children by its child */
+static void _trie_splice(_trie_node_t **link)
+{
+    _trie_node_t *node = *link;
+
+    assert((node->child[0] == NULL) || (node->child[1] == NULL));
+    *link = (node->child[0] != NULL) ? node->child[0] : node->child[1];
+    _trie_node_free(node);
+}
+
+static void _trie_node_add_entry(_trie_node_t *node, _nib_offl_entry_t *dst)
+{
+    _nib_offl_entry_t **link = &node->entries;
+
+    while ((*link != NULL) && (*link < dst)) {
+        link = &(*link)->idx_next;
+    }
+    dst->idx_next = *link;
+    *link = dst;
+}
+
+void _nib_offl_index_add(_nib_offl_entry_t *dst)
+{
+    _trie_node_t **link = &_trie_root;
+    unsigned pfx_len = dst->pfx_len;
+
+    assert((pfx_len > 0) && (pfx_len <= 128));
+    while (*link != NULL) {
+        _trie_node_t *node = *link;
+        unsigned common = ipv6_addr_match_prefix(&node->pfx, &dst->pfx);
+
+        if (common > pfx_len) {
+            common = pfx_len;
+        }
+        if (common < node->pfx_len) {
+            /* prefix forks off (or ends) within the prefix of node */
+            _trie_node_t *branch = _trie_node_alloc(&dst->pfx, common);
+
+            branch->child[_bit(&node->pfx, common)] = node;
+            if (common < pfx_len) {
+                _trie_node_t *leaf = _trie_node_alloc(&dst->pfx, pfx_len);
+
+                _trie_node_add_entry(leaf, dst);
+                branch->child[_bit(&dst->pfx, common)] = leaf;
+            }
+            else {
+                _trie_node_add_entry(branch, dst);
+            }
+            *link = branch;
+            return;
+        }
+        if (node->pfx_len == pfx_len) {
+            _trie_node_add_entry(node, dst);
+            return;
+        }
+        link = &node->child[_bit(&dst->pfx, node->pfx_len)];
+    }
+    *link = _trie_node_alloc(&dst->pfx, pfx_len);
+    _trie_node_add_entry(*link, dst);
+}
+
+void _nib_offl_index_remove(_nib_offl_entry_t *dst)
+{
+    _trie_node_t **parent = NULL;
+    _trie_node_t **link = &_trie_root;
+    _trie_node_t *node;
+
+    if (dst->pfx_len == 0) {
+        return;
+    }
+    while (((node = *link) != NULL) && (node->pfx_len < dst->pfx_len)) {
+        parent = link;
+        link = &node->child[_bit(&dst->pfx, node->pfx_len)];
+    }
+    if ((node == NULL) || (node->pfx_len != dst->pfx_len) ||
+        (ipv6_addr_match_prefix(&node->pfx, &dst->pfx) < dst->pfx_len)) {
+        return;
+    }
+    for (_nib_offl_entry_t **entry = &node->entries; *entry != NULL;
+         entry = &(*entry)->idx_next) {
+        if (*entry == dst) {
+            *entry = dst->idx_next;
+            dst->idx_next = NULL;
+            break;
+        }
+    }
+    if ((node->entries != NULL) ||
+        ((node->child[0] != NULL) && (node->child[1] != NULL))) {
+        /* node is still needed */
+        return;
+    }
+    _trie_splice(link);
+    /* a branch left with a single child is not needed anymore */
+    if ((parent != NULL) && ((*parent)->entries == NULL) &&
+        (((*parent)->child[0] == NULL) || ((*parent)->child[1] == NULL))) {
+        _trie_splice(parent);
+    }
+}
+
+_nib_offl_entry_t *_nib_offl_index_match(const ipv6_addr_t *addr)
+{
+    _nib_offl_entry_t *res = NULL;
+    _trie_node_t *node = _trie_root;
+
+    while ((node != NULL) &&
+           (ipv6_addr_match_prefix(&node->pfx, addr) >= node->pfx_len)) {
+        for (_nib_offl_entry_t *dst = node->entries; dst != NULL;
+             dst = dst->idx_next) {
+            if (dst->mode != _EMPTY) {
+                res = dst;
+                break;
+            }
+        }
+        if (node->pfx_len == 128) {
+            break;
+        }
+        node = node->child[_bit(addr, node->pfx_len)];
+    }
+    return res;
+}
+
+#else  /* CONFIG_GNRC_IPV6_NIB_INDEX */
+typedef int dont_be_pedantic;
+#endif /* CONFIG_GNRC_IPV6_NIB_INDEX */
+
+/** @} */
@@ -46,6 +46,7 @@ static _nib_dr_entry_t _def_routers[CONFIG_GNRC_IPV6_NIB_DEFAULT_ROUTER_NUMOF];
 static _nib_abr_entry_t _abrs[CONFIG_GNRC_IPV6_NIB_ABR_NUMOF];
 #endif  /* CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C */
 static rmutex_t _nib_mutex = RMUTEX_INIT;
+static uint32_t _nib_version;
 
 static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 
@@ -66,6 +67,9 @@ void _nib_init(void)
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C)
     memset(_abrs, 0, sizeof(_abrs));
 #endif  /* CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C */
+    if (IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_INDEX)) {
+        _nib_index_init();
+    }
 #endif  /* TEST_SUITES */
     evtimer_init_msg(&_nib_evtimer);
     /* TODO: load ABR information from persistent memory */
@@ -77,10 +81,21 @@ void _nib_acquire(void)
 }
 
 void _nib_release(void)
+{
+    _nib_version++;
+    rmutex_unlock(&_nib_mutex);
+}
+
+void _nib_release_unchanged(void)
 {
     rmutex_unlock(&_nib_mutex);
 }
 
+uint32_t gnrc_ipv6_nib_version(void)
+{
+    return _nib_version;
+}
+
 static inline bool _addr_equals(const ipv6_addr_t *addr,
                                 const _nib_onl_entry_t *node)
 {
@@ -94,14 +109,30 @@ static inline bool _addr_equals(const ipv6_addr_t *addr,
 _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface)
 {
     _nib_onl_entry_t *node = NULL;
+    /* entries with unspecified address are not indexed */
+    const bool indexed = IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_INDEX) &&
+                         (addr != NULL) && !ipv6_addr_is_unspecified(addr);
 
     DEBUG("nib: Allocating on-link node entry (addr = %s, iface = %u)\n",
           (addr == NULL) ? "NULL" : ipv6_addr_to_str(addr_str, addr,
                                                      sizeof(addr_str)), iface);
-    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
+    if (indexed) {
+        _nib_onl_entry_t *tmp = NULL;
+
+        while ((tmp = _nib_onl_index_next(addr, tmp))) {
+            if (_nib_onl_get_if(tmp) == iface) {
+                DEBUG("  %p is an exact match\n", (void *)tmp);
+                node = tmp;
+                break;
+            }
+        }
+    }
+    for (unsigned i = 0; (i < CONFIG_GNRC_IPV6_NIB_NUMOF) &&
+                         !(indexed && (node != NULL)); i++) {
         _nib_onl_entry_t *tmp = &_nodes[i];
 
-        if ((_nib_onl_get_if(tmp) == iface) && _addr_equals(addr, tmp)) {
+        if (!indexed && (_nib_onl_get_if(tmp) == iface) &&
+            _addr_equals(addr, tmp)) {
             /* exact match */
             DEBUG("  %p is an exact match\n", (void *)tmp);
             node = tmp;
@@ -153,6 +184,8 @@ static inline _nib_onl_entry_t *_cache_out_onl_entry(const ipv6_addr_t *addr,
                   iface);
             /* call _nib_nc_remove to remove timers from _evtimer */
             _nib_nc_remove(tmp);
+            /* the neighbor may be the next hop of another destination */
+            _nib_version++;
             res = tmp;
             _override_node(addr, iface, res);
             /* cstate masked in _nib_nc_add() already */
@@ -223,6 +256,21 @@ _nib_onl_entry_t *_nib_onl_get(const ipv6_addr_t *addr, unsigned iface)
     assert(addr != NULL);
     DEBUG("nib: Getting on-link node entry (addr = %s, iface = %u)\n",
           ipv6_addr_to_str(addr_str, addr, sizeof(addr_str)), iface);
+    if (IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_INDEX) &&
+        !ipv6_addr_is_unspecified(addr)) {
+        _nib_onl_entry_t *node = NULL;
+
+        while ((node = _nib_onl_index_next(addr, node))) {
+            if ((node->mode != _EMPTY) &&
+                ((_nib_onl_get_if(node) == 0) || (iface == 0) ||
+                 (_nib_onl_get_if(node) == iface))) {
+                DEBUG("  Found %p\n", (void *)node);
+                return node;
+            }
+        }
+        DEBUG("  No suitable entry found\n");
+        return NULL;
+    }
     for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
         _nib_onl_entry_t *node = &_nodes[i];
 
@@ -509,8 +557,14 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
                 /* next hop matches or is unspecified */
                 DEBUG("  %p is an exact match\n", (void *)tmp);
                 if (next_hop != NULL) {
+                    if (IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_INDEX)) {
+                        _nib_onl_index_remove(tmp_node);
+                    }
                     /* sets next_hop if it was previously unspecified */
                     memcpy(&tmp_node->ipv6, next_hop, sizeof(tmp_node->ipv6));
+                    if (IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_INDEX)) {
+                        _nib_onl_index_add(tmp_node);
+                    }
                 }
                 /*mark that this NCE is used by an offl_entry*/
                 tmp->next_hop->mode |= _DST;
@@ -520,6 +574,10 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
     }
     if (dst != NULL) {
         DEBUG("  using %p\n", (void *)dst);
+        if (IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_INDEX)) {
+            /* empty, but not necessarily cleared */
+            _nib_offl_index_remove(dst);
+        }
         if (!dst->next_hop && !(dst->next_hop = _nib_onl_alloc(next_hop, iface))) {
             memset(dst, 0, sizeof(_nib_offl_entry_t));
             return NULL;
@@ -528,6 +586,9 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
         dst->next_hop->mode |= _DST;
         ipv6_addr_init_prefix(&dst->pfx, pfx, pfx_len);
         dst->pfx_len = pfx_len;
+        if (IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_INDEX)) {
+            _nib_offl_index_add(dst);
+        }
     }
     return dst;
 }
@@ -566,6 +627,9 @@ void _nib_offl_clear(_nib_offl_entry_t *dst)
                 _nib_onl_clear(dst->next_hop);
             }
         }
+        if (IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_INDEX)) {
+            _nib_offl_index_remove(dst);
+        }
         memset(dst, 0, sizeof(_nib_offl_entry_t));
     }
     else {
@@ -597,10 +661,13 @@ bool _nib_offl_is_entry(const _nib_offl_entry_t *entry)
 static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
 {
     _nib_offl_entry_t *res = NULL;
-    uint8_t best_match = 0;
+    uint8_t best_len = 0;
 
     DEBUG("nib: get match for destination %s from NIB\n",
           ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)));
+    if (IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_INDEX)) {
+        return _nib_offl_index_match(dst);
+    }
     for (_nib_offl_entry_t *entry = _dsts; _in_dsts(entry); entry++) {
         if (entry->mode != _EMPTY) {
             uint8_t match = ipv6_addr_match_prefix(&entry->pfx, dst);
@@ -613,10 +680,12 @@ static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
                   ipv6_addr_to_str(addr_str, &entry->next_hop->ipv6,
                                    sizeof(addr_str)),
                   _nib_onl_get_if(entry->next_hop), match);
-            if ((match > best_match) && (match >= entry->pfx_len)) {
-                DEBUG("nib: best match (%u bits)\n", match);
+            /* compare prefix lengths, not the bits matched: a shorter
+             * prefix may match as many bits of dst as a longer one */
+            if ((match >= entry->pfx_len) && (entry->pfx_len > best_len)) {
+                DEBUG("nib: best match (%u bits)\n", entry->pfx_len);
                 res = entry;
-                best_match = match;
+                best_len = entry->pfx_len;
             }
         }
     }
@@ -878,11 +947,17 @@ _nib_offl_entry_t *_nib_pl_add(unsigned iface,
 static void _override_node(const ipv6_addr_t *addr, unsigned iface,
                            _nib_onl_entry_t *node)
 {
+    if (IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_INDEX)) {
+        _nib_onl_index_remove(node);
+    }
     _nib_onl_clear(node);
     if (addr != NULL) {
         memcpy(&node->ipv6, addr, sizeof(node->ipv6));
     }
     _nib_onl_set_if(node, iface);
+    if (IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_INDEX)) {
+        _nib_onl_index_add(node);
+    }
 }
 
 static inline bool _node_unreachable(_nib_onl_entry_t *node)
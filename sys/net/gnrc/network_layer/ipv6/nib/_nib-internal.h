@@ -93,6 +93,14 @@ extern "C" {
  */
 typedef struct _nib_onl_entry {
     struct _nib_onl_entry *next;        /**< next removable entry */
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_INDEX) || defined(DOXYGEN)
+    /**
+     * @brief   next entry in the same bucket of the on-link index
+     *
+     * @note    Only available if @ref CONFIG_GNRC_IPV6_NIB_INDEX != 0.
+     */
+    struct _nib_onl_entry *idx_next;
+#endif
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_QUEUE_PKT) || defined(DOXYGEN)
     /**
      * @brief   queue for packets currently in address resolution
@@ -199,8 +207,16 @@ typedef struct {
 /**
  * @brief   Off-link NIB entry
  */
-typedef struct {
+typedef struct _nib_offl_entry {
     _nib_onl_entry_t *next_hop; /**< next hop to destination */
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_INDEX) || defined(DOXYGEN)
+    /**
+     * @brief   next entry with the same prefix in the off-link index
+     *
+     * @note    Only available if @ref CONFIG_GNRC_IPV6_NIB_INDEX != 0.
+     */
+    struct _nib_offl_entry *idx_next;
+#endif
     ipv6_addr_t pfx;            /**< prefix to the destination */
     /**
      * @brief   Event for @ref GNRC_IPV6_NIB_PFX_TIMEOUT
@@ -318,9 +334,97 @@ void _nib_acquire(void);
 
 /**
  * @brief   Release exclusive access to the NIB
+ *
+ * As the NIB may have been changed, this also changes the version of the NIB
+ * (see @ref gnrc_ipv6_nib_version()).
  */
 void _nib_release(void);
 
+/**
+ * @brief   Release exclusive access to the NIB without changing its version
+ *
+ * Use this instead of _nib_release() if the NIB was only read, or if only
+ * the entries for a destination that was just looked up were changed.
+ */
+void _nib_release_unchanged(void);
+
+/**
+ * @name    Lookup indexes
+ *
+ * Only available if @ref CONFIG_GNRC_IPV6_NIB_INDEX != 0. The indexes only
+ * reference entries, so they must be updated whenever the key of an entry
+ * (_nib_onl_entry_t::ipv6 or _nib_offl_entry_t::pfx and
+ * _nib_offl_entry_t::pfx_len) changes: remove the entry before and add it
+ * again after the change.
+ * @{
+ */
+/**
+ * @brief   Empties both indexes
+ */
+void _nib_index_init(void);
+
+/**
+ * @brief   Adds an on-link entry to the on-link index
+ *
+ * Entries with an unspecified address are not indexed.
+ *
+ * @param[in] node  An on-link entry, not yet in the index.
+ */
+void _nib_onl_index_add(_nib_onl_entry_t *node);
+
+/**
+ * @brief   Removes an on-link entry from the on-link index
+ *
+ * @param[in] node  An on-link entry. May not be in the index.
+ */
+void _nib_onl_index_remove(_nib_onl_entry_t *node);
+
+/**
+ * @brief   Iterates over the on-link entries with a given address
+ *
+ * Entries are returned in the order they are stored in the NIB, regardless
+ * of their mode.
+ *
+ * @pre `(addr != NULL) && !ipv6_addr_is_unspecified(addr)`
+ *
+ * @param[in] addr  An IPv6 address.
+ * @param[in] last  Last entry (NULL to start).
+ *
+ * @return  entry with address @p addr after @p last.
+ * @return  NULL, if there is no such entry.
+ */
+_nib_onl_entry_t *_nib_onl_index_next(const ipv6_addr_t *addr,
+                                      const _nib_onl_entry_t *last);
+
+/**
+ * @brief   Adds an off-link entry to the off-link index
+ *
+ * @param[in] dst   An off-link entry with a prefix, not yet in the index.
+ */
+void _nib_offl_index_add(_nib_offl_entry_t *dst);
+
+/**
+ * @brief   Removes an off-link entry from the off-link index
+ *
+ * @param[in] dst   An off-link entry. May not be in the index.
+ */
+void _nib_offl_index_remove(_nib_offl_entry_t *dst);
+
+/**
+ * @brief   Gets the off-link entry with the longest prefix matching a
+ *          destination
+ *
+ * Of several non-empty entries with the same prefix, the one stored first in
+ * the NIB is returned.
+ *
+ * @param[in] addr  A destination address.
+ *
+ * @return  The best matching off-link entry.
+ * @return  NULL, if no entry matches.
+ */
+_nib_offl_entry_t *_nib_offl_index_match(const ipv6_addr_t *addr);
+/** @} */
+
 /**
  * @brief   Gets interface identifier from a NIB entry
  *
@@ -370,6 +474,9 @@ _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface);
 static inline bool _nib_onl_clear(_nib_onl_entry_t *node)
 {
     if (node->mode == _EMPTY) {
+        if (IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_INDEX)) {
+            _nib_onl_index_remove(node);
+        }
         memset(node, 0, sizeof(_nib_onl_entry_t));
         return true;
     }
@@ -289,7 +289,7 @@ static gnrc_netif_t *_acquire_new_iface(unsigned iface)
     gnrc_netif_t *netif = gnrc_netif_get_by_pid(iface);
     /* release NIB, in case other thread calls a NIB function while we wait for
      * the netif */
-    _nib_release();
+    _nib_release_unchanged();
     gnrc_netif_acquire(netif);
     /* re-acquire NIB */
     _nib_acquire();
@@ -398,7 +398,8 @@ int gnrc_ipv6_nib_get_next_hop_l2addr(const ipv6_addr_t *dst,
             }
         }
     } while (0);
-    _nib_release();
+    /* only entries for dst itself were created or updated */
+    _nib_release_unchanged();
     gnrc_netif_release(netif);
     return res;
 }
@@ -29,6 +29,10 @@
 
 static gnrc_sixlowpan_ctx_t _ctxs[GNRC_SIXLOWPAN_CTX_SIZE];
 static uint32_t _ctx_inval_times[GNRC_SIXLOWPAN_CTX_SIZE];
+/* changes whenever the outcome of a lookup for compression may change */
+static uint32_t _ctx_gen;
+/* earliest minute a context with a lifetime is invalidated */
+static uint32_t _ctx_next_inval = UINT32_MAX;
 static mutex_t _ctx_mutex = MUTEX_INIT;
 
 static uint32_t _current_minute(void);
@@ -129,11 +133,52 @@ gnrc_sixlowpan_ctx_t *gnrc_sixlowpan_ctx_update(uint8_t id, const ipv6_addr_t *p
           id, ipv6_addr_to_str(ipv6str, &_ctxs[id].prefix, sizeof(ipv6str)),
           _ctxs[id].prefix_len, _ctxs[id].ltime);
     _ctx_inval_times[id] = ltime + _current_minute();
+    if ((ltime > 0) && (_ctx_inval_times[id] < _ctx_next_inval)) {
+        _ctx_next_inval = _ctx_inval_times[id];
+    }
+    _ctx_gen++;
 
     mutex_unlock(&_ctx_mutex);
     return &(_ctxs[id]);
 }
 
+void gnrc_sixlowpan_ctx_remove(uint8_t id)
+{
+    if (id >= GNRC_SIXLOWPAN_CTX_SIZE) {
+        return;
+    }
+
+    mutex_lock(&_ctx_mutex);
+    _ctxs[id].prefix_len = 0;
+    _ctx_gen++;
+    mutex_unlock(&_ctx_mutex);
+}
+
+uint32_t gnrc_sixlowpan_ctx_generation(void)
+{
+    uint32_t res;
+
+    mutex_lock(&_ctx_mutex);
+
+    if (_current_minute() >= _ctx_next_inval) {
+        /* at least one context expired since the last call, so catch up on
+         * all lifetimes and find the next one to expire */
+        _ctx_next_inval = UINT32_MAX;
+        for (unsigned int id = 0; id < GNRC_SIXLOWPAN_CTX_SIZE; id++) {
+            _update_lifetime(id);
+            if ((_ctxs[id].ltime > 0) &&
+                (_ctx_inval_times[id] < _ctx_next_inval)) {
+                _ctx_next_inval = _ctx_inval_times[id];
+            }
+        }
+    }
+    res = _ctx_gen;
+
+    mutex_unlock(&_ctx_mutex);
+
+    return res;
+}
+
 static uint32_t _current_minute(void)
 {
 #if IS_USED(MODULE_ZTIMER_MSEC)
@@ -158,6 +203,7 @@ static void _update_lifetime(uint8_t id)
         DEBUG("6lo ctx: context %u was invalidated for compression\n", id);
         _ctxs[id].ltime = 0;
         _ctxs[id].flags_id &= ~GNRC_SIXLOWPAN_CTX_FLAGS_COMP;
+        _ctx_gen++;
     }
     else {
         _ctxs[id].ltime = (uint16_t)(_ctx_inval_times[id] - now);
@@ -169,7 +215,11 @@ static void _update_lifetime(uint8_t id)
 
 void gnrc_sixlowpan_ctx_reset(void)
 {
+    mutex_lock(&_ctx_mutex);
     memset(_ctxs, 0, sizeof(_ctxs));
+    _ctx_next_inval = UINT32_MAX;
+    _ctx_gen++;
+    mutex_unlock(&_ctx_mutex);
 }
 #endif
 
@@ -19,6 +19,9 @@
 #include "net/gnrc/netif/hdr.h"
 #include "net/gnrc/pktbuf.h"
 #include "net/gnrc/sixlowpan/internal.h"
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_STATS
+#include "net/gnrc/sixlowpan/frag/stats.h"
+#endif
 #include "utlist.h"
 
 #include "net/gnrc/sixlowpan/frag/minfwd.h"
@@ -71,6 +74,10 @@ int gnrc_sixlowpan_frag_minfwd_forward(gnrc_pktsnip_t *pkt,
         gnrc_pktbuf_release(pkt);
         return -ENOMEM;
     }
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_STATS
+    gnrc_sixlowpan_frag_stats_forwarded(vrbe->super.src, vrbe->super.src_len,
+                                        vrbe->super.dst, vrbe->super.dst_len);
+#endif
     if (_is_last_frag(vrbe)) {
         DEBUG("6lo minfwd: current_size (%u) >= datagram_size (%u)\n",
               vrbe->super.current_size, vrbe->super.datagram_size);
@@ -17,6 +17,7 @@
 #include <inttypes.h>
 #include <stdbool.h>
 
+#include "hashes.h"
 #include "net/ieee802154.h"
 #include "net/ipv6.h"
 #include "net/ipv6/hdr.h"
@@ -60,9 +61,23 @@
 #endif
 
 static gnrc_sixlowpan_frag_rb_int_t rbuf_int[RBUF_INT_SIZE];
+/* intervals are mostly released in the order they were taken, so the search
+ * for a free one starts after the one taken last */
+static unsigned rbuf_int_next;
 
 static gnrc_sixlowpan_frag_rb_t rbuf[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE];
 
+#if IS_ACTIVE(CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_INDEX)
+/* entries hashed by (src, dst, tag), chained in the order of rbuf */
+static gnrc_sixlowpan_frag_rb_t *rbuf_buckets[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE];
+static gnrc_sixlowpan_frag_rb_t *rbuf_idx_next[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE];
+#endif
+
+/* lower bound for the arrival times of all entries, so adding a fragment only
+ * needs to look for timed out entries when one may actually have timed out */
+static uint32_t rbuf_oldest;
+static bool rbuf_oldest_valid;
+
 static char l2addr_str[3 * IEEE802154_LONG_ADDRESS_LEN];
 
 static xtimer_t _gc_timer;
@@ -87,6 +102,8 @@ static int _rbuf_get(const void *src, size_t src_len,
 /* gets an entry only by link-layer information and tag */
 static gnrc_sixlowpan_frag_rb_t *_rbuf_get_by_tag(const gnrc_netif_hdr_t *netif_hdr,
                                                   uint16_t tag);
+/* garbage collection on reception of a fragment */
+static void _rbuf_gc(void);
 /* internal add to repeat add when fragments overlapped */
 static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
                      size_t offset, unsigned page);
@@ -110,6 +127,99 @@ static int _forward_uncomp(gnrc_pktsnip_t *pkt,
                            unsigned page);
 static int _rbuf_resize_for_reassembly(gnrc_sixlowpan_frag_rb_t *rbuf);
 
+static inline bool _rbuf_match(const gnrc_sixlowpan_frag_rb_t *e,
+                               const void *src, size_t src_len,
+                               const void *dst, size_t dst_len,
+                               uint16_t tag)
+{
+    return (e->pkt != NULL) && (e->super.tag == tag) &&
+           (e->super.src_len == src_len) &&
+           (e->super.dst_len == dst_len) &&
+           (memcmp(e->super.src, src, src_len) == 0) &&
+           (memcmp(e->super.dst, dst, dst_len) == 0);
+}
+
+#if IS_ACTIVE(CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_INDEX)
+static gnrc_sixlowpan_frag_rb_t **_rbuf_bucket(const uint8_t *src, size_t src_len,
+                                               const uint8_t *dst, size_t dst_len,
+                                               uint16_t tag)
+{
+    uint32_t hash = mult31_hash(tag, src, src_len);
+
+    hash = mix32_hash(mult31_hash(hash, dst, dst_len));
+    return &rbuf_buckets[hash % CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE];
+}
+
+static inline gnrc_sixlowpan_frag_rb_t **_rbuf_idx_next(const gnrc_sixlowpan_frag_rb_t *e)
+{
+    return &rbuf_idx_next[e - &rbuf[0]];
+}
+
+static void _rbuf_index_add(gnrc_sixlowpan_frag_rb_t *e)
+{
+    gnrc_sixlowpan_frag_rb_t **link = _rbuf_bucket(e->super.src,
+                                                   e->super.src_len,
+                                                   e->super.dst,
+                                                   e->super.dst_len,
+                                                   e->super.tag);
+
+    /* keep bucket in rbuf order, so lookups find the same entry as a scan */
+    while ((*link != NULL) && (*link < e)) {
+        link = _rbuf_idx_next(*link);
+    }
+    *_rbuf_idx_next(e) = *link;
+    *link = e;
+}
+
+static void _rbuf_index_remove(gnrc_sixlowpan_frag_rb_t *e)
+{
+    /* entries handed in by other modules may not be part of rbuf */
+    if ((e < &rbuf[0]) || (e >= &rbuf[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE])) {
+        return;
+    }
+    for (gnrc_sixlowpan_frag_rb_t **link = _rbuf_bucket(e->super.src,
+                                                        e->super.src_len,
+                                                        e->super.dst,
+                                                        e->super.dst_len,
+                                                        e->super.tag);
+         *link != NULL; link = _rbuf_idx_next(*link)) {
+        if (*link == e) {
+            *link = *_rbuf_idx_next(e);
+            *_rbuf_idx_next(e) = NULL;
+            return;
+        }
+    }
+}
+#endif  /* IS_ACTIVE(CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_INDEX) */
+
+/* gets the first entry after last (or the first entry if last is NULL) that
+ * matches (src, dst, tag) */
+static gnrc_sixlowpan_frag_rb_t *_rbuf_find(gnrc_sixlowpan_frag_rb_t *last,
+                                            const void *src, size_t src_len,
+                                            const void *dst, size_t dst_len,
+                                            uint16_t tag)
+{
+#if IS_ACTIVE(CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_INDEX)
+    for (gnrc_sixlowpan_frag_rb_t *e = (last) ? *_rbuf_idx_next(last)
+                                              : *_rbuf_bucket(src, src_len,
+                                                              dst, dst_len,
+                                                              tag);
+         e != NULL; e = *_rbuf_idx_next(e)) {
+        if (_rbuf_match(e, src, src_len, dst, dst_len, tag)) {
+            return e;
+        }
+    }
+#else   /* IS_ACTIVE(CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_INDEX) */
+    for (gnrc_sixlowpan_frag_rb_t *e = (last) ? last + 1 : &rbuf[0];
+         e < &rbuf[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE]; e++) {
+        if (_rbuf_match(e, src, src_len, dst, dst_len, tag)) {
+            return e;
+        }
+    }
+#endif  /* IS_ACTIVE(CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_INDEX) */
+    return NULL;
+}
+
 static int _check_fragments(gnrc_sixlowpan_frag_rb_base_t *entry,
                             size_t frag_size, size_t offset)
 {
@@ -189,18 +299,7 @@ static gnrc_sixlowpan_frag_rb_t *_rbuf_get_by_tag(const gnrc_netif_hdr_t *netif_
     const uint8_t src_len = netif_hdr->src_l2addr_len;
     const uint8_t dst_len = netif_hdr->dst_l2addr_len;
 
-    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
-        gnrc_sixlowpan_frag_rb_t *e = &rbuf[i];
-
-        if ((e->pkt != NULL) && (e->super.tag == tag) &&
-            (e->super.src_len == src_len) &&
-            (e->super.dst_len == dst_len) &&
-            (memcmp(e->super.src, src, src_len) == 0) &&
-            (memcmp(e->super.dst, dst, dst_len) == 0)) {
-            return e;
-        }
-    }
-    return NULL;
+    return _rbuf_find(NULL, src, src_len, dst, dst_len, tag);
 }
 
 #ifndef NDEBUG
@@ -338,7 +437,7 @@ static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
         return RBUF_ADD_ERROR;
     }
 
-    gnrc_sixlowpan_frag_rb_gc();
+    _rbuf_gc();
     /* only check VRB for subsequent frags, first frags create and not get VRB
      * entries below */
     if (IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_MINFWD) &&
@@ -515,8 +614,11 @@ static inline bool _rbuf_int_overlap_partially(gnrc_sixlowpan_frag_rb_int_t *i,
 static gnrc_sixlowpan_frag_rb_int_t *_rbuf_int_get_free(void)
 {
     for (unsigned int i = 0; i < RBUF_INT_SIZE; i++) {
-        if (rbuf_int[i].end == 0) { /* start must be smaller than end anyways*/
-            return rbuf_int + i;
+        unsigned int idx = (rbuf_int_next + i) % RBUF_INT_SIZE;
+
+        if (rbuf_int[idx].end == 0) { /* start must be smaller than end anyways*/
+            rbuf_int_next = (idx + 1) % RBUF_INT_SIZE;
+            return rbuf_int + idx;
         }
     }
 
@@ -577,16 +679,36 @@ static void _gc_pkt(gnrc_sixlowpan_frag_rb_t *rbuf)
     gnrc_pktbuf_release(rbuf->pkt);
 }
 
+/* note that xtimer_now will overflow in ~1.2 hours */
+static inline bool _older(uint32_t a, uint32_t b)
+{
+    return (b - a) < (UINT32_MAX / 2);
+}
+
+static void _rbuf_arrival_changed(uint32_t arrival)
+{
+    if (!rbuf_oldest_valid || _older(arrival, rbuf_oldest)) {
+        rbuf_oldest = arrival;
+        rbuf_oldest_valid = true;
+    }
+}
+
 void gnrc_sixlowpan_frag_rb_gc(void)
 {
     uint32_t now_usec = xtimer_now_usec();
     unsigned int i;
 
+    rbuf_oldest_valid = false;
     for (i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
+        if (gnrc_sixlowpan_frag_rb_entry_empty(&rbuf[i])) {
+            continue;
+        }
         /* since pkt occupies pktbuf, aggressively collect garbage */
-        if (!gnrc_sixlowpan_frag_rb_entry_empty(&rbuf[i]) &&
-              ((now_usec - rbuf[i].super.arrival) >
-               CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_US)) {
+        if ((now_usec - rbuf[i].super.arrival) <=
+            CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_US) {
+            _rbuf_arrival_changed(rbuf[i].super.arrival);
+        }
+        else {
             DEBUG("6lo rfrag: entry (%s, ",
                   gnrc_netif_addr_to_str(rbuf[i].super.src,
                                          rbuf[i].super.src_len,
@@ -606,6 +728,18 @@ void gnrc_sixlowpan_frag_rb_gc(void)
 #endif
 }
 
+/* garbage collection on reception of a fragment: unlike
+ * gnrc_sixlowpan_frag_rb_gc() only looks at the entries if the oldest entry
+ * may have timed out. The VRB has its own garbage collection timer. */
+static void _rbuf_gc(void)
+{
+    if (rbuf_oldest_valid &&
+        ((xtimer_now_usec() - rbuf_oldest) >
+         CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_US)) {
+        gnrc_sixlowpan_frag_rb_gc();
+    }
+}
+
 static inline void _set_rbuf_timeout(void)
 {
     xtimer_set_msg(&_gc_timer, CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_US,
@@ -620,50 +754,48 @@ static int _rbuf_get(const void *src, size_t src_len,
     gnrc_sixlowpan_frag_rb_t *res = NULL, *oldest = NULL;
     uint32_t now_usec = xtimer_now_usec();
 
-    for (unsigned int i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
-        /* check first if entry already available */
-        if ((rbuf[i].pkt != NULL) && (rbuf[i].super.tag == tag) &&
-            ((IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) &&
-              /* not all SFR fragments carry the datagram size, so make 0 a
-               * legal value to not compare datagram size */
-              ((size == 0) || (rbuf[i].super.datagram_size == size))) ||
-             (!IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) &&
-              (rbuf[i].super.datagram_size == size))) &&
-            (rbuf[i].super.src_len == src_len) &&
-            (rbuf[i].super.dst_len == dst_len) &&
-            (memcmp(rbuf[i].super.src, src, src_len) == 0) &&
-            (memcmp(rbuf[i].super.dst, dst, dst_len) == 0)) {
-            DEBUG("6lo rfrag: entry %p (%s, ", (void *)(&rbuf[i]),
-                  gnrc_netif_addr_to_str(rbuf[i].super.src,
-                                         rbuf[i].super.src_len,
+    /* check first if entry already available */
+    for (gnrc_sixlowpan_frag_rb_t *e = _rbuf_find(NULL, src, src_len,
+                                                  dst, dst_len, tag);
+         e != NULL; e = _rbuf_find(e, src, src_len, dst, dst_len, tag)) {
+        if ((IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) &&
+             /* not all SFR fragments carry the datagram size, so make 0 a
+              * legal value to not compare datagram size */
+             ((size == 0) || (e->super.datagram_size == size))) ||
+            (!IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) &&
+             (e->super.datagram_size == size))) {
+            DEBUG("6lo rfrag: entry %p (%s, ", (void *)e,
+                  gnrc_netif_addr_to_str(e->super.src,
+                                         e->super.src_len,
                                          l2addr_str));
             DEBUG("%s, %u, %u) found\n",
-                  gnrc_netif_addr_to_str(rbuf[i].super.dst,
-                                         rbuf[i].super.dst_len,
+                  gnrc_netif_addr_to_str(e->super.dst,
+                                         e->super.dst_len,
                                          l2addr_str),
-                  (unsigned)rbuf[i].super.datagram_size, rbuf[i].super.tag);
+                  (unsigned)e->super.datagram_size, e->super.tag);
 #if CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER > 0
-            if (rbuf[i].super.current_size == 0) {
+            if (e->super.current_size == 0) {
                 /* ensure that only empty reassembly buffer entries and entries
                  * scheduled for deletion have `current_size == 0` */
                 DEBUG("6lo rfrag: scheduled for deletion, don't add fragment\n");
                 return -1;
             }
 #endif
-            rbuf[i].super.arrival = now_usec;
+            e->super.arrival = now_usec;
             _set_rbuf_timeout();
-            return i;
+            return e - &(rbuf[0]);
         }
+    }
 
+    for (unsigned int i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
         /* if there is a free spot: remember it */
         if ((res == NULL) && gnrc_sixlowpan_frag_rb_entry_empty(&rbuf[i])) {
             res = &(rbuf[i]);
         }
 
         /* remember oldest slot */
-        /* note that xtimer_now will overflow in ~1.2 hours */
         if ((oldest == NULL) ||
-            (oldest->super.arrival - rbuf[i].super.arrival < UINT32_MAX / 2)) {
+            _older(rbuf[i].super.arrival, oldest->super.arrival)) {
             oldest = &(rbuf[i]);
         }
     }
@@ -746,6 +878,10 @@ static int _rbuf_get(const void *src, size_t src_len,
     res->offset_diff = 0U;
     memset(res->received, 0U, sizeof(res->received));
 #endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) */
+#if IS_ACTIVE(CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_INDEX)
+    _rbuf_index_add(res);
+#endif
+    _rbuf_arrival_changed(now_usec);
 
     DEBUG("6lo rfrag: entry %p (%s, ", (void *)res,
           gnrc_netif_addr_to_str(res->super.src, res->super.src_len,
@@ -772,6 +908,12 @@ void gnrc_sixlowpan_frag_rb_reset(void)
         }
     }
     memset(rbuf, 0, sizeof(rbuf));
+#if IS_ACTIVE(CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_INDEX)
+    memset(rbuf_buckets, 0, sizeof(rbuf_buckets));
+    memset(rbuf_idx_next, 0, sizeof(rbuf_idx_next));
+#endif
+    rbuf_int_next = 0;
+    rbuf_oldest_valid = false;
 }
 
 const gnrc_sixlowpan_frag_rb_t *gnrc_sixlowpan_frag_rb_array(void)
@@ -780,6 +922,18 @@ const gnrc_sixlowpan_frag_rb_t *gnrc_sixlowpan_frag_rb_array(void)
 }
 #endif
 
+void gnrc_sixlowpan_frag_rb_remove(gnrc_sixlowpan_frag_rb_t *rbuf)
+{
+    assert(rbuf != NULL);
+#if IS_ACTIVE(CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_INDEX)
+    if (rbuf->pkt != NULL) {
+        _rbuf_index_remove(rbuf);
+    }
+#endif
+    gnrc_sixlowpan_frag_rb_base_rm(&rbuf->super);
+    rbuf->pkt = NULL;
+}
+
 void gnrc_sixlowpan_frag_rb_base_rm(gnrc_sixlowpan_frag_rb_base_t *entry)
 {
     while (entry->ints != NULL) {
@@ -804,6 +958,7 @@ static void _tmp_rm(gnrc_sixlowpan_frag_rb_t *rbuf)
         rbuf->super.arrival = xtimer_now_usec() -
                               (CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_US -
                                CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER);
+        _rbuf_arrival_changed(rbuf->super.arrival);
         /* reset current size to prevent late duplicates to trigger another
          * dispatch */
         rbuf->super.current_size = 0;
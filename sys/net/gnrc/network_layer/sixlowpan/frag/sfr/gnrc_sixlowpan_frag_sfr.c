@@ -31,6 +31,9 @@
 #include "net/gnrc/sixlowpan/config.h"
 #include "net/gnrc/sixlowpan/frag/fb.h"
 #include "net/gnrc/sixlowpan/frag/rb.h"
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_STATS
+#include "net/gnrc/sixlowpan/frag/stats.h"
+#endif
 #include "net/gnrc/sixlowpan/frag/vrb.h"
 #include "net/gnrc/tx_sync.h"
 #include "net/sixlowpan/sfr.h"
@@ -1796,9 +1799,10 @@ static void _handle_ack(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
             if (CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER > 0) {
                 /* garbage-collect entry after CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER
                  * microseconds */
-                vrbe->super.arrival = recv_time -
-                                      (CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_TIMEOUT_US -
-                                       CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER);
+                gnrc_sixlowpan_frag_vrb_set_arrival(
+                    vrbe, recv_time - (CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_TIMEOUT_US -
+                                       CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER)
+                );
             }
             else {
                 gnrc_sixlowpan_frag_vrb_rm(vrbe);
@@ -1874,6 +1878,12 @@ static int _forward_rfrag(gnrc_pktsnip_t *pkt, _generic_rb_entry_t *entry,
     hdr->base.tag = entry->entry.vrb->out_tag;
     gnrc_netif_hdr_set_netif(new->data, entry->entry.vrb->out_netif);
     new->next = pkt;
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_STATS
+    gnrc_sixlowpan_frag_stats_forwarded(entry->entry.base->src,
+                                        entry->entry.base->src_len,
+                                        entry->entry.base->dst,
+                                        entry->entry.base->dst_len);
+#endif
     _send_frame(new, NULL, NULL, page);
     if (IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR_STATS)) {
         _stats.fragments_sent.forwarded++;
@@ -13,6 +13,8 @@
  * @author  Martine Lenders <m.lenders@fu-berlin.de>
  */
 
+#include <string.h>
+
 #include "net/gnrc/sixlowpan/frag/stats.h"
 
 static gnrc_sixlowpan_frag_stats_t _stats;
@@ -22,4 +24,30 @@ gnrc_sixlowpan_frag_stats_t *gnrc_sixlowpan_frag_stats_get(void)
     return &_stats;
 }
 
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
+void gnrc_sixlowpan_frag_stats_forwarded(const uint8_t *src, size_t src_len,
+                                         const uint8_t *dst, size_t dst_len)
+{
+    _stats.fwd_fragments++;
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_STATS_FLOWS; i++) {
+        gnrc_sixlowpan_frag_stats_flow_t *flow = &_stats.flows[i];
+
+        if (flow->src_len == 0) {
+            /* flows are never removed, so this flow was not seen before */
+            memcpy(flow->src, src, src_len);
+            memcpy(flow->dst, dst, dst_len);
+            flow->src_len = src_len;
+            flow->dst_len = dst_len;
+        }
+        else if ((flow->src_len != src_len) || (flow->dst_len != dst_len) ||
+                 (memcmp(flow->src, src, src_len) != 0) ||
+                 (memcmp(flow->dst, dst, dst_len) != 0)) {
+            continue;
+        }
+        flow->fragments++;
+        return;
+    }
+}
+#endif
+
 /** @} */
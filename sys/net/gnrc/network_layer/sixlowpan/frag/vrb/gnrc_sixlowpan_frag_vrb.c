@@ -13,12 +13,16 @@
  * @author  Martine Lenders <m.lenders@fu-berlin.de>
  */
 
+#include "hashes.h"
 #include "net/ieee802154.h"
 #ifdef MODULE_GNRC_IPV6_NIB
 #include "net/ipv6/addr.h"
 #include "net/gnrc/ipv6/nib.h"
 #endif  /* MODULE_GNRC_IPV6_NIB */
 #include "net/gnrc/netif.h"
+#ifdef MODULE_GNRC_SIXLOWPAN
+#include "net/gnrc/sixlowpan.h"
+#endif  /* MODULE_GNRC_SIXLOWPAN */
 #include "xtimer.h"
 
 #include "net/gnrc/sixlowpan/frag/fb.h"
@@ -31,6 +35,19 @@
 #include "debug.h"
 
 static gnrc_sixlowpan_frag_vrb_t _vrb[CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE];
+#if IS_ACTIVE(CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_INDEX)
+/* entries hashed by (src, tag), chained in the order of _vrb */
+static gnrc_sixlowpan_frag_vrb_t *_vrb_buckets[CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE];
+static gnrc_sixlowpan_frag_vrb_t *_vrb_idx_next[CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE];
+#endif
+#ifdef MODULE_GNRC_SIXLOWPAN
+/* a single timer triggers garbage collection when the oldest entry times
+ * out */
+static xtimer_t _gc_timer;
+static msg_t _gc_timer_msg = { .type = GNRC_SIXLOWPAN_FRAG_VRB_GC_MSG };
+static uint32_t _gc_deadline;
+static bool _gc_pending;
+#endif  /* MODULE_GNRC_SIXLOWPAN */
 #ifdef MODULE_GNRC_IPV6_NIB
 static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 #else   /* MODULE_GNRC_IPV6_NIB */
@@ -46,70 +63,160 @@ static inline bool _equal_index(const gnrc_sixlowpan_frag_vrb_t *vrbe,
             (memcmp(vrbe->super.src, src, src_len) == 0));
 }
 
+#if IS_ACTIVE(CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_INDEX)
+static gnrc_sixlowpan_frag_vrb_t **_bucket(const uint8_t *src, size_t src_len,
+                                           unsigned tag)
+{
+    uint32_t hash = mix32_hash(mult31_hash(tag, src, src_len));
+
+    return &_vrb_buckets[hash % CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE];
+}
+
+static inline gnrc_sixlowpan_frag_vrb_t **_idx_next(const gnrc_sixlowpan_frag_vrb_t *vrbe)
+{
+    return &_vrb_idx_next[vrbe - &_vrb[0]];
+}
+
+static void _index_add(gnrc_sixlowpan_frag_vrb_t *vrbe)
+{
+    gnrc_sixlowpan_frag_vrb_t **link = _bucket(vrbe->super.src,
+                                               vrbe->super.src_len,
+                                               vrbe->super.tag);
+
+    /* keep bucket in _vrb order, so lookups find the same entry as a scan */
+    while ((*link != NULL) && (*link < vrbe)) {
+        link = _idx_next(*link);
+    }
+    *_idx_next(vrbe) = *link;
+    *link = vrbe;
+}
+
+static void _index_remove(gnrc_sixlowpan_frag_vrb_t *vrbe)
+{
+    for (gnrc_sixlowpan_frag_vrb_t **link = _bucket(vrbe->super.src,
+                                                    vrbe->super.src_len,
+                                                    vrbe->super.tag);
+         *link != NULL; link = _idx_next(*link)) {
+        if (*link == vrbe) {
+            *link = *_idx_next(vrbe);
+            *_idx_next(vrbe) = NULL;
+            return;
+        }
+    }
+}
+#endif  /* IS_ACTIVE(CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_INDEX) */
+
+static gnrc_sixlowpan_frag_vrb_t *_find(const uint8_t *src, size_t src_len,
+                                        unsigned tag)
+{
+#if IS_ACTIVE(CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_INDEX)
+    for (gnrc_sixlowpan_frag_vrb_t *vrbe = *_bucket(src, src_len, tag);
+         vrbe != NULL; vrbe = *_idx_next(vrbe)) {
+        if (_equal_index(vrbe, src, src_len, tag)) {
+            return vrbe;
+        }
+    }
+#else   /* IS_ACTIVE(CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_INDEX) */
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE; i++) {
+        if (_equal_index(&_vrb[i], src, src_len, tag)) {
+            return &_vrb[i];
+        }
+    }
+#endif  /* IS_ACTIVE(CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_INDEX) */
+    return NULL;
+}
+
+/* schedules garbage collection in timeout microseconds, unless it is
+ * already scheduled earlier */
+static void _gc_sched(uint32_t timeout)
+{
+#ifdef MODULE_GNRC_SIXLOWPAN
+    uint32_t now = xtimer_now_usec();
+    uint32_t deadline = now + timeout;
+
+    /* xtimer_set_msg() drops the message if the queue of the 6LoWPAN thread
+     * is full: a pending deadline that already passed is not trusted */
+    if (_gc_pending && ((_gc_deadline - now) < (UINT32_MAX / 2)) &&
+        ((deadline - _gc_deadline) < (UINT32_MAX / 2))) {
+        return;
+    }
+    _gc_deadline = deadline;
+    _gc_pending = true;
+    xtimer_set_msg(&_gc_timer, timeout, &_gc_timer_msg,
+                   gnrc_sixlowpan_get_pid());
+#else   /* MODULE_GNRC_SIXLOWPAN */
+    (void)timeout;
+#endif  /* MODULE_GNRC_SIXLOWPAN */
+}
+
 gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_add(
         const gnrc_sixlowpan_frag_rb_base_t *base,
         gnrc_netif_t *out_netif, const uint8_t *out_dst, size_t out_dst_len)
 {
-    gnrc_sixlowpan_frag_vrb_t *vrbe = NULL;
+    gnrc_sixlowpan_frag_vrb_t *vrbe;
 
     assert(base != NULL);
     assert(base->src_len != 0);
     assert(out_netif != NULL);
     assert(out_dst != NULL);
     assert(out_dst_len > 0);
-    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE; i++) {
-        gnrc_sixlowpan_frag_vrb_t *ptr = &_vrb[i];
-
-        if (gnrc_sixlowpan_frag_vrb_entry_empty(ptr) ||
-            _equal_index(ptr, base->src, base->src_len, base->tag)) {
-            vrbe = ptr;
-            if (gnrc_sixlowpan_frag_vrb_entry_empty(vrbe)) {
-                vrbe->super = *base;
-                vrbe->out_netif = out_netif;
-                memcpy(vrbe->super.dst, out_dst, out_dst_len);
-                vrbe->out_tag = gnrc_sixlowpan_frag_fb_next_tag();
-                vrbe->super.dst_len = out_dst_len;
-                DEBUG("6lo vrb: creating entry (%s, ",
-                      gnrc_netif_addr_to_str(vrbe->super.src,
-                                             vrbe->super.src_len,
-                                             addr_str));
-                DEBUG("%s, %u, %u) => ",
-                      gnrc_netif_addr_to_str(vrbe->super.dst,
-                                             vrbe->super.dst_len,
-                                             addr_str),
-                      (unsigned)vrbe->super.datagram_size, vrbe->super.tag);
-                DEBUG("(%s, %u)\n",
-                      gnrc_netif_addr_to_str(vrbe->super.dst,
-                                             vrbe->super.dst_len,
-                                             addr_str), vrbe->out_tag);
+    vrbe = _find(base->src, base->src_len, base->tag);
+    if (vrbe == NULL) {
+        for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE; i++) {
+            if (gnrc_sixlowpan_frag_vrb_entry_empty(&_vrb[i])) {
+                vrbe = &_vrb[i];
+                break;
             }
-            /* _equal_index() => append intervals of `base`, so they don't get
-             * lost. We use append, so we don't need to change base! */
-            else if (base->ints != NULL) {
-                gnrc_sixlowpan_frag_rb_int_t *tmp = vrbe->super.ints;
-
-                if (tmp != base->ints) {
-                    /* base->ints is not already vrbe->super.ints */
-                    if (tmp != NULL) {
-                        /* iterate before appending and check if `base->ints` is
-                         * not already part of list */
-                        while (tmp->next != NULL) {
-                            if (tmp == base->ints) {
-                                tmp = NULL;
-                                break;
-                            }
-                            tmp = tmp->next;
-                        }
-                        if (tmp != NULL) {
-                            tmp->next = base->ints;
-                        }
-                    }
-                    else {
-                        vrbe->super.ints = base->ints;
+        }
+        if (vrbe != NULL) {
+            vrbe->super = *base;
+            vrbe->out_netif = out_netif;
+            memcpy(vrbe->super.dst, out_dst, out_dst_len);
+            vrbe->out_tag = gnrc_sixlowpan_frag_fb_next_tag();
+            vrbe->super.dst_len = out_dst_len;
+            DEBUG("6lo vrb: creating entry (%s, ",
+                  gnrc_netif_addr_to_str(vrbe->super.src,
+                                         vrbe->super.src_len,
+                                         addr_str));
+            DEBUG("%s, %u, %u) => ",
+                  gnrc_netif_addr_to_str(vrbe->super.dst,
+                                         vrbe->super.dst_len,
+                                         addr_str),
+                  (unsigned)vrbe->super.datagram_size, vrbe->super.tag);
+            DEBUG("(%s, %u)\n",
+                  gnrc_netif_addr_to_str(vrbe->super.dst,
+                                         vrbe->super.dst_len,
+                                         addr_str), vrbe->out_tag);
+#if IS_ACTIVE(CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_INDEX)
+            _index_add(vrbe);
+#endif
+            _gc_sched(CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_TIMEOUT_US);
+        }
+    }
+    /* _equal_index() => append intervals of `base`, so they don't get
+     * lost. We use append, so we don't need to change base! */
+    else if (base->ints != NULL) {
+        gnrc_sixlowpan_frag_rb_int_t *tmp = vrbe->super.ints;
+
+        if (tmp != base->ints) {
+            /* base->ints is not already vrbe->super.ints */
+            if (tmp != NULL) {
+                /* iterate before appending and check if `base->ints` is
+                 * not already part of list */
+                while (tmp->next != NULL) {
+                    if (tmp == base->ints) {
+                        tmp = NULL;
+                        break;
                     }
+                    tmp = tmp->next;
+                }
+                if (tmp != NULL) {
+                    tmp->next = base->ints;
                 }
             }
-            break;
+            else {
+                vrbe->super.ints = base->ints;
+            }
         }
     }
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG_STATS
@@ -170,16 +277,14 @@ gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_get(
     DEBUG("6lo vrb: trying to get entry for (%s, %u)\n",
           gnrc_netif_addr_to_str(src, src_len, addr_str), src_tag);
     assert(src_len != 0);
-    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE; i++) {
-        gnrc_sixlowpan_frag_vrb_t *vrbe = &_vrb[i];
+    gnrc_sixlowpan_frag_vrb_t *vrbe = _find(src, src_len, src_tag);
 
-        if (_equal_index(vrbe, src, src_len, src_tag)) {
-            DEBUG("6lo vrb: got VRB to (%s, %u)\n",
-                  gnrc_netif_addr_to_str(vrbe->super.dst,
-                                         vrbe->super.dst_len,
-                                         addr_str), vrbe->out_tag);
-            return vrbe;
-        }
+    if (vrbe != NULL) {
+        DEBUG("6lo vrb: got VRB to (%s, %u)\n",
+              gnrc_netif_addr_to_str(vrbe->super.dst,
+                                     vrbe->super.dst_len,
+                                     addr_str), vrbe->out_tag);
+        return vrbe;
     }
     DEBUG("6lo vrb: no entry found\n");
     return NULL;
@@ -209,13 +314,50 @@ gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_reverse(
 
 }
 
+void gnrc_sixlowpan_frag_vrb_rm(gnrc_sixlowpan_frag_vrb_t *vrb)
+{
+#if IS_ACTIVE(CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_INDEX)
+    if (!gnrc_sixlowpan_frag_vrb_entry_empty(vrb)) {
+        _index_remove(vrb);
+    }
+#endif
+    if (IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB)) {
+        gnrc_sixlowpan_frag_rb_base_rm(&vrb->super);
+    }
+    vrb->super.src_len = 0;
+}
+
+void gnrc_sixlowpan_frag_vrb_set_arrival(gnrc_sixlowpan_frag_vrb_t *vrb,
+                                         uint32_t arrival)
+{
+    uint32_t age = xtimer_now_usec() - arrival;
+
+    vrb->super.arrival = arrival;
+    _gc_sched((age < CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_TIMEOUT_US)
+              ? (CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_TIMEOUT_US - age + 1) : 0);
+}
+
 void gnrc_sixlowpan_frag_vrb_gc(void)
 {
     uint32_t now_usec = xtimer_now_usec();
+    uint32_t next = UINT32_MAX;
 
+#ifdef MODULE_GNRC_SIXLOWPAN
+    _gc_pending = false;
+#endif  /* MODULE_GNRC_SIXLOWPAN */
     for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE; i++) {
-        if (!gnrc_sixlowpan_frag_vrb_entry_empty(&_vrb[i]) &&
-            (now_usec - _vrb[i].super.arrival) > CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_TIMEOUT_US) {
+        uint32_t age = now_usec - _vrb[i].super.arrival;
+
+        if (gnrc_sixlowpan_frag_vrb_entry_empty(&_vrb[i])) {
+            continue;
+        }
+        if (age <= CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_TIMEOUT_US) {
+            /* remember when the next entry times out */
+            if ((CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_TIMEOUT_US - age + 1) < next) {
+                next = CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_TIMEOUT_US - age + 1;
+            }
+        }
+        else {
             DEBUG("6lo vrb: entry (%s, ",
                   gnrc_netif_addr_to_str(_vrb[i].super.src,
                                          _vrb[i].super.src_len,
@@ -228,12 +370,23 @@ void gnrc_sixlowpan_frag_vrb_gc(void)
             gnrc_sixlowpan_frag_vrb_rm(&_vrb[i]);
         }
     }
+    if (next != UINT32_MAX) {
+        _gc_sched(next);
+    }
 }
 
 #ifdef TEST_SUITES
 void gnrc_sixlowpan_frag_vrb_reset(void)
 {
+#ifdef MODULE_GNRC_SIXLOWPAN
+    xtimer_remove(&_gc_timer);
+    _gc_pending = false;
+#endif  /* MODULE_GNRC_SIXLOWPAN */
     memset(_vrb, 0, sizeof(_vrb));
+#if IS_ACTIVE(CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_INDEX)
+    memset(_vrb_buckets, 0, sizeof(_vrb_buckets));
+    memset(_vrb_idx_next, 0, sizeof(_vrb_idx_next));
+#endif
 }
 #endif
 
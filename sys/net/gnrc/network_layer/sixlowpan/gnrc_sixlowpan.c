@@ -26,6 +26,9 @@
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
 #include "net/gnrc/sixlowpan/frag/sfr.h"
 #endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_SFR */
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
+#include "net/gnrc/sixlowpan/frag/vrb.h"
+#endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_VRB */
 #include "net/gnrc/sixlowpan/iphc.h"
 #include "net/gnrc/netif.h"
 #include "net/sixlowpan.h"
@@ -437,6 +440,12 @@ static void *_event_loop(void *args)
                 gnrc_sixlowpan_frag_rb_gc();
                 break;
 #endif
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
+            case GNRC_SIXLOWPAN_FRAG_VRB_GC_MSG:
+                DEBUG("6lo: garbage collect virtual reassembly buffer event received\n");
+                gnrc_sixlowpan_frag_vrb_gc();
+                break;
+#endif
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
             case GNRC_SIXLOWPAN_FRAG_SFR_ARQ_TIMEOUT_MSG:
                 DEBUG("6lo sfr: ARQ timeout received\n");
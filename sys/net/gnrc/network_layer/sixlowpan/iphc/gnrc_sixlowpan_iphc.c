@@ -1073,6 +1073,117 @@ static inline bool _compressible_nh(uint8_t nh)
     }
 }
 
+#if CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE > 0
+/* dispatch, CID extension, traffic class and flow label, next header, hop
+ * limit and both addresses carried inline */
+#define IPHC_CACHE_HDR_MAX_LEN      (SIXLOWPAN_IPHC_HDR_LEN + \
+                                     SIXLOWPAN_IPHC_CID_EXT_LEN + 4U + 1U + 1U + \
+                                     (2 * sizeof(ipv6_addr_t)))
+
+/* compressed IPv6 header of the last packet of a flow */
+typedef struct {
+    gnrc_netif_t *iface;            /**< interface of the flow, NULL if unused */
+    ipv6_addr_t src;                /**< IPv6 source */
+    ipv6_addr_t dst;                /**< IPv6 destination */
+    network_uint32_t v_tc_fl;       /**< version, traffic class and flow label */
+    uint8_t nh;                     /**< next header */
+    uint8_t hl;                     /**< hop limit */
+    uint8_t l2dst_len;              /**< length of l2dst */
+    uint8_t hdr_len;                /**< length of hdr */
+    uint8_t l2dst[GNRC_NETIF_HDR_L2ADDR_MAX_LEN];   /**< link-layer destination */
+#if GNRC_NETIF_L2ADDR_MAXLEN > 0
+    uint8_t l2addr[GNRC_NETIF_L2ADDR_MAXLEN];   /**< link-layer source */
+    uint8_t l2addr_len;             /**< length of l2addr */
+#endif
+    uint8_t hdr[IPHC_CACHE_HDR_MAX_LEN];    /**< compressed header */
+} _iphc_cache_t;
+
+static _iphc_cache_t _cache[CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE];
+static uint32_t _cache_ctx_gen;
+static unsigned _cache_next;
+
+static bool _cache_match(const _iphc_cache_t *entry,
+                         const gnrc_netif_hdr_t *netif_hdr,
+                         gnrc_netif_t *iface, const ipv6_hdr_t *ipv6_hdr)
+{
+    bool res = true;
+
+    if ((entry->iface != iface) ||
+        (entry->v_tc_fl.u32 != ipv6_hdr->v_tc_fl.u32) ||
+        (entry->nh != ipv6_hdr->nh) || (entry->hl != ipv6_hdr->hl) ||
+        !ipv6_addr_equal(&entry->dst, &ipv6_hdr->dst) ||
+        !ipv6_addr_equal(&entry->src, &ipv6_hdr->src) ||
+        (entry->l2dst_len != netif_hdr->dst_l2addr_len) ||
+        (memcmp(entry->l2dst, gnrc_netif_hdr_get_dst_addr(netif_hdr),
+                entry->l2dst_len) != 0)) {
+        return false;
+    }
+#if GNRC_NETIF_L2ADDR_MAXLEN > 0
+    /* the interface identifier of the source might have changed with the
+     * link-layer address of the interface */
+    gnrc_netif_acquire(iface);
+    res = (entry->l2addr_len == iface->l2addr_len) &&
+          (memcmp(entry->l2addr, iface->l2addr, entry->l2addr_len) == 0);
+    gnrc_netif_release(iface);
+#endif
+    return res;
+}
+
+static const _iphc_cache_t *_cache_lookup(const gnrc_netif_hdr_t *netif_hdr,
+                                          gnrc_netif_t *iface,
+                                          const ipv6_hdr_t *ipv6_hdr)
+{
+    uint32_t ctx_gen = gnrc_sixlowpan_ctx_generation();
+
+    if (ctx_gen != _cache_ctx_gen) {
+        /* compression contexts changed, so every cached header is suspect */
+        DEBUG("6lo iphc: contexts changed, flushing header cache\n");
+        for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE; i++) {
+            _cache[i].iface = NULL;
+        }
+        _cache_ctx_gen = ctx_gen;
+        return NULL;
+    }
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE; i++) {
+        if (_cache_match(&_cache[i], netif_hdr, iface, ipv6_hdr)) {
+            return &_cache[i];
+        }
+    }
+    return NULL;
+}
+
+static void _cache_add(const gnrc_netif_hdr_t *netif_hdr, gnrc_netif_t *iface,
+                       const ipv6_hdr_t *ipv6_hdr, const uint8_t *iphc_hdr,
+                       size_t hdr_len)
+{
+    _iphc_cache_t *entry = &_cache[_cache_next];
+
+    if ((netif_hdr->dst_l2addr_len > sizeof(entry->l2dst)) ||
+        (hdr_len > sizeof(entry->hdr))) {
+        return;
+    }
+    entry->iface = iface;
+    entry->src = ipv6_hdr->src;
+    entry->dst = ipv6_hdr->dst;
+    entry->v_tc_fl = ipv6_hdr->v_tc_fl;
+    entry->nh = ipv6_hdr->nh;
+    entry->hl = ipv6_hdr->hl;
+    entry->l2dst_len = netif_hdr->dst_l2addr_len;
+    memcpy(entry->l2dst, gnrc_netif_hdr_get_dst_addr(netif_hdr),
+           entry->l2dst_len);
+#if GNRC_NETIF_L2ADDR_MAXLEN > 0
+    gnrc_netif_acquire(iface);
+    entry->l2addr_len = iface->l2addr_len;
+    memcpy(entry->l2addr, iface->l2addr, entry->l2addr_len);
+    gnrc_netif_release(iface);
+#endif
+    entry->hdr_len = hdr_len;
+    memcpy(entry->hdr, iphc_hdr, hdr_len);
+    /* replace the flows round robin */
+    _cache_next = (_cache_next + 1) % CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE;
+}
+#endif  /* CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE > 0 */
+
 static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
                                 const gnrc_netif_hdr_t *netif_hdr,
                                 gnrc_netif_t *iface,
@@ -1091,6 +1202,16 @@ static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
     }
     ipv6_hdr = pkt->next->data;
 
+#if CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE > 0
+    const _iphc_cache_t *cached = _cache_lookup(netif_hdr, iface, ipv6_hdr);
+
+    if (cached != NULL) {
+        DEBUG("6lo iphc: using cached header\n");
+        memcpy(iphc_hdr, cached->hdr, cached->hdr_len);
+        return cached->hdr_len;
+    }
+#endif  /* CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE > 0 */
+
     /* set initial dispatch value*/
     iphc_hdr[IPHC1_IDX] = SIXLOWPAN_IPHC1_DISP;
     iphc_hdr[IPHC2_IDX] = 0;
@@ -1369,6 +1490,10 @@ static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
         inline_pos += 16;
     }
 
+#if CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE > 0
+    _cache_add(netif_hdr, iface, ipv6_hdr, iphc_hdr, inline_pos);
+#endif  /* CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE > 0 */
+
     return inline_pos;
 }
 
@@ -1729,6 +1854,14 @@ static gnrc_pktsnip_t *_iphc_encode(gnrc_pktsnip_t *pkt,
     return pkt;
 }
 
+#ifdef TEST_SUITES
+size_t gnrc_sixlowpan_iphc_encode_hdr(gnrc_pktsnip_t *pkt, gnrc_netif_t *iface,
+                                      uint8_t *iphc_hdr)
+{
+    return _iphc_ipv6_encode(pkt, pkt->data, iface, iphc_hdr);
+}
+#endif
+
 void gnrc_sixlowpan_iphc_send(gnrc_pktsnip_t *pkt, void *ctx, unsigned page)
 {
     gnrc_netif_hdr_t *netif_hdr = pkt->data;
@@ -0,0 +1,570 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup net_gnrc_pktbuf
+ * @{
+ *
+ * @file
+ * @brief   Packet buffer implementation using fixed size classes
+ *
+ * Every class is an array of equally sized blocks with a LIFO list of its
+ * free blocks, so allocating and freeing never walks the buffer. Blocks are
+ * never split or merged: a request is served by a block of the smallest
+ * fitting class (or any larger one), the remainder of the block is lost to
+ * internal fragmentation until it is freed.
+ *
+ * A block is owned by exactly one snip, but the snip's data may start
+ * anywhere inside the block (see gnrc_pktbuf_mark()). Hence, the block is
+ * always looked up from the address range its pointer falls into.
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdalign.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/types.h>
+
+#include "container.h"
+#include "mutex.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/nettype.h"
+#include "net/gnrc/pkt.h"
+#include "string_utils.h"
+
+#include "pktbuf_internal.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#define _ALIGN(size)    (((size) + sizeof(uint64_t) - 1) & ~(sizeof(uint64_t) - 1))
+
+#define _SNIP_SIZE      _ALIGN(sizeof(gnrc_pktsnip_t))
+#define _SMALL_SIZE     _ALIGN(CONFIG_GNRC_PKTBUF_SLAB_SMALL_SIZE)
+#define _MEDIUM_SIZE    _ALIGN(CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_SIZE)
+#define _LARGE_SIZE     _ALIGN(CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE)
+
+#define _SNIP_BYTES     (_SNIP_SIZE * CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF)
+#define _SMALL_BYTES    (_SMALL_SIZE * CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF)
+#define _MEDIUM_BYTES   (_MEDIUM_SIZE * CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_NUMOF)
+#define _LARGE_BYTES    (_LARGE_SIZE * CONFIG_GNRC_PKTBUF_SLAB_LARGE_NUMOF)
+
+#define _BLOCKS_NUMOF   (CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF + \
+                         CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF + \
+                         CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_NUMOF + \
+                         CONFIG_GNRC_PKTBUF_SLAB_LARGE_NUMOF)
+
+static_assert((_SNIP_SIZE < _SMALL_SIZE) && (_SMALL_SIZE < _MEDIUM_SIZE) &&
+              (_MEDIUM_SIZE < _LARGE_SIZE),
+              "size classes of gnrc_pktbuf_slab have to be ascending and "
+              "larger than gnrc_pktsnip_t");
+static_assert(_LARGE_SIZE <= UINT16_MAX,
+              "CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE exceeds 65535");
+
+/**
+ * @brief   Header of a free block, linking it into the free list of its class
+ */
+typedef struct _free {
+    struct _free *next;     /**< next free block of the same class */
+} _free_t;
+
+/**
+ * @brief   A size class
+ */
+typedef struct {
+    uint8_t *buf;           /**< first block of the class */
+    uint16_t *len;          /**< bytes requested per block, 0 if free */
+    _free_t *free;          /**< head of the free list */
+    uint16_t size;          /**< block size */
+    uint16_t numof;         /**< number of blocks */
+    uint16_t used;          /**< number of blocks in use */
+#ifdef DEVELHELP
+    uint16_t max_used;      /**< maximum number of blocks in use */
+    uint16_t fallbacks;     /**< requests served by a larger class */
+    uint16_t failures;      /**< requests that could not be served at all */
+#endif
+} _slab_t;
+
+static alignas(uint64_t) uint8_t _slab_buf[_SNIP_BYTES + _SMALL_BYTES +
+                                           _MEDIUM_BYTES + _LARGE_BYTES];
+static uint16_t _slab_len[_BLOCKS_NUMOF];
+
+static _slab_t _slabs[] = {
+    {
+        .buf = &_slab_buf[0],
+        .len = &_slab_len[0],
+        .size = _SNIP_SIZE,
+        .numof = CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF,
+    },
+    {
+        .buf = &_slab_buf[_SNIP_BYTES],
+        .len = &_slab_len[CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF],
+        .size = _SMALL_SIZE,
+        .numof = CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF,
+    },
+    {
+        .buf = &_slab_buf[_SNIP_BYTES + _SMALL_BYTES],
+        .len = &_slab_len[CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF +
+                          CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF],
+        .size = _MEDIUM_SIZE,
+        .numof = CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_NUMOF,
+    },
+    {
+        .buf = &_slab_buf[_SNIP_BYTES + _SMALL_BYTES + _MEDIUM_BYTES],
+        .len = &_slab_len[CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF +
+                          CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF +
+                          CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_NUMOF],
+        .size = _LARGE_SIZE,
+        .numof = CONFIG_GNRC_PKTBUF_SLAB_LARGE_NUMOF,
+    },
+};
+
+#define _SLABS_END  (&_slabs[ARRAY_SIZE(_slabs)])
+
+/* internal gnrc_pktbuf functions */
+static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                    gnrc_nettype_t type);
+static void *_pktbuf_alloc(size_t size);
+
+static inline void _set_pktsnip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *next,
+                                void *data, size_t size, gnrc_nettype_t type)
+{
+    pkt->next = next;
+    pkt->data = data;
+    pkt->size = size;
+    pkt->type = type;
+    pkt->users = 1;
+#ifdef MODULE_GNRC_NETERR
+    pkt->err_sub = KERNEL_PID_UNDEF;
+#endif
+}
+
+/* smallest class fitting size, or _SLABS_END if there is none */
+static _slab_t *_fit(size_t size)
+{
+    _slab_t *slab = &_slabs[0];
+
+    while ((slab < _SLABS_END) && (slab->size < size)) {
+        slab++;
+    }
+    return slab;
+}
+
+/* class the block containing ptr belongs to */
+static _slab_t *_slab_of(const void *ptr)
+{
+    _slab_t *slab = &_slabs[ARRAY_SIZE(_slabs) - 1];
+
+    while ((const uint8_t *)ptr < slab->buf) {
+        slab--;
+    }
+    return slab;
+}
+
+static inline unsigned _block_idx(const _slab_t *slab, const void *ptr)
+{
+    return ((const uint8_t *)ptr - slab->buf) / slab->size;
+}
+
+static inline uint8_t *_block(const _slab_t *slab, unsigned idx)
+{
+    return slab->buf + (idx * slab->size);
+}
+
+/* pops a block of slab, which has to fit size */
+static void *_take(_slab_t *slab, size_t size)
+{
+    _free_t *block = slab->free;
+
+    if (block == NULL) {
+        return NULL;
+    }
+    slab->free = block->next;
+    slab->len[_block_idx(slab, block)] = size;
+    slab->used++;
+#ifdef DEVELHELP
+    if (slab->used > slab->max_used) {
+        slab->max_used = slab->used;
+    }
+#endif
+
+    const void *mismatch;
+    if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE &&
+        (mismatch = memchk(block + 1, GNRC_PKTBUF_CANARY,
+                           slab->size - sizeof(_free_t)))) {
+        printf("[%p] mismatch at offset %" PRIuPTR "/%u"
+               " (ignoring %" PRIuSIZE " initial bytes that were repurposed)\n",
+               (void *)block, (uintptr_t)mismatch - (uintptr_t)block,
+               slab->size, sizeof(_free_t));
+        assert(0);
+    }
+    if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE) {
+        /* clear out canary */
+        memset(block, ~GNRC_PKTBUF_CANARY, slab->size);
+    }
+    return block;
+}
+
+void gnrc_pktbuf_init(void)
+{
+    mutex_lock(&gnrc_pktbuf_mutex);
+    if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE) {
+        memset(_slab_buf, GNRC_PKTBUF_CANARY, sizeof(_slab_buf));
+    }
+    memset(_slab_len, 0, sizeof(_slab_len));
+    for (_slab_t *slab = &_slabs[0]; slab < _SLABS_END; slab++) {
+        slab->free = NULL;
+        slab->used = 0;
+#ifdef DEVELHELP
+        slab->max_used = 0;
+        slab->fallbacks = 0;
+        slab->failures = 0;
+#endif
+        /* push in reverse, so blocks are handed out in ascending order.
+         * We cast to uintptr_t as intermediate step to silence -Wcast-align,
+         * blocks are aligned to 8 byte */
+        for (unsigned i = slab->numof; i > 0; i--) {
+            _free_t *block = (_free_t *)(uintptr_t)_block(slab, i - 1);
+            block->next = slab->free;
+            slab->free = block;
+        }
+    }
+    mutex_unlock(&gnrc_pktbuf_mutex);
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *pkt;
+
+    if (size > _LARGE_SIZE) {
+        DEBUG("pktbuf: size (%" PRIuSIZE ") > CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE (%u)\n",
+              size, (unsigned)_LARGE_SIZE);
+        return NULL;
+    }
+    mutex_lock(&gnrc_pktbuf_mutex);
+    pkt = _create_snip(next, data, size, type);
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return pkt;
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *marked_snip;
+    void *new_data_marked;
+
+    mutex_lock(&gnrc_pktbuf_mutex);
+    if ((size == 0) || (pkt == NULL) || (size > pkt->size) || (pkt->data == NULL)) {
+        DEBUG("pktbuf: size == 0 (was %" PRIuSIZE ") or pkt == NULL (was %p) or "
+              "size > pkt->size (was %" PRIuSIZE ") or pkt->data == NULL (was %p)\n",
+              size, (void *)pkt, (pkt ? pkt->size : 0),
+              (pkt ? pkt->data : NULL));
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return NULL;
+    }
+    /* create new snip descriptor for marked data */
+    marked_snip = _pktbuf_alloc(sizeof(gnrc_pktsnip_t));
+    if (marked_snip == NULL) {
+        DEBUG("pktbuf: could not reallocate marked section.\n");
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return NULL;
+    }
+    if (pkt->size == size) {
+        new_data_marked = pkt->data;
+        pkt->data = NULL;
+    }
+    else {
+        /* a block can not be shared between snips, so the smaller part is
+         * moved to a new block while the larger one remains in place */
+        size_t rest = pkt->size - size;
+        _slab_t *slab = _slab_of(pkt->data);
+        uint16_t *len = &slab->len[_block_idx(slab, pkt->data)];
+        void *moved = _pktbuf_alloc((size <= rest) ? size : rest);
+
+        if (moved == NULL) {
+            DEBUG("pktbuf: could not reallocate marked section.\n");
+            gnrc_pktbuf_free_internal(marked_snip, sizeof(gnrc_pktsnip_t));
+            mutex_unlock(&gnrc_pktbuf_mutex);
+            return NULL;
+        }
+        if (size <= rest) {
+            memcpy(moved, pkt->data, size);
+            new_data_marked = moved;
+            pkt->data = ((uint8_t *)pkt->data) + size;
+            *len = rest;
+        }
+        else {
+            memcpy(moved, ((uint8_t *)pkt->data) + size, rest);
+            new_data_marked = pkt->data;
+            pkt->data = moved;
+            *len = size;
+        }
+    }
+    pkt->size -= size;
+    _set_pktsnip(marked_snip, pkt->next, new_data_marked, size, type);
+    pkt->next = marked_snip;
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return marked_snip;
+}
+
+int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
+{
+    mutex_lock(&gnrc_pktbuf_mutex);
+    assert(pkt != NULL);
+    assert(((pkt->size == 0) && (pkt->data == NULL)) ||
+           ((pkt->size > 0) && (pkt->data != NULL) && gnrc_pktbuf_contains(pkt->data)));
+    /* new size and old size are equal */
+    if (size == pkt->size) {
+        /* nothing to do */
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return 0;
+    }
+    /* new size is 0 and data pointer isn't already NULL */
+    if ((size == 0) && (pkt->data != NULL)) {
+        /* set data pointer to NULL */
+        gnrc_pktbuf_free_internal(pkt->data, pkt->size);
+        pkt->data = NULL;
+    }
+    else {
+        void *new_data = NULL;
+
+        if (pkt->data != NULL) {
+            _slab_t *slab = _slab_of(pkt->data);
+            unsigned idx = _block_idx(slab, pkt->data);
+            size_t offset = (uint8_t *)pkt->data - _block(slab, idx);
+            _slab_t *fit = _fit(size);
+
+            /* move to a smaller block if one is available right away, so
+             * shrunk packets do not hold on to scarce large blocks. Only
+             * when shrinking: only then all of size is valid data */
+            if ((size < pkt->size) && (fit < slab) &&
+                ((new_data = _take(fit, size)) != NULL)) {
+                memcpy(new_data, pkt->data, size);
+                gnrc_pktbuf_free_internal(pkt->data, pkt->size);
+                pkt->data = new_data;
+            }
+            else if ((offset + size) <= slab->size) {
+                slab->len[idx] = size;
+                new_data = pkt->data;
+            }
+        }
+        if (new_data == NULL) {
+            new_data = _pktbuf_alloc(size);
+            if (new_data == NULL) {
+                DEBUG("pktbuf: error allocating new data section\n");
+                mutex_unlock(&gnrc_pktbuf_mutex);
+                return ENOMEM;
+            }
+            if (pkt->data != NULL) {            /* if old data exist */
+                memcpy(new_data, pkt->data, (pkt->size < size) ? pkt->size : size);
+            }
+            gnrc_pktbuf_free_internal(pkt->data, pkt->size);
+            pkt->data = new_data;
+        }
+    }
+    pkt->size = size;
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return 0;
+}
+
+void gnrc_pktbuf_hold(gnrc_pktsnip_t *pkt, unsigned int num)
+{
+    mutex_lock(&gnrc_pktbuf_mutex);
+    while (pkt) {
+        assert(pkt->users + num <= 0xff);
+        pkt->users += num;
+        pkt = pkt->next;
+    }
+    mutex_unlock(&gnrc_pktbuf_mutex);
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_start_write(gnrc_pktsnip_t *pkt)
+{
+    mutex_lock(&gnrc_pktbuf_mutex);
+    if (pkt == NULL) {
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return NULL;
+    }
+
+    if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE &&
+        pkt->users == GNRC_PKTBUF_CANARY) {
+        puts("gnrc_pktbuf: use after free detected\n");
+        DEBUG_BREAKPOINT(3);
+    }
+
+    if (pkt->users > 1) {
+        gnrc_pktsnip_t *new;
+        new = _create_snip(pkt->next, pkt->data, pkt->size, pkt->type);
+        if (new != NULL) {
+            pkt->users--;
+        }
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return new;
+    }
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return pkt;
+}
+
+#ifdef DEVELHELP
+void gnrc_pktbuf_stats(void)
+{
+    mutex_lock(&gnrc_pktbuf_mutex);
+    printf("packet buffer: first byte: %p, last byte: %p (size: %" PRIuSIZE ")\n",
+           (void *)&_slab_buf[0], (void *)&_slab_buf[sizeof(_slab_buf)],
+           sizeof(_slab_buf));
+    puts(" block | numof |  used |   max | fallbacks | failures | fragmented");
+    for (const _slab_t *slab = &_slabs[0]; slab < _SLABS_END; slab++) {
+        unsigned fragmented = 0;
+
+        for (unsigned i = 0; i < slab->numof; i++) {
+            if (slab->len[i] != 0) {
+                fragmented += slab->size - slab->len[i];
+            }
+        }
+        printf(" %5u | %5u | %5u | %5u | %9u | %8u | %10u\n",
+               slab->size, slab->numof, slab->used, slab->max_used,
+               slab->fallbacks, slab->failures, fragmented);
+    }
+    mutex_unlock(&gnrc_pktbuf_mutex);
+}
+#endif
+
+#ifdef TEST_SUITES
+bool gnrc_pktbuf_is_empty(void)
+{
+    for (const _slab_t *slab = &_slabs[0]; slab < _SLABS_END; slab++) {
+        if (slab->used != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool gnrc_pktbuf_is_sane(void)
+{
+    /* Invariants of this implementation:
+     *  - forall blocks in the free list of a class: the block is at a block
+     *    boundary of the class and marked as free
+     *  - the number of blocks in the free list of a class is numof - used
+     */
+    for (const _slab_t *slab = &_slabs[0]; slab < _SLABS_END; slab++) {
+        unsigned free = 0;
+
+        for (const _free_t *ptr = slab->free; ptr; ptr = ptr->next) {
+            const uint8_t *pos = (const uint8_t *)ptr;
+
+            if ((pos < slab->buf) || (pos >= _block(slab, slab->numof)) ||
+                (((pos - slab->buf) % slab->size) != 0) ||
+                (slab->len[_block_idx(slab, ptr)] != 0) ||
+                (++free > slab->numof)) {
+                return false;
+            }
+        }
+        if (free != (unsigned)(slab->numof - slab->used)) {
+            return false;
+        }
+    }
+    return true;
+}
+#endif
+
+static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                    gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *pkt = _pktbuf_alloc(sizeof(gnrc_pktsnip_t));
+    void *_data = NULL;
+
+    if (pkt == NULL) {
+        DEBUG("pktbuf: error allocating new packet snip\n");
+        return NULL;
+    }
+    if (size > 0) {
+        _data = _pktbuf_alloc(size);
+        if (_data == NULL) {
+            DEBUG("pktbuf: error allocating data for new packet snip\n");
+            gnrc_pktbuf_free_internal(pkt, sizeof(gnrc_pktsnip_t));
+            return NULL;
+        }
+        if (data != NULL) {
+            memcpy(_data, data, size);
+        }
+    }
+    _set_pktsnip(pkt, next, _data, size, type);
+    return pkt;
+}
+
+static void *_pktbuf_alloc(size_t size)
+{
+    _slab_t *fit = _fit(size);
+
+    for (_slab_t *slab = fit; slab < _SLABS_END; slab++) {
+        void *block = _take(slab, size);
+
+        if (block != NULL) {
+#ifdef DEVELHELP
+            if (slab != fit) {
+                fit->fallbacks++;
+            }
+#endif
+            return block;
+        }
+    }
+    DEBUG("pktbuf: no block left for %" PRIuSIZE " bytes\n", size);
+#ifdef DEVELHELP
+    if (fit < _SLABS_END) {
+        fit->failures++;
+    }
+#endif
+    return NULL;
+}
+
+void gnrc_pktbuf_free_internal(void *data, size_t size)
+{
+    (void)size;
+
+    if (data == NULL) {
+        return;
+    }
+
+    if (!gnrc_pktbuf_contains(data)) {
+        assert(0);
+        return;
+    }
+
+    _slab_t *slab = _slab_of(data);
+    unsigned idx = _block_idx(slab, data);
+    /* We cast to uintptr_t as intermediate step to silence -Wcast-align */
+    _free_t *block = (_free_t *)(uintptr_t)_block(slab, idx);
+
+    if (slab->len[idx] == 0) {
+        printf("pktbuf: double free detected! (at %p, len=%u)\n",
+               data, slab->size);
+        DEBUG_BREAKPOINT(2);
+        return;
+    }
+    if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE) {
+        memset(block, GNRC_PKTBUF_CANARY, slab->size);
+    }
+    slab->len[idx] = 0;
+    slab->used--;
+    block->next = slab->free;
+    slab->free = block;
+}
+
+bool gnrc_pktbuf_contains(void *ptr)
+{
+    const uintptr_t start = (uintptr_t)_slab_buf;
+    const uintptr_t end = start + sizeof(_slab_buf);
+    uintptr_t pos = (uintptr_t)ptr;
+    return ((pos >= start) && (pos < end));
+}
+
+/** @} */
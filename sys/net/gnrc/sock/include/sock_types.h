@@ -138,6 +138,10 @@ struct sock_udp {
     sock_udp_ep_t local;                   /**< local end-point */
     sock_udp_ep_t remote;                  /**< remote end-point */
     uint16_t flags;                        /**< option flags */
+#if IS_USED(MODULE_SOCK_UDP_BATCH) || defined(DOXYGEN)
+    uint16_t cork_len;                     /**< length of corked payload */
+    gnrc_pktsnip_t *cork;                  /**< corked payload */
+#endif
 };
 
 #ifdef __cplusplus
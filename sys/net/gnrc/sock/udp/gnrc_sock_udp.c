@@ -158,6 +158,12 @@ void sock_udp_close(sock_udp_t *sock)
 {
     assert(sock != NULL);
     gnrc_netreg_unregister(GNRC_NETTYPE_UDP, &sock->reg.entry);
+#if IS_USED(MODULE_SOCK_UDP_BATCH)
+    if (sock->cork != NULL) {
+        gnrc_pktbuf_release(sock->cork);
+        sock->cork = NULL;
+    }
+#endif
 #ifdef SOCK_HAS_ASYNC_CTX
     sock_event_close(sock_udp_get_async_ctx(sock));
 #endif
@@ -330,17 +336,12 @@ ssize_t sock_udp_recv_buf_aux(sock_udp_t *sock, void **data, void **buf_ctx,
     return res;
 }
 
-ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
-                           const iolist_t *snips,
-                           const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux)
+/* resolves the end points to send to from sock, binding it implicitly */
+static int _send_ep(sock_udp_t *sock, const sock_udp_ep_t *remote,
+                    sock_udp_aux_tx_t *aux, sock_ip_ep_t *local,
+                    uint16_t *src_port, sock_udp_ep_t *rem)
 {
     (void)aux;
-    int res;
-    gnrc_pktsnip_t *pkt, *payload = NULL;
-    uint16_t src_port = 0, dst_port;
-    sock_ip_ep_t local;
-    sock_udp_ep_t remote_cpy;
-    sock_ip_ep_t *rem;
 
     assert((sock != NULL) || (remote != NULL));
 
@@ -369,8 +370,8 @@ ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
      * cppcheck is being weird here anyways) */
     if ((sock == NULL) || (sock->local.family == AF_UNSPEC)) {
         /* no sock or sock currently unbound */
-        memset(&local, 0, sizeof(local));
-        if ((src_port = _get_dyn_port(sock)) == GNRC_SOCK_DYN_PORTRANGE_ERR) {
+        memset(local, 0, sizeof(*local));
+        if ((*src_port = _get_dyn_port(sock)) == GNRC_SOCK_DYN_PORTRANGE_ERR) {
             return -EADDRINUSE;
         }
         /* cppcheck-suppress nullPointer
@@ -378,14 +379,14 @@ ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
          * well, see above) */
         if (sock != NULL) {
             /* bind sock object implicitly */
-            sock->local.port = src_port;
+            sock->local.port = *src_port;
             if (remote == NULL) {
                 sock->local.family = sock->remote.family;
             }
             else {
                 sock->local.family = remote->family;
             }
-            gnrc_sock_create(&sock->reg, GNRC_NETTYPE_UDP, src_port);
+            gnrc_sock_create(&sock->reg, GNRC_NETTYPE_UDP, *src_port);
 #ifdef MODULE_GNRC_SOCK_CHECK_REUSE
             /* prepend to current socks */
             sock->reg.next = (gnrc_sock_reg_t *)_udp_socks;
@@ -394,64 +395,197 @@ ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
         }
     }
     else {
-        src_port = sock->local.port;
-        memcpy(&local, &sock->local, sizeof(local));
+        *src_port = sock->local.port;
+        memcpy(local, &sock->local, sizeof(*local));
     }
 #if IS_USED(MODULE_SOCK_AUX_LOCAL)
     /* user supplied local endpoint takes precedent */
     if ((aux != NULL) && (aux->flags & SOCK_AUX_SET_LOCAL)) {
-        local.family = aux->local.family;
-        local.netif = aux->local.netif;
-        src_port = aux->local.port;
-        memcpy(&local.addr, &aux->local.addr, sizeof(local.addr));
+        local->family = aux->local.family;
+        local->netif = aux->local.netif;
+        *src_port = aux->local.port;
+        memcpy(&local->addr, &aux->local.addr, sizeof(local->addr));
 
         aux->flags &= ~SOCK_AUX_SET_LOCAL;
     }
 #endif
     /* sock can't be NULL at this point */
     if (remote == NULL) {
-        rem = (sock_ip_ep_t *)&sock->remote;
-        dst_port = sock->remote.port;
+        memcpy(rem, &sock->remote, sizeof(*rem));
     }
     else {
-        rem = (sock_ip_ep_t *)&remote_cpy;
-        gnrc_ep_set(rem, (sock_ip_ep_t *)remote, sizeof(sock_udp_ep_t));
-        dst_port = remote->port;
+        gnrc_ep_set((sock_ip_ep_t *)rem, (sock_ip_ep_t *)remote,
+                    sizeof(sock_udp_ep_t));
     }
     /* check for matching address families in local and remote */
-    if (local.family == AF_UNSPEC) {
-        local.family = rem->family;
+    if (local->family == AF_UNSPEC) {
+        local->family = rem->family;
     }
-    else if (local.family != rem->family) {
+    else if (local->family != rem->family) {
         return -EINVAL;
     }
+    return 0;
+}
 
-    /* allocate snip for payload */
-    payload = gnrc_pktbuf_add(NULL, NULL, iolist_size(snips), GNRC_NETTYPE_UNDEF);
-    if (payload == NULL) {
-        return -ENOMEM;
-    }
-
-    /* copy payload data into payload snip */
-    iolist_to_buffer(snips, payload->data, payload->size);
+/* sends payload to the end points resolved by _send_ep(), consumes payload */
+static ssize_t _send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
+                     uint16_t src_port, const sock_udp_ep_t *rem)
+{
+    gnrc_pktsnip_t *pkt;
+    ssize_t res;
 
-    pkt = gnrc_udp_hdr_build(payload, src_port, dst_port);
+    pkt = gnrc_udp_hdr_build(payload, src_port, rem->port);
     if (pkt == NULL) {
         gnrc_pktbuf_release(payload);
         return -ENOMEM;
     }
-    res = gnrc_sock_send(pkt, &local, rem, PROTNUM_UDP);
+    res = gnrc_sock_send(pkt, local, (const sock_ip_ep_t *)rem, PROTNUM_UDP);
     if (res > 0) {
         res -= sizeof(udp_hdr_t);
     }
+    return res;
+}
+
+static void _sent(sock_udp_t *sock)
+{
 #ifdef SOCK_HAS_ASYNC
     if ((sock != NULL) && (sock->reg.async_cb.udp)) {
         sock->reg.async_cb.udp(sock, SOCK_ASYNC_MSG_SENT,
                                sock->reg.async_cb_arg);
     }
+#else
+    (void)sock;
 #endif  /* SOCK_HAS_ASYNC */
+}
+
+static gnrc_pktsnip_t *_payload(const iolist_t *snips)
+{
+    gnrc_pktsnip_t *payload;
+
+    /* allocate snip for payload */
+    payload = gnrc_pktbuf_add(NULL, NULL, iolist_size(snips), GNRC_NETTYPE_UNDEF);
+    if (payload != NULL) {
+        /* copy payload data into payload snip */
+        iolist_to_buffer(snips, payload->data, payload->size);
+    }
+    return payload;
+}
+
+ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
+                           const iolist_t *snips,
+                           const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux)
+{
+    gnrc_pktsnip_t *payload;
+    uint16_t src_port = 0;
+    sock_ip_ep_t local;
+    sock_udp_ep_t rem;
+    ssize_t res;
+
+    if ((res = _send_ep(sock, remote, aux, &local, &src_port, &rem)) < 0) {
+        return res;
+    }
+    if ((payload = _payload(snips)) == NULL) {
+        return -ENOMEM;
+    }
+    res = _send(payload, &local, src_port, &rem);
+    _sent(sock);
+    return res;
+}
+
+#if IS_USED(MODULE_SOCK_UDP_BATCH)
+ssize_t sock_udp_sendv_batch_aux(sock_udp_t *sock,
+                                 const iolist_t *const *msgs, unsigned numof,
+                                 const sock_udp_ep_t *remote,
+                                 sock_udp_aux_tx_t *aux)
+{
+    uint16_t src_port = 0;
+    sock_ip_ep_t local;
+    sock_udp_ep_t rem;
+    ssize_t res;
+    unsigned sent = 0;
+
+    assert((numof == 0) || (msgs != NULL));
+    if ((res = _send_ep(sock, remote, aux, &local, &src_port, &rem)) < 0) {
+        return res;
+    }
+    for (; sent < numof; sent++) {
+        gnrc_pktsnip_t *payload = _payload(msgs[sent]);
+
+        if (payload == NULL) {
+            res = -ENOMEM;
+            break;
+        }
+        if ((res = _send(payload, &local, src_port, &rem)) < 0) {
+            break;
+        }
+    }
+    if (sent > 0) {
+        _sent(sock);
+        return sent;
+    }
+    return (numof > 0) ? res : 0;
+}
+
+int sock_udp_cork(sock_udp_t *sock, size_t max_len)
+{
+    assert(sock != NULL);
+    if (sock->cork != NULL) {
+        return -EALREADY;
+    }
+    if (max_len > UINT16_MAX) {
+        return -ENOMEM;
+    }
+    sock->cork = gnrc_pktbuf_add(NULL, NULL, max_len, GNRC_NETTYPE_UNDEF);
+    if (sock->cork == NULL) {
+        return -ENOMEM;
+    }
+    sock->cork_len = 0;
+    return 0;
+}
+
+ssize_t sock_udp_cork_appendv(sock_udp_t *sock, const iolist_t *snips)
+{
+    size_t len = iolist_size(snips);
+
+    assert(sock != NULL);
+    if (sock->cork == NULL) {
+        return -ENOENT;
+    }
+    if (len > (sock->cork->size - sock->cork_len)) {
+        return -ENOBUFS;
+    }
+    iolist_to_buffer(snips, (uint8_t *)sock->cork->data + sock->cork_len, len);
+    sock->cork_len += len;
+    return sock->cork_len;
+}
+
+ssize_t sock_udp_uncork_aux(sock_udp_t *sock, const sock_udp_ep_t *remote,
+                            sock_udp_aux_tx_t *aux)
+{
+    gnrc_pktsnip_t *payload;
+    uint16_t src_port = 0;
+    sock_ip_ep_t local;
+    sock_udp_ep_t rem;
+    ssize_t res;
+
+    assert(sock != NULL);
+    if ((payload = sock->cork) == NULL) {
+        return -ENOENT;
+    }
+    sock->cork = NULL;
+    if ((res = _send_ep(sock, remote, aux, &local, &src_port, &rem)) < 0) {
+        gnrc_pktbuf_release(payload);
+        return res;
+    }
+    /* only gives back the unused tail of the payload */
+    gnrc_pktbuf_realloc_data(payload, sock->cork_len);
+    res = _send(payload, &local, src_port, &rem);
+    if (res >= 0) {
+        _sent(sock);
+    }
     return res;
 }
+#endif /* MODULE_SOCK_UDP_BATCH */
 
 #ifdef SOCK_HAS_ASYNC
 void sock_udp_set_cb(sock_udp_t *sock, sock_udp_cb_t cb, void *arg)
@@ -24,6 +24,7 @@
 
 #include "evtimer.h"
 #include "evtimer_mbox.h"
+#include "irq.h"
 #include "mbox.h"
 #include "net/af.h"
 #include "net/tcp.h"
@@ -101,9 +102,11 @@ static void _close(gnrc_tcp_tcb_t *tcb)
     /* Start connection teardown sequence */
     _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_CLOSE, NULL, NULL, 0);
 
-    /* Loop until the connection has been closed */
+    /* Loop until the connection has been closed. A listening TCB might already handle
+     * the next connection, returning to LISTEN cleared its ACCEPTED flag. */
     state = _gnrc_tcp_fsm_get_state(tcb);
-    while ((state != FSM_STATE_CLOSED) && (state != FSM_STATE_LISTEN)) {
+    while ((state != FSM_STATE_CLOSED) && (state != FSM_STATE_LISTEN) &&
+           (!(tcb->status & STATUS_LISTENING) || (tcb->status & STATUS_ACCEPTED))) {
         mbox_get(&mbox, &msg);
         switch (msg.type) {
             case MSG_TYPE_CONNECTION_TIMEOUT:
@@ -335,6 +338,7 @@ void gnrc_tcp_tcb_queue_init(gnrc_tcp_tcb_queue_t *queue)
     mutex_init(&queue->lock);
     queue->tcbs = NULL;
     queue->tcbs_len = 0;
+    memset(&queue->stats, 0, sizeof(queue->stats));
     TCP_DEBUG_LEAVE;
 }
 
@@ -426,10 +430,7 @@ int gnrc_tcp_open(gnrc_tcp_tcb_t *tcb, const gnrc_tcp_ep_t *remote, uint16_t loc
 
     /* Call FSM with event: CALL_OPEN */
     int ret = _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_OPEN, NULL, NULL, 0);
-    if (ret == -ENOMEM) {
-        TCP_DEBUG_ERROR("-ENOMEM: All receive buffers are in use.");
-    }
-    else if (ret == -EADDRINUSE) {
+    if (ret == -EADDRINUSE) {
         TCP_DEBUG_ERROR("-EADDRINUSE: local_port is already in use.");
     }
 
@@ -527,6 +528,7 @@ int gnrc_tcp_listen(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t *tcbs, size_t tc
             }
 #endif
             tcb->local_port = local->port;
+            tcb->queue = queue;
             tcb->status |= STATUS_LISTENING;
 
             /* Open connection */
@@ -537,6 +539,7 @@ int gnrc_tcp_listen(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t *tcbs, size_t tc
         if (ret) {
             for (size_t j = 0; j <= i; ++j) {
                 tcb->status &= ~(STATUS_LISTENING);
+                tcb->queue = NULL;
                 _abort(tcb);
             }
             break;
@@ -557,49 +560,83 @@ int gnrc_tcp_listen(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t *tcbs, size_t tc
     return ret;
 }
 
-int gnrc_tcp_accept(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t **tcb,
-                    const uint32_t user_timeout_duration_ms)
+/**
+ * @brief Marks established connections of a listening queue as accepted.
+ *
+ * @param[in,out] queue      Listening queue to accept connections from.
+ * @param[out]    tcbs       Array receiving the accepted TCBs.
+ * @param[in]     tcbs_len   Maximum number of connections to accept.
+ * @param[out]    avail      If not NULL, incremented for every TCB that is neither
+ *                           accepted nor established.
+ *
+ * @returns   Number of accepted connections.
+ */
+static size_t _accept_established(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t **tcbs,
+                                  size_t tcbs_len, size_t *avail)
 {
-    TCP_DEBUG_ENTER;
-    assert(queue != NULL);
-    assert(tcb != NULL);
+    size_t found = 0;
 
-    int ret = 0;
-    int avail_tcbs = 0;
-    msg_t msg;
-    msg_t msg_queue[TCP_MSG_QUEUE_SIZE];
-    mbox_t mbox = MBOX_INIT(msg_queue, TCP_MSG_QUEUE_SIZE);
-    evtimer_mbox_event_t event_user_timeout;
-    gnrc_tcp_tcb_t *tmp = NULL;
-    _gnrc_tcp_fsm_state_t state = 0;
-
-    /* Search for non-accepted established connections */
-    *tcb = NULL;
-    mutex_lock(&queue->lock);
-    for (size_t i = 0; i < queue->tcbs_len; ++i) {
-        tmp = &(queue->tcbs[i]);
+    for (size_t i = 0; i < queue->tcbs_len && found < tcbs_len; ++i) {
+        gnrc_tcp_tcb_t *tmp = &(queue->tcbs[i]);
 
         if (tmp->status & STATUS_ACCEPTED) {
             continue;
         }
 
-        state = _gnrc_tcp_fsm_get_state(tmp);
+        _gnrc_tcp_fsm_state_t state = _gnrc_tcp_fsm_get_state(tmp);
         if (state == FSM_STATE_ESTABLISHED || state == FSM_STATE_CLOSE_WAIT) {
             tmp->status |= STATUS_ACCEPTED;
-            *tcb = tmp;
-            break;
+            tcbs[found++] = tmp;
+        }
+        else if (avail) {
+            ++(*avail);
         }
-        ++avail_tcbs;
     }
+    unsigned state = irq_disable();
+    queue->stats.accepted += found;
+    irq_restore(state);
+    return found;
+}
+
+/**
+ * @brief Accepts up to @p tcbs_len established connections from a listening queue.
+ *
+ * @param[in,out] queue                      Listening queue to accept connections from.
+ * @param[out]    tcbs                       Array receiving the accepted TCBs.
+ * @param[in]     tcbs_len                   Maximum number of connections to accept.
+ * @param[in]     user_timeout_duration_ms   User specified timeout in milliseconds.
+ *
+ * @returns   Number of accepted connections on success.
+ *            -ENOMEM if all connection in @p queue were already accepted.
+ *            -EINVAL if listen was never called on queue.
+ *            -EAGAIN if @p user_timeout_duration_ms was 0 and no connection is ready.
+ *            -ETIMEDOUT if @p user_timeout_duration_ms expired.
+ */
+static int _accept(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t **tcbs, size_t tcbs_len,
+                   const uint32_t user_timeout_duration_ms)
+{
+    int ret = 0;
+    size_t found = 0;
+    size_t avail_tcbs = 0;
+    msg_t msg;
+    msg_t msg_queue[TCP_MSG_QUEUE_SIZE];
+    mbox_t mbox = MBOX_INIT(msg_queue, TCP_MSG_QUEUE_SIZE);
+    evtimer_mbox_event_t event_user_timeout;
+    gnrc_tcp_tcb_t *tmp = NULL;
+
+    /* Search for non-accepted established connections */
+    tcbs[0] = NULL;
+    mutex_lock(&queue->lock);
+    found = _accept_established(queue, tcbs, tcbs_len, &avail_tcbs);
 
     /* Return if a connection was found, queue is not listening, accept was called as non-blocking
      * or all TCBs were already accepted.
      */
-    if ((*tcb) || (queue->tcbs == NULL) || (user_timeout_duration_ms == 0) ||
+    if ((found) || (queue->tcbs == NULL) || (user_timeout_duration_ms == 0) ||
        (avail_tcbs == 0)) {
-        if (*tcb) {
+        if (found) {
             TCP_DEBUG_INFO("Accepting connection.");
-            ret = 0;
+            ret = found;
         }
         else if (queue->tcbs == NULL) {
             TCP_DEBUG_ERROR("-EINVAL: Queue is not listening.");
@@ -614,7 +651,6 @@ int gnrc_tcp_accept(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t **tcb,
             ret = -EAGAIN;
         }
         mutex_unlock(&queue->lock);
-        TCP_DEBUG_LEAVE;
         return ret;
     }
 
@@ -630,6 +666,9 @@ int gnrc_tcp_accept(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t **tcb,
         }
     }
 
+    /* Search again: A connection established before the mbox was set up notified no one */
+    found = _accept_established(queue, tcbs, tcbs_len, NULL);
+
     /* Setup User specified Timeout */
     if (user_timeout_duration_ms != GNRC_TCP_NO_TIMEOUT) {
         _sched_mbox(&event_user_timeout, user_timeout_duration_ms,
@@ -637,18 +676,14 @@ int gnrc_tcp_accept(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t **tcb,
     }
 
     /* Wait until a connection was established */
-    while (ret >= 0 && *tcb == NULL) {
+    while (ret >= 0 && found == 0) {
         mbox_get(&mbox, &msg);
         switch (msg.type) {
             case MSG_TYPE_NOTIFY_USER:
                 TCP_DEBUG_INFO("Received MSG_TYPE_NOTIFY_USER.");
 
-                tmp = (gnrc_tcp_tcb_t *) msg.content.ptr;
-                state = _gnrc_tcp_fsm_get_state(tmp);
-                if (state == FSM_STATE_ESTABLISHED || state == FSM_STATE_CLOSE_WAIT) {
-                    tmp->status |= STATUS_ACCEPTED;
-                    *tcb = tmp;
-                }
+                /* Collect every connection established so far, not only the notifying one */
+                found = _accept_established(queue, tcbs, tcbs_len, NULL);
                 break;
 
             case MSG_TYPE_USER_SPEC_TIMEOUT:
@@ -674,6 +709,30 @@ int gnrc_tcp_accept(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t **tcb,
         }
     }
     mutex_unlock(&queue->lock);
+    return (ret < 0) ? ret : (int)found;
+}
+
+int gnrc_tcp_accept(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t **tcb,
+                    const uint32_t user_timeout_duration_ms)
+{
+    TCP_DEBUG_ENTER;
+    assert(queue != NULL);
+    assert(tcb != NULL);
+
+    int ret = _accept(queue, tcb, 1, user_timeout_duration_ms);
+    TCP_DEBUG_LEAVE;
+    return (ret < 0) ? ret : 0;
+}
+
+int gnrc_tcp_accept_multi(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t **tcbs, size_t tcbs_len,
+                          const uint32_t user_timeout_duration_ms)
+{
+    TCP_DEBUG_ENTER;
+    assert(queue != NULL);
+    assert(tcbs != NULL);
+    assert(tcbs_len > 0);
+
+    int ret = _accept(queue, tcbs, tcbs_len, user_timeout_duration_ms);
     TCP_DEBUG_LEAVE;
     return ret;
 }
@@ -725,8 +784,8 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
                     MSG_TYPE_USER_SPEC_TIMEOUT, &mbox);
     }
 
-    /* Loop until something was sent and acked */
-    while (ret == 0 || tcb->pkt_retransmit != NULL) {
+    /* Loop until something was sent and everything sent was acked */
+    while (ret == 0 || tcb->rtx_len > 0) {
         state = _gnrc_tcp_fsm_get_state(tcb);
 
         /* Check if the connections state is closed. If so, a reset was received */
@@ -749,9 +808,14 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
                         MSG_TYPE_PROBE_TIMEOUT, &mbox);
         }
 
-        /* Try to send data in case there nothing has been sent and we are not probing */
-        if (ret == 0 && !probing_mode) {
-            ret = _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_SEND, NULL, (void *) data, len);
+        /* Send as much data as windows and retransmit queue allow, if we are not probing */
+        while (ret >= 0 && (size_t) ret < len && !probing_mode) {
+            ssize_t sent = _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_SEND, NULL,
+                                         (uint8_t *) data + ret, len - ret);
+            if (sent <= 0) {
+                break;
+            }
+            ret += sent;
         }
 
         /* Wait for responses */
@@ -973,6 +1037,7 @@ void gnrc_tcp_stop_listen(gnrc_tcp_tcb_queue_t *queue)
 
         /* Clear LISTENING status causing re-opening on close */
         tcb->status &= ~(STATUS_LISTENING);
+        tcb->queue = NULL;
         _close(tcb);
 
         mutex_unlock(&(tcb->function_lock));
@@ -1092,6 +1157,20 @@ int gnrc_tcp_queue_get_local(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_ep_t *ep)
     return ret;
 }
 
+void gnrc_tcp_queue_get_stats(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_queue_stats_t *stats)
+{
+    TCP_DEBUG_ENTER;
+    assert(queue != NULL);
+    assert(stats != NULL);
+
+    /* The queue lock is held by blocking accept calls: The statistics are updated
+     * and read with interrupts disabled instead */
+    unsigned state = irq_disable();
+    *stats = queue->stats;
+    irq_restore(state);
+    TCP_DEBUG_LEAVE;
+}
+
 int gnrc_tcp_calc_csum(const gnrc_pktsnip_t *hdr, const gnrc_pktsnip_t *pseudo_hdr)
 {
     TCP_DEBUG_ENTER;
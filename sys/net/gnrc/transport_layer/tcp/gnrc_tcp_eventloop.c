@@ -20,6 +20,7 @@
 #include <assert.h>
 #include <utlist.h>
 #include <errno.h>
+#include "irq.h"
 #include "net/af.h"
 #include "net/tcp.h"
 #include "net/gnrc.h"
@@ -101,6 +102,76 @@ static int _send(gnrc_pktsnip_t *pkt)
     return 0;
 }
 
+#ifdef MODULE_GNRC_IPV6
+/**
+ * @brief Admits a SYN that matched no connection to a listening queue.
+ *
+ * @pre The TCB list is locked.
+ *
+ * @param[in] head        First TCB of the TCB list.
+ * @param[in] listening   TCB in LISTEN state that matched the SYN, or NULL.
+ * @param[in] addr        Destination address of the SYN.
+ * @param[in] port        Destination port of the SYN.
+ *
+ * @returns   true if the SYN is dropped because the queue listening on @p addr and @p port
+ *            has no TCB in LISTEN state or a full backlog.
+ *            false otherwise.
+ */
+static bool _syn_dropped(gnrc_tcp_tcb_t *head, gnrc_tcp_tcb_t *listening,
+                         const ipv6_addr_t *addr, uint16_t port)
+{
+    gnrc_tcp_tcb_queue_t *queue = NULL;
+    bool dropped = (listening == NULL);
+
+    /* Find the queue of the SYNs destination, its TCBs may all be busy */
+    if (listening) {
+        queue = listening->queue;
+    }
+    else {
+        for (gnrc_tcp_tcb_t *iter = head; iter; iter = iter->next) {
+            if (iter->queue && iter->local_port == port &&
+                ((iter->status & STATUS_ALLOW_ANY_ADDR) ||
+                 ipv6_addr_equal((ipv6_addr_t *) iter->local_addr, addr))) {
+                queue = iter->queue;
+                break;
+            }
+        }
+    }
+
+    /* No queue: Not our business, the caller answers with a reset */
+    if (queue == NULL) {
+        return false;
+    }
+
+    /* Count connections of the queue that are being established or wait to be accepted */
+    if (listening && CONFIG_GNRC_TCP_LISTEN_BACKLOG) {
+        unsigned backlog = 0;
+
+        for (gnrc_tcp_tcb_t *iter = head; iter; iter = iter->next) {
+            _gnrc_tcp_fsm_state_t state = _gnrc_tcp_fsm_get_state(iter);
+
+            if (iter->queue == queue && !(iter->status & STATUS_ACCEPTED) &&
+                (state == FSM_STATE_SYN_RCVD || state == FSM_STATE_ESTABLISHED ||
+                 state == FSM_STATE_CLOSE_WAIT)) {
+                ++backlog;
+            }
+        }
+        dropped = (backlog + 1 > CONFIG_GNRC_TCP_LISTEN_BACKLOG);
+    }
+
+    /* The statistics are read without the queue lock, see gnrc_tcp_queue_get_stats() */
+    unsigned state = irq_disable();
+    if (dropped) {
+        queue->stats.syn_dropped++;
+    }
+    else {
+        queue->stats.syn_rcvd++;
+    }
+    irq_restore(state);
+    return dropped;
+}
+#endif
+
 /**
  * @brief Receive function, receive packet from network layer.
  *
@@ -114,6 +185,7 @@ static int _send(gnrc_pktsnip_t *pkt)
  *            -ENOMSG if packet couldn't be marked.
  *            -EINVAL if checksum was invalid.
  *            -ENOTCONN if no TCB is interested in @p pkt.
+ *            -ENOBUFS if @p pkt is a SYN exceeding the backlog of a listening queue.
  */
 static int _receive(gnrc_pktsnip_t *pkt)
 {
@@ -209,6 +281,7 @@ static int _receive(gnrc_pktsnip_t *pkt)
 
     /* Find TCB to for this packet */
     _gnrc_tcp_common_tcb_list_t *list = _gnrc_tcp_common_get_tcb_list();
+    gnrc_tcp_tcb_t *listening = NULL;
     mutex_lock(&list->lock);
     tcb = list->head;
     while (tcb) {
@@ -218,17 +291,19 @@ static int _receive(gnrc_pktsnip_t *pkt)
             /* If SYN is set, a connection is listening on that port ... */
             ipv6_addr_t *tmp_addr = NULL;
             _gnrc_tcp_fsm_state_t state = _gnrc_tcp_fsm_get_state(tcb);
-            if (syn && tcb->local_port == dst && state == FSM_STATE_LISTEN) {
+            if (syn && !listening && tcb->local_port == dst && state == FSM_STATE_LISTEN) {
                 /* ... and local addr is unspec or pre configured */
                 tmp_addr = &((ipv6_hdr_t *)ip->data)->dst;
                 if (ipv6_addr_equal((ipv6_addr_t *) tcb->local_addr, (ipv6_addr_t *) tmp_addr) ||
                     ipv6_addr_is_unspecified((ipv6_addr_t *) tcb->local_addr)) {
-                    break;
+                    /* ... unless the SYN is a retransmission for a known connection */
+                    listening = tcb;
                 }
             }
 
-            /* If SYN is not set and the ports match ... */
-            if (!syn && tcb->local_port == dst && tcb->peer_port == src) {
+            /* If SYN is not set or the connection is not listening and the ports match ... */
+            if ((!syn || state != FSM_STATE_LISTEN) &&
+                tcb->local_port == dst && tcb->peer_port == src) {
                 /* .. and the IPv6 addresses match */
                 tmp_addr = &((ipv6_hdr_t * )ip->data)->src;
                 if (ipv6_addr_equal((ipv6_addr_t *) tcb->peer_addr, (ipv6_addr_t *) tmp_addr)) {
@@ -245,6 +320,19 @@ static int _receive(gnrc_pktsnip_t *pkt)
 #endif
         tcb = tcb->next;
     }
+    if (tcb == NULL) {
+#ifdef MODULE_GNRC_IPV6
+        /* Drop SYNs exceeding the backlog without a reset, the peer retries later */
+        if (syn && _syn_dropped(list->head, listening, &((ipv6_hdr_t *)ip->data)->dst, dst)) {
+            mutex_unlock(&list->lock);
+            gnrc_pktbuf_release(pkt);
+            TCP_DEBUG_ERROR("-ENOBUFS: Listen backlog is full.");
+            TCP_DEBUG_LEAVE;
+            return -ENOBUFS;
+        }
+#endif
+        tcb = listening;
+    }
     mutex_unlock(&list->lock);
 
     /* Call FSM with event RCVD_PKT if a fitting TCB was found */
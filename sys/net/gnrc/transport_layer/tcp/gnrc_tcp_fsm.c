@@ -92,15 +92,158 @@ static uint16_t _get_random_local_port(void)
 static int _clear_retransmit(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
-    if (tcb->pkt_retransmit != NULL) {
+    if (tcb->rtx_len > 0) {
         _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
-        gnrc_pktbuf_release(tcb->pkt_retransmit);
-        tcb->pkt_retransmit = NULL;
+        while (tcb->rtx_len > 0) {
+            gnrc_pktbuf_release(tcb->pkt_retransmit[--tcb->rtx_len]);
+        }
+        tcb->rtx_sacked = 0;
     }
+    tcb->status &= ~STATUS_RTT_PENDING;
     TCP_DEBUG_LEAVE;
     return 0;
 }
 
+/**
+ * @brief Sets the initial congestion control state (RFC 5681, 3.1).
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _init_congestion_control(gnrc_tcp_tcb_t *tcb)
+{
+    uint32_t smss = _gnrc_tcp_pkt_get_smss(tcb);
+
+    /* IW = min(4 * SMSS, max(2 * SMSS, 4380 bytes)) */
+    tcb->cwnd = (2 * smss > 4380) ? 2 * smss : 4380;
+    tcb->cwnd = (tcb->cwnd < 4 * smss) ? tcb->cwnd : 4 * smss;
+    tcb->ssthresh = UINT32_MAX;
+    tcb->dup_acks = 0;
+    tcb->status &= ~(STATUS_RECOVERY | STATUS_FAST_RECOVERY);
+}
+
+/**
+ * @brief Halves the congestion window after a loss and starts loss recovery.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _enter_recovery(gnrc_tcp_tcb_t *tcb)
+{
+    uint32_t smss = _gnrc_tcp_pkt_get_smss(tcb);
+    uint32_t flight = tcb->snd_nxt - tcb->snd_una;
+
+    /* ssthresh = max(FlightSize / 2, 2 * SMSS) (RFC 5681, 3.1) */
+    tcb->ssthresh = (flight / 2 > 2 * smss) ? flight / 2 : 2 * smss;
+    tcb->recover = tcb->snd_nxt;
+    tcb->rtx_high = tcb->snd_una;
+    tcb->status |= STATUS_RECOVERY;
+}
+
+/**
+ * @brief Retransmits the first segment that was neither selectively acknowledged
+ *        nor retransmitted since loss recovery started.
+ *
+ * @param[in,out] tcb         TCB holding the connection information.
+ * @param[in]     hole_only   Retransmit the segment only if the peer selectively
+ *                            acknowledged data behind it.
+ */
+static void _retransmit_next(gnrc_tcp_tcb_t *tcb, bool hole_only)
+{
+    for (unsigned i = 0; i < tcb->rtx_len; i++) {
+        gnrc_pktsnip_t *pkt = tcb->pkt_retransmit[i];
+        uint32_t end = _gnrc_tcp_pkt_get_seq_num(pkt) + _gnrc_tcp_pkt_get_seg_len(pkt);
+
+        if ((tcb->rtx_sacked & (1UL << i)) || LEQ_32_BIT(end, tcb->rtx_high)) {
+            continue;
+        }
+        if (hole_only && !(tcb->rtx_sacked >> i)) {
+            return;
+        }
+        tcb->rtx_high = end;
+        _gnrc_tcp_pkt_retransmit(tcb, i);
+        return;
+    }
+}
+
+/**
+ * @brief Congestion control on an acknowledgment of new data (RFC 5681, RFC 6582).
+ *
+ * @param[in,out] tcb     TCB holding the connection information.
+ * @param[in]     acked   Number of newly acknowledged bytes.
+ */
+static void _on_ack(gnrc_tcp_tcb_t *tcb, uint32_t acked)
+{
+    uint32_t smss = _gnrc_tcp_pkt_get_smss(tcb);
+
+    tcb->dup_acks = 0;
+    if (tcb->status & STATUS_RECOVERY) {
+        /* Full acknowledgment: Leave loss recovery, deflate the window */
+        if (LEQ_32_BIT(tcb->recover, tcb->snd_una)) {
+            if (tcb->status & STATUS_FAST_RECOVERY) {
+                tcb->cwnd = tcb->ssthresh;
+                tcb->status &= ~(STATUS_RECOVERY | STATUS_FAST_RECOVERY);
+                return;
+            }
+            tcb->status &= ~STATUS_RECOVERY;
+        }
+        /* Partial acknowledgment: The next segment is missing as well */
+        else {
+            _retransmit_next(tcb, false);
+            if (tcb->status & STATUS_FAST_RECOVERY) {
+                /* Deflate by the amount acknowledged, add back what was retransmitted */
+                tcb->cwnd = ((tcb->cwnd > acked) ? tcb->cwnd - acked : 0) + smss;
+                return;
+            }
+        }
+    }
+    /* Slow start or congestion avoidance */
+    if (tcb->cwnd < tcb->ssthresh) {
+        tcb->cwnd += (acked < smss) ? acked : smss;
+    }
+    else {
+        tcb->cwnd += (smss * smss >= tcb->cwnd) ? (smss * smss) / tcb->cwnd : 1;
+    }
+}
+
+/**
+ * @brief Congestion control on a duplicate acknowledgment (RFC 5681, RFC 6582,
+ *        RFC 5827).
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _on_dup_ack(gnrc_tcp_tcb_t *tcb)
+{
+    uint32_t smss = _gnrc_tcp_pkt_get_smss(tcb);
+    unsigned thresh = CONFIG_GNRC_TCP_DUP_ACK_THRESHOLD;
+
+    /* Early retransmit: with less than four segments outstanding, the
+     * threshold can't be reached. Limited transmit can't be used instead,
+     * unsent data is only known to the calling user thread. */
+    if (tcb->rtx_len > 1 && tcb->rtx_len < 4 && tcb->rtx_len - 1U < thresh) {
+        thresh = tcb->rtx_len - 1U;
+    }
+
+    /* Every duplicate ACK signals that a segment left the network */
+    if (tcb->status & STATUS_FAST_RECOVERY) {
+        tcb->cwnd += smss;
+        if (tcb->status & STATUS_SACK_PERMITTED) {
+            _retransmit_next(tcb, true);
+        }
+        return;
+    }
+    if (tcb->dup_acks < thresh) {
+        tcb->dup_acks += 1;
+    }
+    /* Don't react twice on losses in the same window of data */
+    if (tcb->dup_acks < thresh || (tcb->status & STATUS_RECOVERY)) {
+        return;
+    }
+    /* Fast retransmit, continue with fast recovery */
+    _enter_recovery(tcb);
+    tcb->status |= STATUS_FAST_RECOVERY;
+    _retransmit_next(tcb, false);
+    tcb->cwnd = tcb->ssthresh + tcb->dup_acks * smss;
+}
+
 /**
  * @brief Restarts timewait timer.
  *
@@ -148,8 +291,9 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
 
     switch (state) {
         case FSM_STATE_CLOSED:
-            /* Clear retransmit queue */
+            /* Clear retransmit queue and out-of-order segments */
             _clear_retransmit(tcb);
+            _gnrc_tcp_rcvbuf_clear_ooo(tcb);
 
             /* Close connection if not listenng */
             if (!(tcb->status & STATUS_LISTENING))
@@ -188,6 +332,9 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
 #endif
             tcb->peer_port = PORT_UNSPEC;
 
+            /* Return data left from a previous connection to the pool */
+            _gnrc_tcp_rcvbuf_release_buffer(tcb);
+
             /* Add connection to active connections (if not already active) */
             mutex_lock(&list->lock);
             LL_SEARCH(list->head, iter, tcb, TCB_EQUAL);
@@ -233,6 +380,10 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
 
         case FSM_STATE_ESTABLISHED:
         case FSM_STATE_CLOSE_WAIT:
+            /* Connection was just established: Initialize congestion control */
+            if (tcb->state == FSM_STATE_SYN_SENT || tcb->state == FSM_STATE_SYN_RCVD) {
+                _init_congestion_control(tcb);
+            }
             /* Stop timeout for listening TCBs */
             if (tcb->status & STATUS_LISTENING) {
                 _gnrc_tcp_eventloop_unsched(&tcb->event_timeout);
@@ -258,7 +409,6 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
  * @param[in,out] tcb   TCB holding the connection information.
  *
  * @returns   Zero on success.
- *            -ENOMEM if receive buffer could not be allocated.
  *            -EADDRINUSE if given local port number is already in use.
  */
 static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
@@ -266,14 +416,8 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
     TCP_DEBUG_ENTER;
     int ret = 0;
 
-    /* Allocate receive buffer */
-    if (_gnrc_tcp_rcvbuf_get_buffer(tcb) == -ENOMEM) {
-        TCP_DEBUG_ERROR("-ENOMEM: Can't allocate receive buffer.");
-        TCP_DEBUG_LEAVE;
-        return -ENOMEM;
-    }
-
-    tcb->rcv_wnd = CONFIG_GNRC_TCP_DEFAULT_WINDOW;
+    /* Receive buffer blocks are taken from the pool when data arrives */
+    tcb->rcv_wnd = _gnrc_tcp_rcvbuf_get_window(tcb);
 
     if (tcb->status & STATUS_LISTENING) {
         /* Passive open, T: CLOSED -> LISTEN */
@@ -317,10 +461,13 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
 static int _fsm_call_send(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
 {
     TCP_DEBUG_ENTER;
-    size_t payload = (tcb->snd_una + tcb->snd_wnd) - tcb->snd_nxt;
+    uint32_t wnd = (tcb->cwnd < tcb->snd_wnd) ? tcb->cwnd : tcb->snd_wnd;
+    uint32_t flight = tcb->snd_nxt - tcb->snd_una;
+    size_t payload = (flight < wnd) ? wnd - flight : 0;
 
-    /* Check if window is open and all packets were transmitted */
-    if (payload > 0 && tcb->snd_wnd > 0 && tcb->pkt_retransmit == NULL) {
+    /* Check if window is open and the retransmit queue takes another packet */
+    if (payload > 0 && tcb->snd_wnd > 0 &&
+        tcb->rtx_len < CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE) {
         /* Calculate segment size */
         payload = (payload < CONFIG_GNRC_TCP_MSS) ? payload : CONFIG_GNRC_TCP_MSS;
         payload = (payload < tcb->mss) ? payload : tcb->mss;
@@ -353,24 +500,30 @@ static int _fsm_call_recv(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
 {
     TCP_DEBUG_ENTER;
 
-    if (ringbuffer_empty(&tcb->rcv_buf)) {
+    if (tcb->rcv_buf_len == 0) {
         TCP_DEBUG_LEAVE;
         return 0;
     }
 
     /* Read data into 'buf' up to 'len' bytes from receive buffer */
-    size_t rcvd = ringbuffer_get(&(tcb->rcv_buf), buf, len);
+    size_t rcvd = _gnrc_tcp_rcvbuf_get(tcb, buf, len);
 
     /* If receive buffer can store more than CONFIG_GNRC_TCP_MSS: set window to free buffer size */
-    if (ringbuffer_get_free(&tcb->rcv_buf) >= CONFIG_GNRC_TCP_MSS) {
-        tcb->rcv_wnd = ringbuffer_get_free(&(tcb->rcv_buf));
+    uint32_t wnd = _gnrc_tcp_rcvbuf_get_window(tcb);
+    if (wnd >= CONFIG_GNRC_TCP_MSS) {
+        /* The peer only waits for an update if it couldn't send a full segment */
+        bool announce = (tcb->rcv_wnd < CONFIG_GNRC_TCP_MSS);
+
+        tcb->rcv_wnd = wnd;
 
         /* Send ACK to announce window update */
-        gnrc_pktsnip_t *out_pkt = NULL;
-        uint16_t seq_con = 0;
-        _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK, tcb->snd_nxt,
-                            tcb->rcv_nxt, NULL, 0);
-        _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
+        if (announce) {
+            gnrc_pktsnip_t *out_pkt = NULL;
+            uint16_t seq_con = 0;
+            _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK, tcb->snd_nxt,
+                                tcb->rcv_nxt, NULL, 0);
+            _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
+        }
     }
     TCP_DEBUG_LEAVE;
     return rcvd;
@@ -480,6 +633,9 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
     seg_seq = byteorder_ntohl(tcp_hdr->seq_num);
     seg_ack = byteorder_ntohl(tcp_hdr->ack_num);
     seg_wnd = byteorder_ntohs(tcp_hdr->window);
+    if (!(ctl & MSK_SYN)) {
+        seg_wnd <<= tcb->snd_wnd_shift;
+    }
 
     /* Extract network layer header */
 #ifdef MODULE_GNRC_IPV6
@@ -573,6 +729,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
             tcb->snd_una = tcb->iss;
             tcb->snd_nxt = tcb->iss;
             tcb->snd_wnd = seg_wnd;
+            tcb->rcv_wnd = _gnrc_tcp_rcvbuf_get_window(tcb);
 
             /* Send SYN+ACK: seq_no = iss, ack_no = rcv_nxt, T: LISTEN -> SYN_RCVD */
             _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_SYN_ACK, tcb->iss,
@@ -658,6 +815,10 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
         if (_gnrc_tcp_pkt_chk_seq_num(tcb, seg_seq, pay_len)) {
             /* ... if invalid, and RST not set, reply with pure ACK, return */
             if ((ctl & MSK_RST) != MSK_RST) {
+                /* Blocks may have been returned to the pool, e.g. answering a window probe */
+                if (tcb->rcv_wnd < CONFIG_GNRC_TCP_MSS) {
+                    tcb->rcv_wnd = _gnrc_tcp_rcvbuf_get_window(tcb);
+                }
                 _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK,
                                     tcb->snd_nxt, tcb->rcv_nxt, NULL, 0);
                 _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
@@ -712,8 +873,16 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 tcb->state == FSM_STATE_CLOSING || tcb->state == FSM_STATE_LAST_ACK) {
                 /* Acknowledge previously sent data */
                 if (LSS_32_BIT(tcb->snd_una, seg_ack) && LEQ_32_BIT(seg_ack, tcb->snd_nxt)) {
+                    uint32_t acked = seg_ack - tcb->snd_una;
+
                     tcb->snd_una = seg_ack;
                     _gnrc_tcp_pkt_acknowledge(tcb, seg_ack);
+                    _on_ack(tcb, acked);
+                }
+                /* Duplicate ACK: Nothing new, while data is outstanding (RFC 5681, 2) */
+                else if (seg_ack == tcb->snd_una && tcb->rtx_len > 0 && pay_len == 0 &&
+                         !(ctl & (MSK_SYN | MSK_FIN)) && seg_wnd == tcb->snd_wnd) {
+                    _on_dup_ack(tcb);
                 }
                 /* ACK received for something not yet sent: Reply with pure ACK */
                 else if (LSS_32_BIT(tcb->snd_nxt, seg_ack)) {
@@ -738,25 +907,25 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 /* Additional processing */
                 /* Check additionally if previously sent FIN was acknowledged */
                 if (tcb->state == FSM_STATE_FIN_WAIT_1) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->rtx_len == 0) {
                         _transition_to(tcb, FSM_STATE_FIN_WAIT_2);
                     }
                 }
                 /* If retransmission queue is empty, acknowledge close operation */
                 if (tcb->state == FSM_STATE_FIN_WAIT_2) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->rtx_len == 0) {
                         /* Optional: Unblock user close operation */
                     }
                 }
                 /* If our FIN has been acknowledged: Transition to TIME_WAIT */
                 if (tcb->state == FSM_STATE_CLOSING) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->rtx_len == 0) {
                         _transition_to(tcb, FSM_STATE_TIME_WAIT);
                     }
                 }
                 /* If our FIN was acknowledged and status is LAST_ACK: close connection */
                 if (tcb->state == FSM_STATE_LAST_ACK) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->rtx_len == 0) {
                         _transition_to(tcb, FSM_STATE_CLOSED);
                         TCP_DEBUG_LEAVE;
                         return 0;
@@ -772,32 +941,22 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
             /* Check if state is valid for payload receiving */
             if (tcb->state == FSM_STATE_ESTABLISHED || tcb->state == FSM_STATE_FIN_WAIT_1 ||
                 tcb->state == FSM_STATE_FIN_WAIT_2) {
-                /* Search for begin of payload */
-                snp = gnrc_pktsnip_search_type(in_pkt, GNRC_NETTYPE_UNDEF);
-
-                /* Accept only data that is expected, to be received */
-                if (tcb->rcv_nxt == seg_seq) {
-                    /* Copy contents into receive buffer */
-                    while (snp && snp->type == GNRC_NETTYPE_UNDEF) {
-                        tcb->rcv_nxt += ringbuffer_add(&(tcb->rcv_buf), snp->data, snp->size);
-                        snp = snp->next;
-                    }
-                    /* Shrink receive window */
-                    tcb->rcv_wnd = ringbuffer_get_free(&(tcb->rcv_buf));
+                /* Copy new data into receive buffer, keep data behind a gap */
+                if (_gnrc_tcp_rcvbuf_add(tcb, in_pkt) > 0) {
                     /* Notify owner because new data is available */
                     tcb->status |= STATUS_NOTIFY_USER;
                 }
                 /* Send ACK, if FIN processing sends ACK already */
                 /* NOTE: this is the place to add payload piggybagging in the future */
-                if (!(ctl & MSK_FIN)) {
+                if (!(ctl & MSK_FIN) || LSS_32_BIT(tcb->rcv_nxt, seg_seq + pay_len)) {
                     _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK,
                                         tcb->snd_nxt, tcb->rcv_nxt, NULL, 0);
                     _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
                 }
             }
         }
-        /* 7) Check FIN */
-        if (ctl & MSK_FIN) {
+        /* 7) Check FIN, if all data in front of it was received */
+        if ((ctl & MSK_FIN) && LEQ_32_BIT(seg_seq + pay_len, tcb->rcv_nxt)) {
             if (tcb->state == FSM_STATE_CLOSED || tcb->state == FSM_STATE_LISTEN ||
                 tcb->state == FSM_STATE_SYN_SENT) {
                 TCP_DEBUG_LEAVE;
@@ -813,7 +972,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 _transition_to(tcb, FSM_STATE_CLOSE_WAIT);
             }
             else if (tcb->state == FSM_STATE_FIN_WAIT_1) {
-                if (tcb->pkt_retransmit == NULL) {
+                if (tcb->rtx_len == 0) {
                     _transition_to(tcb, FSM_STATE_TIME_WAIT);
                 }
                 else {
@@ -857,9 +1016,23 @@ static int _fsm_timeout_timewait(gnrc_tcp_tcb_t *tcb)
 static int _fsm_timeout_retransmit(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
-    if (tcb->pkt_retransmit != NULL) {
-        _gnrc_tcp_pkt_setup_retransmit(tcb, tcb->pkt_retransmit, true);
-        _gnrc_tcp_pkt_send(tcb, tcb->pkt_retransmit, 0, true);
+    if (tcb->rtx_len > 0) {
+        gnrc_pktsnip_t *pkt = tcb->pkt_retransmit[0];
+
+        /* Restart from the oldest segment in slow start, forget about SACKed segments */
+        if (tcb->retries == 0) {
+            _enter_recovery(tcb);
+        }
+        tcb->recover = tcb->snd_nxt;
+        tcb->rtx_high = _gnrc_tcp_pkt_get_seq_num(pkt) + _gnrc_tcp_pkt_get_seg_len(pkt);
+        tcb->rtx_sacked = 0;
+        tcb->cwnd = _gnrc_tcp_pkt_get_smss(tcb);
+        tcb->dup_acks = 0;
+        tcb->status &= ~STATUS_FAST_RECOVERY;
+        tcb->status |= STATUS_RECOVERY;
+
+        _gnrc_tcp_pkt_setup_retransmit(tcb, pkt, true);
+        _gnrc_tcp_pkt_send(tcb, pkt, 0, true);
     }
     else {
         TCP_DEBUG_INFO("Retransmission queue is empty.");
@@ -28,6 +28,7 @@
 #include "include/gnrc_tcp_eventloop.h"
 #include "include/gnrc_tcp_option.h"
 #include "include/gnrc_tcp_pkt.h"
+#include "include/gnrc_tcp_rcvbuf.h"
 
 #ifdef MODULE_GNRC_IPV6
 #include "net/gnrc/ipv6.h"
@@ -155,6 +156,10 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
     gnrc_pktsnip_t *tcp_snp = NULL;
     tcp_hdr_t tcp_hdr;
     uint8_t offset = TCP_HDR_OFFSET_MIN;
+    uint32_t sack[2 * SACK_BLOCKS_MAX];
+    unsigned sack_numof = 0;
+    bool sack_perm = false;
+    bool wnd_scale = false;
 
     /* Add payload, if supplied */
     if (payload != NULL && payload_len > 0) {
@@ -173,13 +178,34 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
     tcp_hdr.checksum = byteorder_htons(0);
     tcp_hdr.seq_num = byteorder_htonl(seq_num);
     tcp_hdr.ack_num = byteorder_htonl(ack_num);
-    tcp_hdr.window = byteorder_htons(tcb->rcv_wnd);
+    /* The window of a SYN is never scaled (RFC 7323, 2.2) */
+    uint32_t wnd = (ctl & MSK_SYN) ? tcb->rcv_wnd : (tcb->rcv_wnd >> tcb->rcv_wnd_shift);
+    tcp_hdr.window = byteorder_htons((wnd < UINT16_MAX) ? wnd : UINT16_MAX);
     tcp_hdr.urgent_ptr = byteorder_htons(0);
 
     /* Calculate option field size. */
     /* Add MSS option if SYN is sent */
     if (ctl & MSK_SYN) {
         offset += 1;
+        /* Offer SACK with SYN, confirm it with SYN+ACK only if the peer offered it */
+        if (IS_ACTIVE(CONFIG_GNRC_TCP_SACK_EN) &&
+            (!(ctl & MSK_ACK) || (tcb->status & STATUS_SACK_PERMITTED))) {
+            sack_perm = true;
+            offset += 1;
+        }
+        /* Offer window scaling with SYN, confirm it with SYN+ACK only if the peer offered it */
+        if (IS_ACTIVE(CONFIG_GNRC_TCP_WND_SCALE_EN) &&
+            (!(ctl & MSK_ACK) || (tcb->status & STATUS_WND_SCALE))) {
+            wnd_scale = true;
+            offset += 1;
+        }
+    }
+    /* Add SACK option if the peer permitted it and there is out-of-order data */
+    else if (((ctl & (MSK_ACK | MSK_RST)) == MSK_ACK) && (tcb->status & STATUS_SACK_PERMITTED)) {
+        sack_numof = _gnrc_tcp_rcvbuf_get_sack_blocks(tcb, sack, SACK_BLOCKS_MAX);
+        if (sack_numof > 0) {
+            offset += 1 + 2 * sack_numof;
+        }
     }
     /* Set offset and control bit accordingly */
     tcp_hdr.off_ctl = byteorder_htons(
@@ -217,8 +243,36 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
                     _gnrc_tcp_option_build_mss(CONFIG_GNRC_TCP_MSS));
 
                 memcpy(opt_ptr, &mss_option, sizeof(mss_option));
+                opt_ptr += sizeof(mss_option);
+            }
+            /* Add window scale option */
+            if (wnd_scale) {
+                network_uint32_t ws_option = byteorder_htonl(
+                    _gnrc_tcp_option_build_ws(_gnrc_tcp_option_get_wnd_shift()));
+
+                memcpy(opt_ptr, &ws_option, sizeof(ws_option));
+                opt_ptr += sizeof(ws_option);
+            }
+            /* Add SACK permitted option, aligned by two NOP options */
+            if (sack_perm) {
+                *opt_ptr++ = TCP_OPTION_KIND_NOP;
+                *opt_ptr++ = TCP_OPTION_KIND_NOP;
+                *opt_ptr++ = TCP_OPTION_KIND_SACK_PERM;
+                *opt_ptr++ = TCP_OPTION_LENGTH_SACK_PERM;
+            }
+            /* Add SACK option, aligned by two NOP options */
+            if (sack_numof > 0) {
+                *opt_ptr++ = TCP_OPTION_KIND_NOP;
+                *opt_ptr++ = TCP_OPTION_KIND_NOP;
+                *opt_ptr++ = TCP_OPTION_KIND_SACK;
+                *opt_ptr++ = TCP_OPTION_LENGTH_MIN + sack_numof * TCP_OPTION_LENGTH_SACK_BLOCK;
+                for (unsigned i = 0; i < 2 * sack_numof; i++) {
+                    network_uint32_t edge = byteorder_htonl(sack[i]);
+
+                    memcpy(opt_ptr, &edge, sizeof(edge));
+                    opt_ptr += sizeof(edge);
+                }
             }
-            /* Increase opt_ptr and decrease opt_left, if other options are added */
             /* NOTE: Add additional options here */
         }
         *(out_pkt) = tcp_snp;
@@ -287,11 +341,18 @@ int _gnrc_tcp_pkt_send(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *out_pkt,
 
     /* If this is no retransmission, advance sequence number and measure time */
     if (!retransmit) {
-        tcb->retries = 0;
         tcb->snd_nxt += seq_con;
-        tcb->rtt_start = evtimer_now_msec();
+
+        /* Measure the round trip time of one segment at a time */
+        if (seq_con > 0 && !(tcb->status & STATUS_RTT_PENDING)) {
+            tcb->status |= STATUS_RTT_PENDING;
+            tcb->rtt_seq = tcb->snd_nxt;
+            tcb->rtt_start = evtimer_now_msec();
+        }
     }
     else {
+        /* Acknowledgments of retransmitted data are ambiguous (Karns Algorithm) */
+        tcb->status &= ~STATUS_RTT_PENDING;
         tcb->retries += 1;
     }
 
@@ -363,6 +424,16 @@ uint32_t _gnrc_tcp_pkt_get_seg_len(gnrc_pktsnip_t *pkt)
     return seq;
 }
 
+uint32_t _gnrc_tcp_pkt_get_seq_num(gnrc_pktsnip_t *pkt)
+{
+    TCP_DEBUG_ENTER;
+    gnrc_pktsnip_t *snp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_TCP);
+    assert(snp != NULL);
+    tcp_hdr_t *hdr = (tcp_hdr_t *) snp->data;
+    TCP_DEBUG_LEAVE;
+    return byteorder_ntohl(hdr->seq_num);
+}
+
 uint32_t _gnrc_tcp_pkt_get_pay_len(gnrc_pktsnip_t *pkt)
 {
     TCP_DEBUG_ENTER;
@@ -376,6 +447,31 @@ uint32_t _gnrc_tcp_pkt_get_pay_len(gnrc_pktsnip_t *pkt)
     return seg_len;
 }
 
+/**
+ * @brief Calculates the retransmission timeout from the current RTT estimates.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _update_rto(gnrc_tcp_tcb_t *tcb)
+{
+    /* Without a measurement, rto is 1 sec (Lower Bound) */
+    if (tcb->srtt == RTO_UNINITIALIZED || tcb->rtt_var == RTO_UNINITIALIZED) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
+    }
+    else {
+        tcb->rto = tcb->srtt + _max(CONFIG_GNRC_TCP_RTO_GRANULARITY_MS,
+                                    CONFIG_GNRC_TCP_RTO_K * tcb->rtt_var);
+    }
+
+    /* Perform boundary checks, the timer may be restarted with this value right away */
+    if (tcb->rto < (int32_t) CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
+    }
+    else if (tcb->rto > (int32_t) CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS;
+    }
+}
+
 int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
                                    const bool retransmit)
 {
@@ -391,8 +487,8 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
         return -EINVAL;
     }
 
-    /* Check if retransmit queue is full and pkt is not already in retransmit queue */
-    if (tcb->pkt_retransmit != NULL && tcb->pkt_retransmit != pkt) {
+    /* Check if retransmit queue is full, retransmissions are already queued */
+    if (!retransmit && tcb->rtx_len >= CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE) {
         TCP_DEBUG_ERROR("-ENOMEM: Retransmit queue is full.");
         TCP_DEBUG_LEAVE;
         return -ENOMEM;
@@ -415,20 +511,18 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
         return 0;
     }
 
-    /* Assign pkt and increase users: every send attempt consumes a user */
-    tcb->pkt_retransmit = pkt;
+    /* Increase users: every send attempt consumes a user */
     gnrc_pktbuf_hold(pkt, 1);
 
     /* RTO adjustment */
     if (!retransmit) {
-        /* If this is the first transmission: rto is 1 sec (Lower Bound) */
-        if (tcb->srtt == RTO_UNINITIALIZED || tcb->rtt_var == RTO_UNINITIALIZED) {
-            tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
-        }
-        else {
-            tcb->rto = tcb->srtt + _max(CONFIG_GNRC_TCP_RTO_GRANULARITY_MS,
-                                        CONFIG_GNRC_TCP_RTO_K * tcb->rtt_var);
+        /* Append pkt, the timer is already running if older segments are queued */
+        tcb->pkt_retransmit[tcb->rtx_len++] = pkt;
+        if (tcb->rtx_len > 1) {
+            TCP_DEBUG_LEAVE;
+            return 0;
         }
+        _update_rto(tcb);
     }
     else {
         /* If this is a retransmission: Double the rto (Timer Backoff) */
@@ -457,62 +551,103 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
     return 0;
 }
 
+int _gnrc_tcp_pkt_retransmit(gnrc_tcp_tcb_t *tcb, const unsigned idx)
+{
+    TCP_DEBUG_ENTER;
+    if (idx >= tcb->rtx_len) {
+        TCP_DEBUG_ERROR("-ENOENT: No such packet in retransmit queue.");
+        TCP_DEBUG_LEAVE;
+        return -ENOENT;
+    }
+
+    /* Every send attempt consumes a user, the queue keeps its own */
+    gnrc_pktbuf_hold(tcb->pkt_retransmit[idx], 1);
+    TCP_DEBUG_LEAVE;
+    return _gnrc_tcp_pkt_send(tcb, tcb->pkt_retransmit[idx], 0, true);
+}
+
 int _gnrc_tcp_pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack)
 {
     TCP_DEBUG_ENTER;
-    uint32_t seg = 0;
-    gnrc_pktsnip_t *snp = NULL;
-    tcp_hdr_t *hdr;
+    unsigned acked = 0;
 
     /* Retransmission queue is empty. Nothing to ACK there */
-    if (tcb->pkt_retransmit == NULL) {
+    if (tcb->rtx_len == 0) {
         TCP_DEBUG_ERROR("-ENODATA: No packet to acknowledge.");
         TCP_DEBUG_LEAVE;
         return -ENODATA;
     }
 
-    snp = gnrc_pktsnip_search_type(tcb->pkt_retransmit, GNRC_NETTYPE_TCP);
-    if (snp == NULL) {
-        TCP_DEBUG_ERROR("-EINVAL: snp == NULL.");
-        TCP_DEBUG_LEAVE;
-        return -EINVAL;
-    }
-
-    hdr = (tcp_hdr_t *) snp->data;
+    /* Release every segment that is acknowledged completely, oldest first */
+    while (acked < tcb->rtx_len) {
+        gnrc_pktsnip_t *pkt = tcb->pkt_retransmit[acked];
+        uint32_t seg = _gnrc_tcp_pkt_get_seq_num(pkt) + _gnrc_tcp_pkt_get_seg_len(pkt) - 1;
 
-    /* There must be a packet, waiting to be acknowledged. */
-    seg = byteorder_ntohl(hdr->seq_num) + _gnrc_tcp_pkt_get_seg_len(
-        tcb->pkt_retransmit) - 1;
+        if (!LSS_32_BIT(seg, ack)) {
+            break;
+        }
+        gnrc_pktbuf_release(pkt);
+        acked++;
+    }
 
-        /* If segment can be acknowledged -> stop timer, release packet from pktbuf and update rto. */
-    if (LSS_32_BIT(seg, ack)) {
+    /* If segments were acknowledged -> stop timer, shrink queue and update rto. */
+    if (acked > 0) {
         _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
-        gnrc_pktbuf_release(tcb->pkt_retransmit);
-        tcb->pkt_retransmit = NULL;
+        tcb->rtx_len -= acked;
+        memmove(&tcb->pkt_retransmit[0], &tcb->pkt_retransmit[acked],
+                tcb->rtx_len * sizeof(tcb->pkt_retransmit[0]));
+        tcb->rtx_sacked = (acked < 32) ? (tcb->rtx_sacked >> acked) : 0;
+        tcb->retries = 0;
 
-        /* Measure round trip time */
+        /* Measure round trip time, if the timed segment was not retransmitted (Karns Algorithm) */
         int32_t rtt = evtimer_now_msec() - tcb->rtt_start;
 
-        /* Use time only if there was no timer overflow and no retransmission (Karns Algorithm) */
-        if (tcb->retries == 0 && rtt > 0) {
-            /* If this is the first sample taken */
-            if (tcb->srtt == RTO_UNINITIALIZED && tcb->rtt_var == RTO_UNINITIALIZED) {
-                tcb->srtt = rtt;
-                tcb->rtt_var = (rtt >> 1);
-            }
-            /* If this is a subsequent sample */
-            else {
-                tcb->rtt_var = (tcb->rtt_var / CONFIG_GNRC_TCP_RTO_B_DIV) * (CONFIG_GNRC_TCP_RTO_B_DIV-1);
-                tcb->rtt_var += labs(tcb->srtt - rtt) / CONFIG_GNRC_TCP_RTO_B_DIV;
-                tcb->srtt = (tcb->srtt / CONFIG_GNRC_TCP_RTO_A_DIV) * (CONFIG_GNRC_TCP_RTO_A_DIV-1);
-                tcb->srtt += rtt / CONFIG_GNRC_TCP_RTO_A_DIV;
+        if ((tcb->status & STATUS_RTT_PENDING) && LEQ_32_BIT(tcb->rtt_seq, ack)) {
+            tcb->status &= ~STATUS_RTT_PENDING;
+
+            /* Use time only if there was no timer overflow */
+            if (rtt > 0) {
+                /* If this is the first sample taken */
+                if (tcb->srtt == RTO_UNINITIALIZED && tcb->rtt_var == RTO_UNINITIALIZED) {
+                    tcb->srtt = rtt;
+                    tcb->rtt_var = (rtt >> 1);
+                }
+                /* If this is a subsequent sample */
+                else {
+                    tcb->rtt_var = (tcb->rtt_var / CONFIG_GNRC_TCP_RTO_B_DIV) * (CONFIG_GNRC_TCP_RTO_B_DIV-1);
+                    tcb->rtt_var += labs(tcb->srtt - rtt) / CONFIG_GNRC_TCP_RTO_B_DIV;
+                    tcb->srtt = (tcb->srtt / CONFIG_GNRC_TCP_RTO_A_DIV) * (CONFIG_GNRC_TCP_RTO_A_DIV-1);
+                    tcb->srtt += rtt / CONFIG_GNRC_TCP_RTO_A_DIV;
+                }
             }
         }
+        /* Progress was made: drop the timer backoff */
+        _update_rto(tcb);
+
+        /* Restart the timer for the oldest segment still outstanding (RFC 6298, 5.3) */
+        if (tcb->rtx_len > 0) {
+            _gnrc_tcp_eventloop_sched(&tcb->event_retransmit, tcb->rto,
+                                      MSG_TYPE_RETRANSMISSION, tcb);
+        }
     }
     TCP_DEBUG_LEAVE;
     return 0;
 }
 
+void _gnrc_tcp_pkt_sack(gnrc_tcp_tcb_t *tcb, const uint32_t left, const uint32_t right)
+{
+    TCP_DEBUG_ENTER;
+    for (unsigned i = 0; i < tcb->rtx_len; i++) {
+        uint32_t seq = _gnrc_tcp_pkt_get_seq_num(tcb->pkt_retransmit[i]);
+        uint32_t end = seq + _gnrc_tcp_pkt_get_seg_len(tcb->pkt_retransmit[i]);
+
+        if (LEQ_32_BIT(left, seq) && LEQ_32_BIT(end, right)) {
+            tcb->rtx_sacked |= (1UL << i);
+        }
+    }
+    TCP_DEBUG_LEAVE;
+}
+
 uint16_t _gnrc_tcp_pkt_calc_csum(const gnrc_pktsnip_t *hdr,
                                  const gnrc_pktsnip_t *pseudo_hdr,
                                  const gnrc_pktsnip_t *payload)
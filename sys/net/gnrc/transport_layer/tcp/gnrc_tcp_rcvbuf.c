@@ -15,54 +15,75 @@
  *
  * @author      Simon Brummer <simon.brummer@posteo.de>
  */
-#include <errno.h>
 #include <mutex.h>
+#include <stdbool.h>
 #include <stdint.h>
+#include <string.h>
+#include "net/gnrc.h"
 #include "net/gnrc/tcp/config.h"
 #include "include/gnrc_tcp_common.h"
+#include "include/gnrc_tcp_pkt.h"
 #include "include/gnrc_tcp_rcvbuf.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
 /**
- * @brief Receive buffer entry.
+ * @brief Number of blocks in the receive buffer pool.
  */
-typedef struct {
-    uint8_t used;                          /**< Flag: Is buffer in use? */
-    uint8_t buffer[GNRC_TCP_RCV_BUF_SIZE]; /**< Receive buffer storage */
-} _rcvbuf_entry_t;
+#define RCV_BUF_BLOCKS ((CONFIG_GNRC_TCP_RCV_BUF_POOL_SIZE + CONFIG_GNRC_TCP_RCV_BUF_BLOCK_SIZE - 1) / \
+                        CONFIG_GNRC_TCP_RCV_BUF_BLOCK_SIZE)
+
+/**
+ * @brief Receive buffer block.
+ */
+typedef struct _gnrc_tcp_rcvbuf_block {
+    struct _gnrc_tcp_rcvbuf_block *next;            /**< Next block */
+    uint8_t data[CONFIG_GNRC_TCP_RCV_BUF_BLOCK_SIZE]; /**< Receive buffer storage */
+} _rcvbuf_block_t;
 
 /**
- * @brief Struct holding receive buffers.
+ * @brief Struct holding the receive buffer pool.
  */
 typedef struct {
-    mutex_t lock;                                         /**< Access lock */
-    _rcvbuf_entry_t entries[CONFIG_GNRC_TCP_RCV_BUFFERS]; /**< Buffers */
+    mutex_t lock;                           /**< Access lock */
+    _rcvbuf_block_t *free;                  /**< Unused blocks */
+    unsigned free_numof;                    /**< Number of blocks behind member free,
+                                                 not reserved by any TCB */
+    _rcvbuf_block_t blocks[RCV_BUF_BLOCKS]; /**< Blocks */
 } _rcvbuf_t;
 
 /**
- * @brief Internal struct holding receive buffers.
+ * @brief Internal struct holding the receive buffer pool.
  */
 static _rcvbuf_t _static_buf;
 
 /**
- * @brief Allocate receive buffer.
+ * @brief Allocate a receive buffer block.
  *
- * @returns   Not NULL if a receive buffer was allocated.
+ * Blocks reserved by @p tcb are used first.
+ *
+ * @param[in,out] tcb   TCB the block is allocated for.
+ *
+ * @returns   Not NULL if a block was allocated.
  *            NULL if allocation failed.
  */
-static void* _rcvbuf_alloc(void)
+static _rcvbuf_block_t *_rcvbuf_alloc(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
-    void *result = NULL;
     mutex_lock(&(_static_buf.lock));
-    for (size_t i = 0; i < CONFIG_GNRC_TCP_RCV_BUFFERS; ++i) {
-        if (_static_buf.entries[i].used == 0) {
-            _static_buf.entries[i].used = 1;
-            result = (void *)(_static_buf.entries[i].buffer);
-            break;
-        }
+    _rcvbuf_block_t *result = NULL;
+    if (tcb->rcv_reserved > 0) {
+        tcb->rcv_reserved--;
+        result = _static_buf.free;
+    }
+    else if (_static_buf.free_numof > 0) {
+        _static_buf.free_numof--;
+        result = _static_buf.free;
+    }
+    if (result != NULL) {
+        _static_buf.free = result->next;
+        result->next = NULL;
     }
     mutex_unlock(&(_static_buf.lock));
     TCP_DEBUG_LEAVE;
@@ -70,57 +91,341 @@ static void* _rcvbuf_alloc(void)
 }
 
 /**
- * @brief Release allocated receive buffer.
+ * @brief Release a receive buffer block.
  *
- * @param[in] buf   Pointer to buffer that should be released.
+ * @param[in,out] tcb     TCB that keeps the block reserved, NULL to return
+ *                        it to the unreserved part of the pool.
+ * @param[in]     block   Block that should be released.
  */
-static void _rcvbuf_free(void * const buf)
+static void _rcvbuf_free(gnrc_tcp_tcb_t *tcb, _rcvbuf_block_t *block)
 {
     TCP_DEBUG_ENTER;
     mutex_lock(&(_static_buf.lock));
-    for (size_t i = 0; i < CONFIG_GNRC_TCP_RCV_BUFFERS; ++i) {
-        if ((_static_buf.entries[i].used == 1) && (buf == _static_buf.entries[i].buffer)) {
-            _static_buf.entries[i].used = 0;
-        }
+    block->next = _static_buf.free;
+    _static_buf.free = block;
+    if (tcb != NULL) {
+        tcb->rcv_reserved++;
+    }
+    else {
+        _static_buf.free_numof++;
     }
     mutex_unlock(&(_static_buf.lock));
     TCP_DEBUG_LEAVE;
 }
 
+/**
+ * @brief Append data to the receive buffer, allocating blocks as needed.
+ *
+ * @param[in,out] tcb    TCB holding the receive buffer.
+ * @param[in]     data   Data to append.
+ * @param[in]     len    Number of bytes in @p data.
+ *
+ * @returns   Number of bytes appended. Less than @p len if the receive buffer
+ *            reached GNRC_TCP_RCV_BUF_SIZE or the pool ran out of blocks.
+ */
+static size_t _rcvbuf_write(gnrc_tcp_tcb_t *tcb, const uint8_t *data, size_t len)
+{
+    size_t space = GNRC_TCP_RCV_BUF_SIZE - tcb->rcv_buf_len;
+    size_t written = 0;
+
+    len = (len < space) ? len : space;
+    while (written < len) {
+        if (tcb->rcv_tail == NULL || tcb->rcv_tail_pos == CONFIG_GNRC_TCP_RCV_BUF_BLOCK_SIZE) {
+            _rcvbuf_block_t *block = _rcvbuf_alloc(tcb);
+
+            if (block == NULL) {
+                TCP_DEBUG_INFO("Receive buffer pool is exhausted.");
+                break;
+            }
+            if (tcb->rcv_tail == NULL) {
+                tcb->rcv_head = block;
+                tcb->rcv_head_pos = 0;
+            }
+            else {
+                tcb->rcv_tail->next = block;
+            }
+            tcb->rcv_tail = block;
+            tcb->rcv_tail_pos = 0;
+        }
+        size_t chunk = CONFIG_GNRC_TCP_RCV_BUF_BLOCK_SIZE - tcb->rcv_tail_pos;
+
+        chunk = (chunk < len - written) ? chunk : len - written;
+        memcpy(&tcb->rcv_tail->data[tcb->rcv_tail_pos], data + written, chunk);
+        tcb->rcv_tail_pos += chunk;
+        written += chunk;
+    }
+    tcb->rcv_buf_len += written;
+    return written;
+}
+
 void _gnrc_tcp_rcvbuf_init(void)
 {
     TCP_DEBUG_ENTER;
     mutex_init(&(_static_buf.lock));
-    for (size_t i = 0; i < CONFIG_GNRC_TCP_RCV_BUFFERS; ++i) {
-        _static_buf.entries[i].used = 0;
+    _static_buf.free = NULL;
+    for (size_t i = 0; i < RCV_BUF_BLOCKS; ++i) {
+        _static_buf.blocks[i].next = _static_buf.free;
+        _static_buf.free = &_static_buf.blocks[i];
     }
+    _static_buf.free_numof = RCV_BUF_BLOCKS;
     TCP_DEBUG_LEAVE;
 }
 
-int _gnrc_tcp_rcvbuf_get_buffer(gnrc_tcp_tcb_t *tcb)
+void _gnrc_tcp_rcvbuf_release_buffer(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
-    if (tcb->rcv_buf_raw == NULL) {
-        tcb->rcv_buf_raw = _rcvbuf_alloc();
-        if (tcb->rcv_buf_raw == NULL) {
-            TCP_DEBUG_ERROR("-ENOMEM: Failed to allocate receive buffer.");
-            TCP_DEBUG_LEAVE;
-            return -ENOMEM;
+    while (tcb->rcv_head != NULL) {
+        _rcvbuf_block_t *block = tcb->rcv_head;
+
+        tcb->rcv_head = block->next;
+        _rcvbuf_free(NULL, block);
+    }
+    mutex_lock(&(_static_buf.lock));
+    _static_buf.free_numof += tcb->rcv_reserved;
+    tcb->rcv_reserved = 0;
+    mutex_unlock(&(_static_buf.lock));
+    tcb->rcv_tail = NULL;
+    tcb->rcv_head_pos = 0;
+    tcb->rcv_tail_pos = 0;
+    tcb->rcv_buf_len = 0;
+    TCP_DEBUG_LEAVE;
+}
+
+size_t _gnrc_tcp_rcvbuf_get(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
+{
+    TCP_DEBUG_ENTER;
+    size_t rcvd = 0;
+
+    len = (len < tcb->rcv_buf_len) ? len : tcb->rcv_buf_len;
+    while (rcvd < len) {
+        _rcvbuf_block_t *block = tcb->rcv_head;
+        size_t end = (block == tcb->rcv_tail) ? tcb->rcv_tail_pos
+                                              : CONFIG_GNRC_TCP_RCV_BUF_BLOCK_SIZE;
+        size_t chunk = end - tcb->rcv_head_pos;
+
+        chunk = (chunk < len - rcvd) ? chunk : len - rcvd;
+        memcpy((uint8_t *)buf + rcvd, &block->data[tcb->rcv_head_pos], chunk);
+        tcb->rcv_head_pos += chunk;
+        rcvd += chunk;
+
+        /* Return blocks to the pool as soon as they were read. The space left
+         * in the tail block may be part of the advertised window: keep it reserved. */
+        if (tcb->rcv_head_pos == end) {
+            bool is_tail = (block == tcb->rcv_tail);
+
+            tcb->rcv_head = block->next;
+            tcb->rcv_head_pos = 0;
+            if (is_tail) {
+                tcb->rcv_tail = NULL;
+                tcb->rcv_tail_pos = 0;
+            }
+            _rcvbuf_free(is_tail ? tcb : NULL, block);
+        }
+    }
+    tcb->rcv_buf_len -= rcvd;
+    TCP_DEBUG_LEAVE;
+    return rcvd;
+}
+
+uint32_t _gnrc_tcp_rcvbuf_get_window(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    uint32_t wnd = GNRC_TCP_RCV_BUF_SIZE - tcb->rcv_buf_len;
+    uint32_t avail = 0;
+    unsigned needed = 0;
+
+    if (tcb->rcv_tail != NULL) {
+        avail = CONFIG_GNRC_TCP_RCV_BUF_BLOCK_SIZE - tcb->rcv_tail_pos;
+    }
+    if (wnd > avail) {
+        needed = (wnd - avail + CONFIG_GNRC_TCP_RCV_BUF_BLOCK_SIZE - 1) /
+                 CONFIG_GNRC_TCP_RCV_BUF_BLOCK_SIZE;
+    }
+
+    /* Reserve the blocks behind the advertised window, so that other
+     * connections can't take them. Reserved blocks only leave the
+     * reservation when data is written into them, so the right edge of an
+     * advertised window never moves to the left. A single call reserves at
+     * most half of the unreserved blocks, leaving a window for connections
+     * that are still waiting to be accepted or read from. */
+    mutex_lock(&(_static_buf.lock));
+    if (tcb->rcv_reserved < needed) {
+        unsigned take = needed - tcb->rcv_reserved;
+        unsigned share = (_static_buf.free_numof + 1) / 2;
+
+        take = (take < share) ? take : share;
+        _static_buf.free_numof -= take;
+        tcb->rcv_reserved += take;
+    }
+    else {
+        _static_buf.free_numof += tcb->rcv_reserved - needed;
+        tcb->rcv_reserved = needed;
+    }
+    avail += tcb->rcv_reserved * CONFIG_GNRC_TCP_RCV_BUF_BLOCK_SIZE;
+    mutex_unlock(&(_static_buf.lock));
+    TCP_DEBUG_LEAVE;
+    return (avail < wnd) ? avail : wnd;
+}
+
+/**
+ * @brief Copy payload of a segment behind rcv_nxt into the receive buffer.
+ *
+ * @param[in,out] tcb   TCB holding the receive buffer.
+ * @param[in]     pkt   Segment with payload starting at or in front of rcv_nxt.
+ * @param[in]     seq   Sequence number of @p pkt.
+ *
+ * @returns   Number of bytes added to the receive buffer.
+ */
+static size_t _add_payload(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt, uint32_t seq)
+{
+    size_t skip = tcb->rcv_nxt - seq;
+    size_t added = 0;
+
+    for (gnrc_pktsnip_t *snp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_UNDEF);
+         snp && snp->type == GNRC_NETTYPE_UNDEF; snp = snp->next) {
+        if (skip >= snp->size) {
+            skip -= snp->size;
+            continue;
         }
-        else {
-            ringbuffer_init(&tcb->rcv_buf, (char *) tcb->rcv_buf_raw, GNRC_TCP_RCV_BUF_SIZE);
+        size_t len = snp->size - skip;
+        size_t copied = _rcvbuf_write(tcb, (uint8_t *)snp->data + skip, len);
+
+        added += copied;
+        skip = 0;
+        if (copied < len) {
+            break;
         }
     }
+    tcb->rcv_nxt += added;
+    return added;
+}
+
+#if CONFIG_GNRC_TCP_OOO_QUEUE_SIZE
+/**
+ * @brief Keep a segment that arrived out of order.
+ *
+ * @param[in,out] tcb   TCB holding the out-of-order queue.
+ * @param[in]     pkt   Segment that starts behind rcv_nxt.
+ * @param[in]     seq   Sequence number of @p pkt.
+ * @param[in]     end   Sequence number behind the payload of @p pkt.
+ */
+static void _ooo_insert(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt, uint32_t seq, uint32_t end)
+{
+    unsigned pos = 0;
+
+    /* Only keep what fits into the receive buffer once the gap is filled */
+    if (GRT_32_BIT(end, tcb->rcv_nxt + tcb->rcv_wnd)) {
+        TCP_DEBUG_INFO("Out-of-order segment exceeds receive window.");
+        return;
+    }
+    while (pos < tcb->ooo_len && LSS_32_BIT(_gnrc_tcp_pkt_get_seq_num(tcb->pkt_ooo[pos]), seq)) {
+        pos++;
+    }
+    if (pos < tcb->ooo_len && _gnrc_tcp_pkt_get_seq_num(tcb->pkt_ooo[pos]) == seq) {
+        TCP_DEBUG_INFO("Out-of-order segment is already queued.");
+        return;
+    }
+    /* Queue is full: Prefer segments closer to rcv_nxt */
+    if (tcb->ooo_len == CONFIG_GNRC_TCP_OOO_QUEUE_SIZE) {
+        if (pos == CONFIG_GNRC_TCP_OOO_QUEUE_SIZE) {
+            TCP_DEBUG_INFO("Out-of-order queue is full.");
+            return;
+        }
+        gnrc_pktbuf_release(tcb->pkt_ooo[--tcb->ooo_len]);
+    }
+    memmove(&tcb->pkt_ooo[pos + 1], &tcb->pkt_ooo[pos],
+            (tcb->ooo_len - pos) * sizeof(tcb->pkt_ooo[0]));
+    tcb->pkt_ooo[pos] = pkt;
+    tcb->ooo_len++;
+    gnrc_pktbuf_hold(pkt, 1);
+}
+#endif
+
+size_t _gnrc_tcp_rcvbuf_add(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt)
+{
+    TCP_DEBUG_ENTER;
+    uint32_t seq = _gnrc_tcp_pkt_get_seq_num(pkt);
+    uint32_t end = seq + _gnrc_tcp_pkt_get_pay_len(pkt);
+    size_t added = 0;
+
+    /* Segment contains nothing new */
+    if (LEQ_32_BIT(end, tcb->rcv_nxt)) {
+        TCP_DEBUG_LEAVE;
+        return 0;
+    }
+    if (LEQ_32_BIT(seq, tcb->rcv_nxt)) {
+        added = _add_payload(tcb, pkt, seq);
+#if CONFIG_GNRC_TCP_OOO_QUEUE_SIZE
+        /* Move queued segments the gap was filled for into the receive buffer */
+        while (tcb->ooo_len > 0) {
+            gnrc_pktsnip_t *next = tcb->pkt_ooo[0];
+            uint32_t next_seq = _gnrc_tcp_pkt_get_seq_num(next);
+
+            if (GRT_32_BIT(next_seq, tcb->rcv_nxt)) {
+                break;
+            }
+            if (GRT_32_BIT(next_seq + _gnrc_tcp_pkt_get_pay_len(next), tcb->rcv_nxt)) {
+                added += _add_payload(tcb, next, next_seq);
+            }
+            gnrc_pktbuf_release(next);
+            tcb->ooo_len--;
+            memmove(&tcb->pkt_ooo[0], &tcb->pkt_ooo[1], tcb->ooo_len * sizeof(tcb->pkt_ooo[0]));
+        }
+#endif
+    }
+#if CONFIG_GNRC_TCP_OOO_QUEUE_SIZE
+    else {
+        _ooo_insert(tcb, pkt, seq, end);
+    }
+#endif
+    /* Shrink receive window */
+    tcb->rcv_wnd = _gnrc_tcp_rcvbuf_get_window(tcb);
     TCP_DEBUG_LEAVE;
-    return 0;
+    return added;
 }
 
-void _gnrc_tcp_rcvbuf_release_buffer(gnrc_tcp_tcb_t *tcb)
+void _gnrc_tcp_rcvbuf_clear_ooo(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+#if CONFIG_GNRC_TCP_OOO_QUEUE_SIZE
+    while (tcb->ooo_len > 0) {
+        gnrc_pktbuf_release(tcb->pkt_ooo[--tcb->ooo_len]);
+    }
+#else
+    (void)tcb;
+#endif
+    TCP_DEBUG_LEAVE;
+}
+
+unsigned _gnrc_tcp_rcvbuf_get_sack_blocks(const gnrc_tcp_tcb_t *tcb, uint32_t *blocks,
+                                          unsigned max)
 {
     TCP_DEBUG_ENTER;
-    if (tcb->rcv_buf_raw != NULL) {
-        _rcvbuf_free(tcb->rcv_buf_raw);
-        tcb->rcv_buf_raw = NULL;
+    unsigned numof = 0;
+#if CONFIG_GNRC_TCP_OOO_QUEUE_SIZE
+    for (unsigned i = 0; i < tcb->ooo_len; i++) {
+        uint32_t seq = _gnrc_tcp_pkt_get_seq_num(tcb->pkt_ooo[i]);
+        uint32_t end = seq + _gnrc_tcp_pkt_get_pay_len(tcb->pkt_ooo[i]);
+
+        /* Merge segments that overlap or are adjacent into one block */
+        if (numof > 0 && LEQ_32_BIT(seq, blocks[2 * numof - 1])) {
+            if (GRT_32_BIT(end, blocks[2 * numof - 1])) {
+                blocks[2 * numof - 1] = end;
+            }
+            continue;
+        }
+        if (numof == max) {
+            break;
+        }
+        blocks[2 * numof] = seq;
+        blocks[2 * numof + 1] = end;
+        numof++;
     }
+#else
+    (void)tcb;
+    (void)blocks;
+    (void)max;
+#endif
     TCP_DEBUG_LEAVE;
+    return numof;
 }
@@ -28,6 +28,14 @@
 extern "C" {
 #endif
 
+/**
+ * @brief Maximum number of blocks in a SACK option.
+ *
+ * Four blocks and the two NOP options used for alignment fit into the
+ * 40 bytes of option space (see RFC 2018).
+ */
+#define SACK_BLOCKS_MAX (4U)
+
 /**
  * @brief Helper function to build the MSS option.
  *
@@ -41,6 +49,41 @@ static inline uint32_t _gnrc_tcp_option_build_mss(uint16_t mss)
             ((uint32_t) TCP_OPTION_LENGTH_MSS << 16) | mss);
 }
 
+/**
+ * @brief Largest shift count of the window scale option (RFC 7323, 2.3).
+ */
+#define WND_SHIFT_MAX (14U)
+
+/**
+ * @brief Shift count announced with the window scale option.
+ *
+ * @returns   Smallest shift count that fits CONFIG_GNRC_TCP_DEFAULT_WINDOW
+ *            into the window field.
+ */
+static inline uint8_t _gnrc_tcp_option_get_wnd_shift(void)
+{
+    uint8_t shift = 0;
+
+    while (shift < WND_SHIFT_MAX &&
+           ((uint32_t) CONFIG_GNRC_TCP_DEFAULT_WINDOW >> shift) > UINT16_MAX) {
+        shift++;
+    }
+    return shift;
+}
+
+/**
+ * @brief Helper function to build the window scale option, aligned by a NOP option.
+ *
+ * @param[in] shift   Shift count that should be set.
+ *
+ * @returns   NOP and window scale option value.
+ */
+static inline uint32_t _gnrc_tcp_option_build_ws(uint8_t shift)
+{
+    return (((uint32_t) TCP_OPTION_KIND_NOP << 24) | ((uint32_t) TCP_OPTION_KIND_WS << 16) |
+            ((uint32_t) TCP_OPTION_LENGTH_WS << 8) | shift);
+}
+
 /**
  * @brief Helper function to build the combined option and control flag field.
  *
@@ -98,6 +98,15 @@ int _gnrc_tcp_pkt_chk_seq_num(const gnrc_tcp_tcb_t *tcb, const uint32_t seq_num,
  */
 uint32_t _gnrc_tcp_pkt_get_seg_len(gnrc_pktsnip_t *pkt);
 
+/**
+ * @brief Extracts the sequence number of a segment.
+ *
+ * @param[in] pkt   Packet to extract the sequence number from.
+ *
+ * @returns   Sequence number of the first byte in the segment.
+ */
+uint32_t _gnrc_tcp_pkt_get_seq_num(gnrc_pktsnip_t *pkt);
+
 /**
  * @brief Calculates a packets payload length.
  *
@@ -122,7 +131,20 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
                                    const bool retransmit);
 
 /**
- * @brief Acknowledges and removes packet from the retransmission mechanism.
+ * @brief Sends a packet in the retransmit queue again.
+ *
+ * @note The retransmission timer is not touched. Used for fast retransmit.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ * @param[in]     idx   Position of the packet in the retransmit queue.
+ *
+ * @returns   Zero on success.
+ *            -ENOENT if there is no packet at @p idx.
+ */
+int _gnrc_tcp_pkt_retransmit(gnrc_tcp_tcb_t *tcb, const unsigned idx);
+
+/**
+ * @brief Acknowledges and removes packets from the retransmission mechanism.
  *
  * @param[in,out] tcb   TCB holding the connection information.
  * @param[in]     ack   Acknowldegment number used to acknowledge packets.
@@ -132,6 +154,27 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
  */
 int _gnrc_tcp_pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack);
 
+/**
+ * @brief Marks packets in the retransmit queue as selectively acknowledged.
+ *
+ * @param[in,out] tcb     TCB holding the connection information.
+ * @param[in]     left    Left edge of the block reported in a SACK option.
+ * @param[in]     right   Right edge of the block reported in a SACK option.
+ */
+void _gnrc_tcp_pkt_sack(gnrc_tcp_tcb_t *tcb, const uint32_t left, const uint32_t right);
+
+/**
+ * @brief Calculates the sender maximum segment size (SMSS).
+ *
+ * @param[in] tcb   TCB holding the connection information.
+ *
+ * @returns   Largest payload sent in a single segment.
+ */
+static inline uint32_t _gnrc_tcp_pkt_get_smss(const gnrc_tcp_tcb_t *tcb)
+{
+    return (tcb->mss < CONFIG_GNRC_TCP_MSS) ? tcb->mss : CONFIG_GNRC_TCP_MSS;
+}
+
 /**
  * @brief Calculates checksum over payload, TCP header and network layer header.
  *
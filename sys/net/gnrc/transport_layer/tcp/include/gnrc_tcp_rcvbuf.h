@@ -14,7 +14,7 @@
  * @{
  *
  * @file
- * @brief       Functions for allocating and freeing the receive buffer.
+ * @brief       Functions for the receive buffers and their shared pool.
  *
  * @author      Simon Brummer <simon.brummer@posteo.de>
  */
@@ -26,26 +26,78 @@ extern "C" {
 #endif
 
 /**
- * @brief Initializes global receive buffer.
+ * @brief Initializes the global receive buffer pool.
  */
 void _gnrc_tcp_rcvbuf_init(void);
 
 /**
- * @brief Allocate receive buffer and assign it to TCB.
+ * @brief Returns all blocks of the receive buffer and all reserved blocks to the pool.
  *
- * @param[in,out] tcb   TCB that acquires receive buffer.
+ * @param[in,out] tcb   TCB holding the receive buffer that should be released.
+ */
+void _gnrc_tcp_rcvbuf_release_buffer(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Reads data from the receive buffer.
+ *
+ * Blocks that were read completely are returned to the pool.
+ *
+ * @param[in,out] tcb   TCB holding the receive buffer.
+ * @param[out]    buf   Buffer to store the data into.
+ * @param[in]     len   Maximum number of bytes to read.
  *
- * @returns   Zero  on success.
- *            -ENOMEM if all receive buffers are currently used.
+ * @returns   Number of bytes read.
  */
-int _gnrc_tcp_rcvbuf_get_buffer(gnrc_tcp_tcb_t *tcb);
+size_t _gnrc_tcp_rcvbuf_get(gnrc_tcp_tcb_t *tcb, void *buf, size_t len);
 
 /**
- * @brief Release allocated receive buffer.
+ * @brief Calculates how many bytes the receive buffer can take.
  *
- * @param[in,out] tcb   TCB holding the receive buffer that should be released.
+ * Reserves the pool blocks needed to store the returned number of bytes for
+ * @p tcb, so that other connections can't take blocks from an already
+ * advertised window. The reservation is returned to the pool by
+ * _gnrc_tcp_rcvbuf_release_buffer().
+ *
+ * @param[in,out] tcb   TCB holding the receive buffer.
+ *
+ * @returns   Free space up to GNRC_TCP_RCV_BUF_SIZE, limited by the blocks
+ *            that could be reserved from the pool.
  */
-void _gnrc_tcp_rcvbuf_release_buffer(gnrc_tcp_tcb_t *tcb);
+uint32_t _gnrc_tcp_rcvbuf_get_window(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Adds the payload of a received segment to the receive buffer.
+ *
+ * Payload in front of tcb->rcv_nxt is skipped. A segment that starts behind
+ * tcb->rcv_nxt is kept in the out-of-order queue (see
+ * @ref CONFIG_GNRC_TCP_OOO_QUEUE_SIZE) until the data in front of it
+ * arrived. Advances tcb->rcv_nxt and updates tcb->rcv_wnd.
+ *
+ * @param[in,out] tcb   TCB holding the receive buffer.
+ * @param[in]     pkt   Received segment.
+ *
+ * @returns   Number of bytes added to the receive buffer.
+ */
+size_t _gnrc_tcp_rcvbuf_add(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt);
+
+/**
+ * @brief Releases all segments in the out-of-order queue.
+ *
+ * @param[in,out] tcb   TCB holding the out-of-order queue.
+ */
+void _gnrc_tcp_rcvbuf_clear_ooo(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Collects the blocks of data in the out-of-order queue.
+ *
+ * @param[in]  tcb      TCB holding the out-of-order queue.
+ * @param[out] blocks   Left and right edge of each block, ordered by sequence number.
+ * @param[in]  max      Maximum number of blocks that fit into @p blocks.
+ *
+ * @returns   Number of blocks written to @p blocks.
+ */
+unsigned _gnrc_tcp_rcvbuf_get_sack_blocks(const gnrc_tcp_tcb_t *tcb, uint32_t *blocks,
+                                          unsigned max);
 
 #ifdef __cplusplus
 }
@@ -45,6 +45,16 @@ static kernel_pid_t _pid = KERNEL_PID_UNDEF;
 static char _stack[GNRC_UDP_STACK_SIZE + DEBUG_EXTRA_STACKSIZE];
 static msg_t _msg_queue[GNRC_UDP_MSG_QUEUE_SIZE];
 
+#ifdef MODULE_GNRC_NETAPI_DIRECT
+static void _direct_receive(uint16_t cmd, gnrc_pktsnip_t *pkt, void *ctx);
+
+/**
+ * @brief   Lets IPv6 hand received packets to UDP in its own thread
+ */
+static gnrc_netreg_entry_direct_t _direct =
+    GNRC_NETREG_ENTRY_DIRECT_INIT(_direct_receive, NULL);
+#endif
+
 /**
  * @brief   Calculate the UDP checksum dependent on the network protocol
  *
@@ -217,12 +227,28 @@ static void _send(gnrc_pktsnip_t *pkt)
     }
 }
 
+#ifdef MODULE_GNRC_NETAPI_DIRECT
+static void _direct_receive(uint16_t cmd, gnrc_pktsnip_t *pkt, void *ctx)
+{
+    (void)cmd;
+    (void)ctx;
+    _receive(pkt);
+}
+#endif
+
 static void *_event_loop(void *arg)
 {
     (void)arg;
     msg_t msg, reply;
+#ifdef MODULE_GNRC_NETAPI_DIRECT
+    gnrc_netreg_entry_t netreg = GNRC_NETREG_ENTRY_INIT_DIRECT(GNRC_NETREG_DEMUX_CTX_ALL,
+                                                               &_direct);
+
+    _direct.pid = thread_getpid();
+#else
     gnrc_netreg_entry_t netreg = GNRC_NETREG_ENTRY_INIT_PID(GNRC_NETREG_DEMUX_CTX_ALL,
                                                             thread_getpid());
+#endif
     /* preset reply message */
     reply.type = GNRC_NETAPI_MSG_TYPE_ACK;
     reply.content.value = (uint32_t)-ENOTSUP;
@@ -234,6 +260,10 @@ static void *_event_loop(void *arg)
     /* dispatch NETAPI messages */
     while (1) {
         msg_receive(&msg);
+#ifdef MODULE_GNRC_NETAPI_DIRECT
+        /* keep _direct_receive() out while handling the message */
+        mutex_lock(&_direct.lock);
+#endif
         switch (msg.type) {
             case GNRC_NETAPI_MSG_TYPE_RCV:
                 DEBUG("udp: GNRC_NETAPI_MSG_TYPE_RCV\n");
@@ -251,6 +281,9 @@ static void *_event_loop(void *arg)
                 DEBUG("udp: received unidentified message\n");
                 break;
         }
+#ifdef MODULE_GNRC_NETAPI_DIRECT
+        mutex_unlock(&_direct.lock);
+#endif
     }
 
     /* never reached */
@@ -24,6 +24,10 @@
 #include "irq.h"
 #include "periph/pm.h"
 #include "pm_layered.h"
+#if IS_USED(MODULE_PM_LAYERED_PREDICTIVE)
+#include "timex.h"
+#include "ztimer.h"
+#endif
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -55,6 +59,68 @@
  */
 static pm_blocker_t pm_blocker = { .blockers = PM_BLOCKER_INITIAL };
 
+#if IS_USED(MODULE_PM_LAYERED_PREDICTIVE)
+static const uint32_t _exit_latency_us[PM_NUM_MODES] = PM_EXIT_LATENCY_US;
+static pm_residency_t _residency;
+
+static inline uint32_t _ticks_to_us(uint32_t ticks, uint32_t us_per_tick)
+{
+    return (ticks > UINT32_MAX / us_per_tick) ? UINT32_MAX
+                                              : ticks * us_per_tick;
+}
+
+static uint32_t _us_until_next_timer(void)
+{
+    uint32_t us = UINT32_MAX;
+
+#if IS_USED(MODULE_ZTIMER_USEC)
+    us = ztimer_until_next(ZTIMER_USEC);
+#endif
+#if IS_USED(MODULE_ZTIMER_MSEC)
+    uint32_t msec = _ticks_to_us(ztimer_until_next(ZTIMER_MSEC), US_PER_MS);
+    if (msec < us) {
+        us = msec;
+    }
+#endif
+#if IS_USED(MODULE_ZTIMER_SEC)
+    uint32_t sec = _ticks_to_us(ztimer_until_next(ZTIMER_SEC), US_PER_SEC);
+    if (sec < us) {
+        us = sec;
+    }
+#endif
+
+    return us;
+}
+
+/* move from the lowest unblocked mode up to the first one that wakes up in
+ * time for the next timer */
+static unsigned _predict(unsigned mode)
+{
+    uint32_t until_next = _us_until_next_timer();
+    unsigned lowest = mode;
+
+    while ((mode < PM_NUM_MODES) && (_exit_latency_us[mode] > until_next)) {
+        mode++;
+    }
+
+    if (mode != lowest) {
+        _residency.skipped[lowest]++;
+    }
+    if (mode != PM_NUM_MODES) {
+        _residency.entered[mode]++;
+    }
+
+    return mode;
+}
+
+void pm_get_residency(pm_residency_t *residency)
+{
+    unsigned state = irq_disable();
+    *residency = _residency;
+    irq_restore(state);
+}
+#endif
+
 void pm_set_lowest(void)
 {
     unsigned mode = PM_NUM_MODES;
@@ -68,6 +134,12 @@ void pm_set_lowest(void)
         mode--;
     }
 
+#if IS_USED(MODULE_PM_LAYERED_PREDICTIVE)
+    if (mode != PM_NUM_MODES) {
+        mode = _predict(mode);
+    }
+#endif
+
     if (mode != PM_NUM_MODES) {
         pm_set(mode);
     }
@@ -35,6 +35,38 @@
 #include "tlsf-malloc.h"
 #endif
 
+#ifdef MODULE_SCHEDSTATISTICS_HISTOGRAM
+static void _print_hist(const char *name, const schedstat_hist_t *hist)
+{
+    printf(" | %-8s | %10" PRIu32, name, hist->max_us);
+    for (unsigned i = 0; i < CONFIG_SCHEDSTATISTICS_HIST_NUMOF; i++) {
+        printf(" | %8" PRIu32, hist->count[i]);
+    }
+    puts("");
+}
+
+static void _print_histograms(void)
+{
+    printf("\n\tpid | histo    |     max us");
+    for (unsigned i = 0; i < CONFIG_SCHEDSTATISTICS_HIST_NUMOF; i++) {
+        printf(" | >=%6" PRIu32, schedstatistics_hist_bucket_min_us(i));
+    }
+    puts("");
+
+    for (kernel_pid_t i = KERNEL_PID_FIRST; i <= KERNEL_PID_LAST; i++) {
+        if (thread_get(i) != NULL) {
+            schedstat_hist_t latency, runtime;
+            schedstatistics_hist_get(i, &latency, &runtime);
+
+            printf("\t%3" PRIkernel_pid, i);
+            _print_hist("latency", &latency);
+            printf("\t%3s", "");
+            _print_hist("runtime", &runtime);
+        }
+    }
+}
+#endif /* MODULE_SCHEDSTATISTICS_HISTOGRAM */
+
 /**
  * @brief Prints a list of running threads including stack usage to stdout.
  */
@@ -149,4 +181,8 @@ void ps(void)
     printf("\tTotal used size: %u\n", sizes.used);
 #   endif
 #endif
+
+#ifdef MODULE_SCHEDSTATISTICS_HISTOGRAM
+    _print_histograms();
+#endif
 }
@@ -21,6 +21,10 @@
  * @}
  */
 
+#include <string.h>
+
+#include "bitarithm.h"
+#include "irq.h"
 #include "sched.h"
 #include "schedstatistics.h"
 #include "thread.h"
@@ -32,6 +36,58 @@
  */
 schedstat_t sched_pidlist[KERNEL_PID_LAST + 1];
 
+#if IS_USED(MODULE_SCHEDSTATISTICS_HISTOGRAM)
+/* threads are made runnable before ztimer is initialized, ignore those */
+static bool _hist_active;
+
+static void _hist_add(schedstat_hist_t *hist, uint32_t us)
+{
+    uint32_t scaled = us >> CONFIG_SCHEDSTATISTICS_HIST_SHIFT;
+    unsigned idx = CONFIG_SCHEDSTATISTICS_HIST_NUMOF - 1;
+
+    if (scaled < (1UL << (CONFIG_SCHEDSTATISTICS_HIST_NUMOF - 2))) {
+        idx = scaled ? bitarithm_msb(scaled) + 1 : 0;
+    }
+    hist->count[idx]++;
+
+    if (us > hist->max_us) {
+        hist->max_us = us;
+    }
+}
+
+void sched_wakeup_callback(kernel_pid_t pid)
+{
+    if (_hist_active) {
+        schedstat_t *stat = &sched_pidlist[pid];
+        stat->wakeup = ztimer_now(ZTIMER_USEC);
+        stat->pending = true;
+    }
+}
+
+void schedstatistics_hist_get(kernel_pid_t pid, schedstat_hist_t *latency,
+                              schedstat_hist_t *runtime)
+{
+    unsigned state = irq_disable();
+
+    if (latency) {
+        *latency = sched_pidlist[pid].latency;
+    }
+    if (runtime) {
+        *runtime = sched_pidlist[pid].runtime;
+    }
+    irq_restore(state);
+}
+
+void schedstatistics_hist_reset(kernel_pid_t pid)
+{
+    unsigned state = irq_disable();
+
+    memset(&sched_pidlist[pid].latency, 0, sizeof(schedstat_hist_t));
+    memset(&sched_pidlist[pid].runtime, 0, sizeof(schedstat_hist_t));
+    irq_restore(state);
+}
+#endif
+
 void sched_statistics_cb(kernel_pid_t active_thread, kernel_pid_t next_thread)
 {
     uint32_t now = ztimer_now(ZTIMER_USEC);
@@ -39,7 +95,11 @@ void sched_statistics_cb(kernel_pid_t active_thread, kernel_pid_t next_thread)
     /* Update active thread stats */
     if (!IS_USED(MODULE_CORE_IDLE_THREAD) || active_thread != KERNEL_PID_UNDEF) {
         schedstat_t *active_stat = &sched_pidlist[active_thread];
-        active_stat->runtime_us += now - active_stat->laststart;
+        uint32_t slice = now - active_stat->laststart;
+        active_stat->runtime_us += slice;
+#if IS_USED(MODULE_SCHEDSTATISTICS_HISTOGRAM)
+        _hist_add(&active_stat->runtime, slice);
+#endif
     }
 
     /* Update next_thread stats */
@@ -47,6 +107,12 @@ void sched_statistics_cb(kernel_pid_t active_thread, kernel_pid_t next_thread)
         schedstat_t *next_stat = &sched_pidlist[next_thread];
         next_stat->laststart = now;
         next_stat->schedules++;
+#if IS_USED(MODULE_SCHEDSTATISTICS_HISTOGRAM)
+        if (next_stat->pending) {
+            next_stat->pending = false;
+            _hist_add(&next_stat->latency, now - next_stat->wakeup);
+        }
+#endif
     }
 }
 
@@ -58,4 +124,7 @@ void init_schedstatistics(void)
     active_stat->laststart = ztimer_now(ZTIMER_USEC);
     active_stat->schedules = 1;
     sched_register_cb(sched_statistics_cb);
+#if IS_USED(MODULE_SCHEDSTATISTICS_HISTOGRAM)
+    _hist_active = true;
+#endif
 }
@@ -182,6 +182,13 @@ static int _netif_stats(netif_t *iface, unsigned module, bool reset)
                (unsigned)stats.tx_bytes,
                (unsigned)stats.tx_success,
                (unsigned)stats.tx_failed);
+#if CONFIG_GNRC_IPV6_DST_CACHE_NUMOF
+        if (module == NETSTATS_IPV6) {
+            printf("            Destination cache hits %u misses %u\n",
+                   (unsigned)stats.dst_cache_hits,
+                   (unsigned)stats.dst_cache_misses);
+        }
+#endif
         res = 0;
     }
     return res;
@@ -15,6 +15,7 @@
 
 #include <stdio.h>
 
+#include "net/gnrc/netif.h"
 #include "net/gnrc/sixlowpan/frag/stats.h"
 #include "shell.h"
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR_STATS
@@ -31,6 +32,20 @@ static int _gnrc_6lo_frag_stats(int argc, char **argv)
     printf("frag full: %u\n", stats->frag_full);
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
     printf("VRB full: %u\n", stats->vrb_full);
+    printf("frags forwarded: %u\n", stats->fwd_fragments);
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_STATS_FLOWS; i++) {
+        const gnrc_sixlowpan_frag_stats_flow_t *flow = &stats->flows[i];
+        char addr_str[3 * IEEE802154_LONG_ADDRESS_LEN];
+
+        if (flow->src_len == 0) {
+            break;
+        }
+        printf("  %s => ", gnrc_netif_addr_to_str(flow->src, flow->src_len,
+                                                  addr_str));
+        printf("%s: %u\n", gnrc_netif_addr_to_str(flow->dst, flow->dst_len,
+                                                  addr_str),
+               flow->fragments);
+    }
 #endif
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR_STATS
     gnrc_sixlowpan_frag_sfr_stats_t sfr;
@@ -17,6 +17,8 @@
  * @}
  */
 
+#include <string.h>
+
 #include "irq.h"
 #include "tsrb.h"
 
@@ -35,6 +37,32 @@ static uint8_t _peek(tsrb_t *rb, unsigned int idx)
     return rb->buf[(rb->reads + idx) & (rb->size - 1)];
 }
 
+/* split n bytes starting at counter value pos into up to two contiguous
+ * regions of the buffer */
+static void _split(const tsrb_t *rb, unsigned pos, unsigned n,
+                   tsrb_region_t regions[2])
+{
+    unsigned idx = pos & (rb->size - 1);
+    unsigned first = rb->size - idx;
+
+    if (first > n) {
+        first = n;
+    }
+    regions[0].data = &rb->buf[idx];
+    regions[0].len = first;
+    regions[1].data = rb->buf;
+    regions[1].len = n - first;
+}
+
+static void _copy_out(const tsrb_t *rb, uint8_t *dst, unsigned n)
+{
+    tsrb_region_t regions[2];
+
+    _split(rb, rb->reads, n, regions);
+    memcpy(dst, regions[0].data, regions[0].len);
+    memcpy(dst + regions[0].len, regions[1].data, regions[1].len);
+}
+
 int tsrb_get_one(tsrb_t *rb)
 {
     int retval = -1;
@@ -59,38 +87,39 @@ int tsrb_peek_one(tsrb_t *rb)
 
 int tsrb_get(tsrb_t *rb, uint8_t *dst, size_t n)
 {
-    size_t tmp = n;
     unsigned irq_state = irq_disable();
-    while (tmp && !tsrb_empty(rb)) {
-        *dst++ = _pop(rb);
-        tmp--;
+    unsigned avail = rb->writes - rb->reads;
+    if (n > avail) {
+        n = avail;
     }
+    _copy_out(rb, dst, n);
+    rb->reads += n;
     irq_restore(irq_state);
-    return (n - tmp);
+    return n;
 }
 
 int tsrb_peek(tsrb_t *rb, uint8_t *dst, size_t n)
 {
-    size_t idx = 0;
     unsigned irq_state = irq_disable();
-    unsigned int avail = tsrb_avail(rb);
-    while (idx < n && idx != avail) {
-        *dst++ = _peek(rb, idx++);
+    unsigned avail = rb->writes - rb->reads;
+    if (n > avail) {
+        n = avail;
     }
+    _copy_out(rb, dst, n);
     irq_restore(irq_state);
-    return idx;
+    return n;
 }
 
 int tsrb_drop(tsrb_t *rb, size_t n)
 {
-    size_t tmp = n;
     unsigned irq_state = irq_disable();
-    while (tmp && !tsrb_empty(rb)) {
-        _pop(rb);
-        tmp--;
+    unsigned avail = rb->writes - rb->reads;
+    if (n > avail) {
+        n = avail;
     }
+    rb->reads += n;
     irq_restore(irq_state);
-    return (n - tmp);
+    return n;
 }
 
 int tsrb_add_one(tsrb_t *rb, uint8_t c)
@@ -107,12 +136,42 @@ int tsrb_add_one(tsrb_t *rb, uint8_t c)
 
 int tsrb_add(tsrb_t *rb, const uint8_t *src, size_t n)
 {
-    size_t tmp = n;
+    tsrb_region_t regions[2];
     unsigned irq_state = irq_disable();
-    while (tmp && !tsrb_full(rb)) {
-        _push(rb, *src++);
-        tmp--;
+    unsigned space = rb->size - (rb->writes - rb->reads);
+    if (n > space) {
+        n = space;
     }
+    _split(rb, rb->writes, n, regions);
+    memcpy(regions[0].data, src, regions[0].len);
+    memcpy(regions[1].data, src + regions[0].len, regions[1].len);
+    rb->writes += n;
+    irq_restore(irq_state);
+    return n;
+}
+
+unsigned int tsrb_peek_regions(tsrb_t *rb, tsrb_region_t regions[2])
+{
+    unsigned irq_state = irq_disable();
+    unsigned avail = rb->writes - rb->reads;
+    _split(rb, rb->reads, avail, regions);
+    irq_restore(irq_state);
+    return avail;
+}
+
+unsigned int tsrb_free_regions(tsrb_t *rb, tsrb_region_t regions[2])
+{
+    unsigned irq_state = irq_disable();
+    unsigned space = rb->size - (rb->writes - rb->reads);
+    _split(rb, rb->writes, space, regions);
+    irq_restore(irq_state);
+    return space;
+}
+
+void tsrb_commit(tsrb_t *rb, size_t n)
+{
+    unsigned irq_state = irq_disable();
+    assert(n <= rb->size - (rb->writes - rb->reads));
+    rb->writes += n;
     irq_restore(irq_state);
-    return (n - tmp);
 }
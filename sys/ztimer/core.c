@@ -32,16 +32,21 @@
 #include "pm_layered.h"
 #endif
 #include "ztimer.h"
+#if MODULE_ZTIMER_WHEEL
+#include "ztimer/wheel.h"
+#endif
 #include "log.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
 static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry);
+static void _insert_into_list(ztimer_clock_t *clock, ztimer_base_t *entry);
 static bool _del_entry_from_list(ztimer_clock_t *clock, ztimer_base_t *entry);
 static void _ztimer_update(ztimer_clock_t *clock);
 static void _ztimer_print(const ztimer_clock_t *clock);
 static uint32_t _ztimer_update_head_offset(ztimer_clock_t *clock);
+static bool _next_offset(const ztimer_clock_t *clock, uint32_t *offset);
 
 #ifdef MODULE_ZTIMER_EXTEND
 static inline uint32_t _min_u32(uint32_t a, uint32_t b)
@@ -50,6 +55,16 @@ static inline uint32_t _min_u32(uint32_t a, uint32_t b)
 }
 #endif
 
+static inline bool _has_timers(const ztimer_clock_t *clock)
+{
+#if MODULE_ZTIMER_WHEEL
+    if (clock->wheel && clock->wheel->count) {
+        return true;
+    }
+#endif
+    return clock->list.next != NULL;
+}
+
 #if MODULE_ZTIMER_ONDEMAND
 static bool _ztimer_acquire(ztimer_clock_t *clock)
 {
@@ -114,6 +129,12 @@ bool ztimer_release(ztimer_clock_t *clock)
 
 static unsigned _is_set(const ztimer_clock_t *clock, const ztimer_t *t)
 {
+#if MODULE_ZTIMER_WHEEL
+    /* don't trust prev, the timer might never have been set */
+    if (clock->wheel && ztimer_wheel_contains(clock->wheel, &t->base)) {
+        return 1;
+    }
+#endif
     if (!clock->list.next) {
         return 0;
     }
@@ -131,6 +152,21 @@ unsigned ztimer_is_set(const ztimer_clock_t *clock, const ztimer_t *timer)
     return res;
 }
 
+uint32_t ztimer_until_next(ztimer_clock_t *clock)
+{
+    uint32_t until = UINT32_MAX;
+    uint32_t offset;
+    unsigned state = irq_disable();
+
+    if (_next_offset(clock, &offset)) {
+        uint32_t elapsed = ztimer_now(clock) - clock->list.offset;
+        until = (offset > elapsed) ? offset - elapsed : 0;
+    }
+
+    irq_restore(state);
+    return until;
+}
+
 bool ztimer_remove(ztimer_clock_t *clock, ztimer_t *timer)
 {
     bool was_removed = false;
@@ -156,7 +192,31 @@ bool ztimer_remove(ztimer_clock_t *clock, ztimer_t *timer)
     return was_removed;
 }
 
-uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
+#if MODULE_ZTIMER_SLACK
+/* move val onto an already scheduled expiration within [val, val + slack] */
+static uint32_t _coalesce(ztimer_clock_t *clock, uint32_t val, uint32_t slack)
+{
+    uint32_t target = 0;
+
+    for (ztimer_base_t *entry = clock->list.next; entry; entry = entry->next) {
+        target += entry->offset;
+        if (target >= val) {
+            if ((target - val) <= slack) {
+                if (target != val) {
+                    clock->coalesced++;
+                }
+                return target;
+            }
+            break;
+        }
+    }
+
+    return val;
+}
+#endif
+
+static uint32_t _ztimer_set(ztimer_clock_t *clock, ztimer_t *timer,
+                            uint32_t val, uint32_t slack)
 {
     unsigned state = irq_disable();
 
@@ -191,6 +251,14 @@ uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
         val = 0;
     }
 
+#if MODULE_ZTIMER_SLACK
+    if (slack) {
+        val = _coalesce(clock, val, slack);
+    }
+#else
+    (void)slack;
+#endif
+
     timer->base.offset = val;
     _add_entry_to_list(clock, &timer->base);
     _ztimer_update(clock);
@@ -213,20 +281,47 @@ uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
     return now;
 }
 
-static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry)
+uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
 {
-    uint32_t delta_sum = 0;
+    return _ztimer_set(clock, timer, val, 0);
+}
 
-    ztimer_base_t *list = &clock->list;
+#if MODULE_ZTIMER_SLACK
+uint32_t ztimer_set_with_slack(ztimer_clock_t *clock, ztimer_t *timer,
+                               uint32_t val, uint32_t slack)
+{
+    return _ztimer_set(clock, timer, val, slack);
+}
+#endif
 
+static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
 #if MODULE_PM_LAYERED && !MODULE_ZTIMER_ONDEMAND
-    /* First timer on the clock's linked list */
-    if (list->next == NULL &&
+    /* First timer on the clock */
+    if (!_has_timers(clock) &&
         clock->block_pm_mode != ZTIMER_CLOCK_NO_REQUIRED_PM_MODE) {
         pm_block(clock->block_pm_mode);
     }
 #endif
 
+#if MODULE_ZTIMER_WHEEL
+    /* timers not due within the current slot go into the wheel */
+    if (clock->wheel &&
+        ztimer_wheel_add(clock->wheel, entry, clock->list.offset)) {
+        return;
+    }
+    entry->prev = NULL;
+#endif
+
+    _insert_into_list(clock, entry);
+}
+
+static void _insert_into_list(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
+    uint32_t delta_sum = 0;
+
+    ztimer_base_t *list = &clock->list;
+
     /* Jump past all entries which are set to an earlier target than the new entry */
     while (list->next) {
         ztimer_base_t *list_entry = list->next;
@@ -247,7 +342,7 @@ static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry)
         clock->last = entry;
     }
     list->next = entry;
-    DEBUG("_add_entry_to_list() %p offset %" PRIu32 "\n", (void *)entry,
+    DEBUG("_insert_into_list() %p offset %" PRIu32 "\n", (void *)entry,
           entry->offset);
 
 }
@@ -335,7 +430,14 @@ static bool _del_entry_from_list(ztimer_clock_t *clock, ztimer_base_t *entry)
 
     assert(_is_set(clock, (ztimer_t *)entry));
 
-    while (list->next) {
+#if MODULE_ZTIMER_WHEEL
+    if (clock->wheel && ztimer_wheel_contains(clock->wheel, entry)) {
+        ztimer_wheel_del(clock->wheel, entry);
+        was_removed = true;
+    }
+#endif
+
+    while (!was_removed && list->next) {
         ztimer_base_t *list_entry = list->next;
         if (list_entry == entry) {
             if (entry == clock->last) {
@@ -359,8 +461,8 @@ static bool _del_entry_from_list(ztimer_clock_t *clock, ztimer_base_t *entry)
     }
 
 #if MODULE_PM_LAYERED && !MODULE_ZTIMER_ONDEMAND
-    /* The last timer just got removed from the clock's linked list */
-    if (clock->list.next == NULL &&
+    /* The last timer just got removed from the clock */
+    if (!_has_timers(clock) &&
         clock->block_pm_mode != ZTIMER_CLOCK_NO_REQUIRED_PM_MODE) {
         pm_unblock(clock->block_pm_mode);
     }
@@ -379,7 +481,8 @@ static ztimer_t *_now_next(ztimer_clock_t *clock)
             /* The last timer just got removed from the clock's linked list */
             clock->last = NULL;
 #if MODULE_PM_LAYERED && !MODULE_ZTIMER_ONDEMAND
-            if (clock->block_pm_mode != ZTIMER_CLOCK_NO_REQUIRED_PM_MODE) {
+            if (!_has_timers(clock) &&
+                clock->block_pm_mode != ZTIMER_CLOCK_NO_REQUIRED_PM_MODE) {
                 pm_unblock(clock->block_pm_mode);
             }
 #endif
@@ -395,14 +498,64 @@ static ztimer_t *_now_next(ztimer_clock_t *clock)
     }
 }
 
+/* get the number of ticks after clock->list.offset at which the clock needs
+ * to be serviced next, returns false if there is nothing to do */
+static bool _next_offset(const ztimer_clock_t *clock, uint32_t *offset)
+{
+    bool pending = false;
+
+    if (clock->list.next) {
+        *offset = clock->list.next->offset;
+        pending = true;
+    }
+
+#if MODULE_ZTIMER_WHEEL
+    uint32_t start;
+    if (clock->wheel && ztimer_wheel_next(clock->wheel, &start)) {
+        int32_t diff = start - clock->list.offset;
+        uint32_t wheel_offset = (diff > 0) ? (uint32_t)diff : 0;
+
+        if (!pending || (wheel_offset < *offset)) {
+            *offset = wheel_offset;
+        }
+        pending = true;
+    }
+#endif
+
+    return pending;
+}
+
+#if MODULE_ZTIMER_WHEEL
+/* move timers which are due within the current wheel slot into the list */
+static void _wheel_advance(ztimer_clock_t *clock)
+{
+    if (!clock->wheel || !clock->wheel->count) {
+        return;
+    }
+
+    uint32_t now = _ztimer_update_head_offset(clock);
+    ztimer_base_t *entry = ztimer_wheel_advance(clock->wheel, now);
+
+    while (entry) {
+        ztimer_base_t *next = entry->next;
+        int32_t diff = entry->offset - clock->list.offset;
+
+        entry->offset = (diff > 0) ? (uint32_t)diff : 0;
+        _insert_into_list(clock, entry);
+        entry = next;
+    }
+}
+#endif
+
 static void _ztimer_update(ztimer_clock_t *clock)
 {
+    uint32_t offset;
+    bool pending = _next_offset(clock, &offset);
+
 #ifdef MODULE_ZTIMER_EXTEND
     if (clock->max_value < UINT32_MAX) {
-        if (clock->list.next) {
-            clock->ops->set(clock,
-                            _min_u32(clock->list.next->offset,
-                                     clock->max_value >> 1));
+        if (pending) {
+            clock->ops->set(clock, _min_u32(offset, clock->max_value >> 1));
         }
         else {
             clock->ops->set(clock, clock->max_value >> 1);
@@ -412,8 +565,8 @@ static void _ztimer_update(ztimer_clock_t *clock)
 #endif
     }
     else {
-        if (clock->list.next) {
-            clock->ops->set(clock, clock->list.next->offset);
+        if (pending) {
+            clock->ops->set(clock, offset);
         }
         else {
             clock->ops->cancel(clock);
@@ -435,9 +588,10 @@ void ztimer_handler(ztimer_clock_t *clock)
     if (clock->max_value < UINT32_MAX) {
         /* calling now triggers checkpointing */
         uint32_t now = ztimer_now(clock);
+        uint32_t offset;
 
-        if (clock->list.next) {
-            uint32_t target = clock->list.offset + clock->list.next->offset;
+        if (_next_offset(clock, &offset)) {
+            uint32_t target = clock->list.offset + offset;
             int32_t diff = (int32_t)(target - now);
             if (diff > 0) {
                 DEBUG("ztimer_handler(): %p postponing by %" PRIi32 "\n",
@@ -462,9 +616,24 @@ void ztimer_handler(ztimer_clock_t *clock)
 #endif
 
     if (clock->list.next) {
-        clock->list.offset += clock->list.next->offset;
-        clock->list.next->offset = 0;
+        bool head_due = true;
+#if MODULE_ZTIMER_WHEEL
+        /* the clock might have been armed for the wheel instead of the head */
+        uint32_t offset;
+        _next_offset(clock, &offset);
+        head_due = (clock->list.next->offset <= offset);
+#endif
+        if (head_due) {
+            clock->list.offset += clock->list.next->offset;
+            clock->list.next->offset = 0;
+        }
+    }
 
+#if MODULE_ZTIMER_WHEEL
+    _wheel_advance(clock);
+#endif
+
+    if (clock->list.next) {
         ztimer_t *entry = _now_next(clock);
         while (entry) {
             DEBUG("ztimer_handler(): trigger %p->%p at %" PRIu32 "\n",
@@ -0,0 +1,225 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_ztimer_wheel
+ * @{
+ *
+ * @file
+ * @brief       ztimer hashed timing wheel implementation
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <inttypes.h>
+#include <string.h>
+
+#include "bitarithm.h"
+#include "irq.h"
+#include "macros/utils.h"
+#include "ztimer/wheel.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#define SLOT_MASK   (CONFIG_ZTIMER_WHEEL_SLOTS - 1)
+
+static_assert(!(CONFIG_ZTIMER_WHEEL_SLOTS & SLOT_MASK),
+              "CONFIG_ZTIMER_WHEEL_SLOTS must be a power of two");
+
+static inline unsigned _slot(const ztimer_wheel_t *wheel, uint32_t time)
+{
+    return (time >> wheel->shift) & SLOT_MASK;
+}
+
+static inline void _map_set(ztimer_wheel_t *wheel, unsigned slot)
+{
+    wheel->map[slot / ZTIMER_WHEEL_MAP_BITS] |=
+        1U << (slot % ZTIMER_WHEEL_MAP_BITS);
+}
+
+static inline void _map_clear(ztimer_wheel_t *wheel, unsigned slot)
+{
+    wheel->map[slot / ZTIMER_WHEEL_MAP_BITS] &=
+        ~(1U << (slot % ZTIMER_WHEEL_MAP_BITS));
+}
+
+static inline bool _map_test(const ztimer_wheel_t *wheel, unsigned slot)
+{
+    return wheel->map[slot / ZTIMER_WHEEL_MAP_BITS] &
+           (1U << (slot % ZTIMER_WHEEL_MAP_BITS));
+}
+
+static void _unlink(ztimer_wheel_t *wheel, ztimer_base_t *entry)
+{
+    entry->prev->next = entry->next;
+    if (entry->next) {
+        entry->next->prev = entry->prev;
+    }
+
+    unsigned slot = _slot(wheel, entry->offset);
+    if (!wheel->slots[slot].next) {
+        _map_clear(wheel, slot);
+    }
+
+    entry->prev = NULL;
+    entry->next = NULL;
+    wheel->count--;
+}
+
+void ztimer_wheel_init(ztimer_clock_t *clock, ztimer_wheel_t *wheel,
+                       uint8_t shift)
+{
+    assert(((uint64_t)CONFIG_ZTIMER_WHEEL_SLOTS << shift) <= (1ULL << 31));
+
+    unsigned state = irq_disable();
+
+    assert(!clock->list.next && (!clock->wheel || !clock->wheel->count));
+
+    memset(wheel, 0, sizeof(*wheel));
+    wheel->shift = shift;
+    clock->wheel = wheel;
+
+    irq_restore(state);
+}
+
+bool ztimer_wheel_add(ztimer_wheel_t *wheel, ztimer_base_t *entry,
+                      uint32_t now)
+{
+    if (!wheel->count) {
+        /* nothing to keep track of, start over at the current time */
+        wheel->horizon = (now & ~((1UL << wheel->shift) - 1)) +
+                         (1UL << wheel->shift);
+    }
+
+    int32_t until_horizon = wheel->horizon - now;
+    if (entry->offset < (uint32_t)MAX(until_horizon, 0)) {
+        return false;
+    }
+
+    uint32_t target = now + entry->offset;
+    unsigned slot = _slot(wheel, target);
+    ztimer_base_t *head = &wheel->slots[slot];
+
+    DEBUG("ztimer_wheel_add(): %p target %" PRIu32 " slot %u\n",
+          (void *)entry, target, slot);
+
+    entry->offset = target;
+    entry->next = head->next;
+    entry->prev = head;
+    if (head->next) {
+        head->next->prev = entry;
+    }
+    head->next = entry;
+
+    _map_set(wheel, slot);
+    wheel->count++;
+
+    return true;
+}
+
+void ztimer_wheel_del(ztimer_wheel_t *wheel, ztimer_base_t *entry)
+{
+    assert(entry->prev);
+
+    DEBUG("ztimer_wheel_del(): %p\n", (void *)entry);
+    _unlink(wheel, entry);
+}
+
+bool ztimer_wheel_contains(const ztimer_wheel_t *wheel,
+                           const ztimer_base_t *entry)
+{
+    if (!wheel->count) {
+        return false;
+    }
+
+    /* timers in the wheel store their target time in offset */
+    const ztimer_base_t *iter = wheel->slots[_slot(wheel, entry->offset)].next;
+    while (iter) {
+        if (iter == entry) {
+            return true;
+        }
+        iter = iter->next;
+    }
+
+    return false;
+}
+
+bool ztimer_wheel_next(const ztimer_wheel_t *wheel, uint32_t *start)
+{
+    if (!wheel->count) {
+        return false;
+    }
+
+    unsigned first = _slot(wheel, wheel->horizon);
+    unsigned dist = 0;
+
+    /* scan the occupancy bitmap word-wise, starting at the horizon */
+    while (dist < CONFIG_ZTIMER_WHEEL_SLOTS) {
+        unsigned slot = (first + dist) & SLOT_MASK;
+        unsigned bit = slot % ZTIMER_WHEEL_MAP_BITS;
+        unsigned bits = wheel->map[slot / ZTIMER_WHEEL_MAP_BITS] >> bit;
+
+        if (bits) {
+            dist += bitarithm_lsb(bits);
+            break;
+        }
+        dist += MIN(ZTIMER_WHEEL_MAP_BITS - bit,
+                    CONFIG_ZTIMER_WHEEL_SLOTS - slot);
+    }
+
+    /* count != 0, so there is an occupied slot within one revolution */
+    assert(dist < CONFIG_ZTIMER_WHEEL_SLOTS);
+
+    *start = wheel->horizon + ((uint32_t)dist << wheel->shift);
+    return true;
+}
+
+ztimer_base_t *ztimer_wheel_advance(ztimer_wheel_t *wheel, uint32_t now)
+{
+    ztimer_base_t *due = NULL;
+    uint32_t start = wheel->horizon;
+
+    if (!wheel->count || ((int32_t)(now - start) < 0)) {
+        return NULL;
+    }
+
+    /* move the horizon to the end of the slot containing now */
+    uint32_t end = (now & ~((1UL << wheel->shift) - 1)) + (1UL << wheel->shift);
+    uint32_t span = end - start;
+    uint32_t steps = MIN(span >> wheel->shift, CONFIG_ZTIMER_WHEEL_SLOTS);
+    unsigned slot = _slot(wheel, start);
+
+    wheel->horizon = end;
+
+    for (uint32_t i = 0; i < steps; i++, slot = (slot + 1) & SLOT_MASK) {
+        if (!_map_test(wheel, slot)) {
+            continue;
+        }
+
+        ztimer_base_t *entry = wheel->slots[slot].next;
+        while (entry) {
+            ztimer_base_t *next = entry->next;
+
+            /* all timers in the wheel are due at or after start, so this
+             * also rejects timers of later revolutions */
+            if ((entry->offset - start) < span) {
+                _unlink(wheel, entry);
+                entry->next = due;
+                due = entry;
+            }
+            entry = next;
+        }
+    }
+
+    DEBUG("ztimer_wheel_advance(): now %" PRIu32 " horizon %" PRIu32 "\n",
+          now, end);
+
+    return due;
+}
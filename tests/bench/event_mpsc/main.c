@@ -0,0 +1,225 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Regular vs. lock-free MPSC event queue benchmark
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "clk.h"
+#include "event.h"
+#include "event/mpsc.h"
+#include "macros/units.h"
+#include "timex.h"
+#include "ztimer.h"
+#include "ztimer/periodic.h"
+
+#ifndef TEST_DURATION_US
+#define TEST_DURATION_US    (1000000U)
+#endif
+
+#ifndef NUMOF_EVENTS
+#define NUMOF_EVENTS        (16U)
+#endif
+
+#ifndef NUMOF_SOURCES
+#define NUMOF_SOURCES       (4U)
+#endif
+
+#ifndef SOURCE_PERIOD_US
+#define SOURCE_PERIOD_US    (400U)
+#endif
+
+typedef struct {
+    event_t super;
+    unsigned idx;
+} bench_event_t;
+
+typedef struct {
+    ztimer_periodic_t timer;
+    bench_event_t events[NUMOF_EVENTS];
+} source_t;
+
+static event_queue_t _queue;
+static event_mpsc_queue_t _mpsc;
+static bool _use_mpsc;
+
+static source_t _sources[NUMOF_SOURCES];
+static uint32_t _handled;
+static uint32_t _posted;
+static uint32_t _coalesced;
+static uint32_t _isr_us;
+static bool _done;
+
+static void _post(event_t *event)
+{
+    if (_use_mpsc) {
+        event_mpsc_post(&_mpsc, event);
+    }
+    else {
+        event_post(&_queue, event);
+    }
+}
+
+static event_t *_get(void)
+{
+    return _use_mpsc ? event_mpsc_get(&_mpsc) : event_get(&_queue);
+}
+
+static event_t *_wait(void)
+{
+    return _use_mpsc ? event_mpsc_wait(&_mpsc) : event_wait(&_queue);
+}
+
+static bool _is_queued(const event_t *event)
+{
+    return _use_mpsc ? event_mpsc_is_queued(event)
+                     : event_is_queued(&_queue, event);
+}
+
+static void _handler(event_t *event)
+{
+    (void)event;
+    _handled++;
+}
+
+static void _stop_handler(event_t *event)
+{
+    (void)event;
+    _done = true;
+}
+
+static bool _source_cb(void *arg)
+{
+    source_t *source = arg;
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+
+    for (unsigned i = 0; i < NUMOF_EVENTS; i++) {
+        event_t *event = &source->events[i].super;
+        if (_is_queued(event)) {
+            _coalesced++;
+        }
+        else {
+            _posted++;
+        }
+        _post(event);
+    }
+
+    _isr_us += ztimer_now(ZTIMER_USEC) - start;
+    return ZTIMER_PERIODIC_KEEP_GOING;
+}
+
+static void _stop_cb(void *arg)
+{
+    _post(arg);
+}
+
+static const char *_name(void)
+{
+    return _use_mpsc ? "mpsc" : "event";
+}
+
+static void _run_thread(void)
+{
+    bench_event_t events[NUMOF_EVENTS];
+    uint32_t count = 0;
+    uint32_t errors = 0;
+
+    for (unsigned i = 0; i < NUMOF_EVENTS; i++) {
+        events[i] = (bench_event_t){ .super.handler = _handler, .idx = i };
+    }
+
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    while ((ztimer_now(ZTIMER_USEC) - start) < TEST_DURATION_US) {
+        for (unsigned i = 0; i < NUMOF_EVENTS; i++) {
+            _post(&events[i].super);
+        }
+        for (unsigned i = 0; i < NUMOF_EVENTS; i++) {
+            bench_event_t *event = (bench_event_t *)_get();
+            if (!event || (event->idx != i)) {
+                errors++;
+            }
+        }
+        count += NUMOF_EVENTS;
+    }
+
+    printf("{ \"queue\" : \"%s\", \"test\" : \"thread\", \"result\" : %" PRIu32,
+           _name(), count);
+    printf(", \"ticks\" : %" PRIu32,
+           (uint32_t)((TEST_DURATION_US/US_PER_MS) * (coreclk()/KHZ(1)))/count);
+    printf(", \"errors\" : %" PRIu32 " }\n", errors);
+}
+
+static void _run_isr(void)
+{
+    event_t stop = { .handler = _stop_handler };
+    ztimer_t stop_timer = { .callback = _stop_cb, .arg = &stop };
+
+    _handled = 0;
+    _posted = 0;
+    _coalesced = 0;
+    _isr_us = 0;
+    _done = false;
+
+    for (unsigned n = 0; n < NUMOF_SOURCES; n++) {
+        for (unsigned i = 0; i < NUMOF_EVENTS; i++) {
+            _sources[n].events[i] = (bench_event_t){
+                .super.handler = _handler, .idx = i
+            };
+        }
+        /* use slightly different periods so the sources drift */
+        ztimer_periodic_init(ZTIMER_USEC, &_sources[n].timer, _source_cb,
+                             &_sources[n], SOURCE_PERIOD_US + n * 10);
+        ztimer_periodic_start(&_sources[n].timer);
+    }
+    ztimer_set(ZTIMER_USEC, &stop_timer, TEST_DURATION_US);
+
+    while (!_done) {
+        event_t *event = _wait();
+        event->handler(event);
+    }
+
+    for (unsigned n = 0; n < NUMOF_SOURCES; n++) {
+        ztimer_periodic_stop(&_sources[n].timer);
+    }
+
+    /* handle what is left */
+    event_t *event;
+    while ((event = _get())) {
+        event->handler(event);
+    }
+
+    printf("{ \"queue\" : \"%s\", \"test\" : \"isr\", \"result\" : %" PRIu32,
+           _name(), _handled);
+    printf(", \"coalesced\" : %" PRIu32 ", \"isr_us\" : %" PRIu32,
+           _coalesced, _isr_us);
+    printf(", \"errors\" : %" PRIu32 " }\n", (uint32_t)(_handled != _posted));
+}
+
+int main(void)
+{
+    puts("main starting");
+
+    event_queue_init(&_queue);
+    event_mpsc_queue_init(&_mpsc);
+
+    for (unsigned i = 0; i < 2; i++) {
+        _use_mpsc = i;
+        _run_thread();
+        _run_isr();
+    }
+
+    return 0;
+}
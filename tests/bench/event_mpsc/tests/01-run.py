@@ -0,0 +1,24 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    for queue in ("event", "mpsc"):
+        child.expect(r"{ \"queue\" : \"%s\", \"test\" : \"thread\", "
+                     r"\"result\" : \d+, \"ticks\" : \d+, \"errors\" : 0 }"
+                     % queue)
+        child.expect(r"{ \"queue\" : \"%s\", \"test\" : \"isr\", "
+                     r"\"result\" : \d+, \"coalesced\" : \d+, "
+                     r"\"isr_us\" : \d+, \"errors\" : 0 }" % queue)
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
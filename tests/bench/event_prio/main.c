@@ -0,0 +1,163 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       FIFO vs. priority event queue dispatch latency benchmark
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "event.h"
+#include "event/prio.h"
+#include "ztimer.h"
+#include "ztimer/periodic.h"
+
+#ifndef TEST_DURATION_US
+#define TEST_DURATION_US    (1000000U)
+#endif
+
+#ifndef NUMOF_SLOW
+#define NUMOF_SLOW          (4U)
+#endif
+
+#ifndef SLOW_US
+#define SLOW_US             (250U)
+#endif
+
+#ifndef PERIOD_US
+#define PERIOD_US           (2000U)
+#endif
+
+enum {
+    URGENCY_HIGH,
+    URGENCY_LOW,
+};
+
+static event_queue_t _fifo;
+static event_prio_queue_t _prio;
+static bool _use_prio;
+
+static event_prio_t _slow[NUMOF_SLOW];
+static event_prio_t _urgent;
+
+static uint32_t _posted_at;
+static uint32_t _count;
+static uint32_t _sum_us;
+static uint32_t _max_us;
+
+static void _post(event_prio_t *event, uint32_t urgency)
+{
+    if (_use_prio) {
+        event_prio_post(&_prio, event, urgency);
+    }
+    else {
+        event_post(&_fifo, &event->super);
+    }
+}
+
+static bool _is_queued(const event_prio_t *event)
+{
+    return _use_prio ? event_prio_is_queued(event)
+                     : event_is_queued(&_fifo, &event->super);
+}
+
+static event_t *_wait(void)
+{
+    return _use_prio ? &event_prio_wait(&_prio)->super : event_wait(&_fifo);
+}
+
+static void _slow_handler(event_t *event)
+{
+    (void)event;
+    ztimer_spin(ZTIMER_USEC, SLOW_US);
+}
+
+static void _urgent_handler(event_t *event)
+{
+    (void)event;
+    uint32_t latency = ztimer_now(ZTIMER_USEC) - _posted_at;
+
+    _count++;
+    _sum_us += latency;
+    if (latency > _max_us) {
+        _max_us = latency;
+    }
+}
+
+static bool _load_cb(void *arg)
+{
+    (void)arg;
+
+    for (unsigned i = 0; i < NUMOF_SLOW; i++) {
+        _post(&_slow[i], URGENCY_LOW);
+    }
+    if (!_is_queued(&_urgent)) {
+        _posted_at = ztimer_now(ZTIMER_USEC);
+        _post(&_urgent, URGENCY_HIGH);
+    }
+
+    return ZTIMER_PERIODIC_KEEP_GOING;
+}
+
+static void _run(bool use_prio)
+{
+    ztimer_periodic_t load;
+
+    _use_prio = use_prio;
+    _count = 0;
+    _sum_us = 0;
+    _max_us = 0;
+
+    ztimer_periodic_init(ZTIMER_USEC, &load, _load_cb, NULL, PERIOD_US);
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    ztimer_periodic_start(&load);
+
+    while ((ztimer_now(ZTIMER_USEC) - start) < TEST_DURATION_US) {
+        event_t *event = _wait();
+        event->handler(event);
+    }
+
+    ztimer_periodic_stop(&load);
+
+    /* drain the queue */
+    if (use_prio) {
+        while (event_prio_get(&_prio)) {}
+    }
+    else {
+        while (event_get(&_fifo)) {}
+    }
+
+    printf("{ \"queue\" : \"%s\", \"result\" : %" PRIu32,
+           use_prio ? "prio" : "fifo", _count);
+    printf(", \"avg_us\" : %" PRIu32 ", \"max_us\" : %" PRIu32 " }\n",
+           _count ? _sum_us / _count : 0, _max_us);
+}
+
+int main(void)
+{
+    puts("main starting");
+
+    event_queue_init(&_fifo);
+    event_prio_queue_init(&_prio);
+
+    for (unsigned i = 0; i < NUMOF_SLOW; i++) {
+        _slow[i].super.handler = _slow_handler;
+    }
+    _urgent.super.handler = _urgent_handler;
+
+    _run(false);
+    _run(true);
+
+    return 0;
+}
@@ -0,0 +1,20 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    for queue in ("fifo", "prio"):
+        child.expect(r"{ \"queue\" : \"%s\", \"result\" : \d+, "
+                     r"\"avg_us\" : \d+, \"max_us\" : \d+ }" % queue)
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,238 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark of route and neighbor lookups in the NIB against
+ *              the former linear scans
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "container.h"
+#include "net/gnrc/ipv6/nib/ft.h"
+#include "net/gnrc/ipv6/nib/nc.h"
+#include "net/ipv6/addr.h"
+#include "ztimer.h"
+
+#include "_nib-internal.h"
+
+#ifndef NUMOF_LOOKUPS
+#define NUMOF_LOOKUPS       (10000U)
+#endif
+
+#ifndef SEED
+#define SEED                (0x2545f491U)
+#endif
+
+#define IFACE               (6)
+
+static const unsigned _sizes[] = { 16, 256, 4096 };
+
+static ipv6_addr_t _pfxs[NIB_ENTRIES];
+static uint8_t _pfx_lens[NIB_ENTRIES];
+static uint32_t _state = SEED;
+static volatile uintptr_t _sink;
+static unsigned _numof_routes;
+static unsigned _numof_neighbors;
+static bool _ok = true;
+
+/* xorshift32, so every run looks up the same addresses */
+static uint32_t _rand(void)
+{
+    _state ^= _state << 13;
+    _state ^= _state >> 17;
+    _state ^= _state << 5;
+    return _state;
+}
+
+static void _router(ipv6_addr_t *addr, unsigned idx)
+{
+    ipv6_addr_from_str(addr, "fe80::1");
+    addr->u16[7].u16 += idx;
+}
+
+/* 2001:db8:<idx>:<random>::/<48 to 64>, distinct by their third word */
+static unsigned _route(ipv6_addr_t *pfx, unsigned idx)
+{
+    ipv6_addr_from_str(pfx, "2001:db8::");
+    pfx->u16[2] = byteorder_htons(idx);
+    pfx->u16[3] = byteorder_htons(_rand());
+    return 48 + (_rand() % 17);
+}
+
+static void _neighbor(ipv6_addr_t *addr, unsigned idx)
+{
+    ipv6_addr_from_str(addr, "fe80::");
+    addr->u32[2] = byteorder_htonl(0x02004bff);
+    addr->u32[3] = byteorder_htonl(0xfe000000 | idx);
+}
+
+/* the destination is in the route with index idx */
+static void _dst(ipv6_addr_t *dst, unsigned idx)
+{
+    *dst = _pfxs[idx];
+    for (unsigned i = _pfx_lens[idx]; i < 128; i++) {
+        if (_rand() & 0x1) {
+            dst->u8[i / 8] |= 0x80 >> (i % 8);
+        }
+    }
+}
+
+/* former implementation of _nib_offl_get_match() */
+static _nib_offl_entry_t *_route_former(const ipv6_addr_t *dst)
+{
+    _nib_offl_entry_t *res = NULL;
+    uint8_t best_len = 0;
+
+    for (_nib_offl_entry_t *entry = _nib_offl_iter(NULL); entry != NULL;
+         entry = _nib_offl_iter(entry)) {
+        uint8_t match = ipv6_addr_match_prefix(&entry->pfx, dst);
+
+        if ((match >= entry->pfx_len) && (entry->pfx_len > best_len)) {
+            res = entry;
+            best_len = entry->pfx_len;
+        }
+    }
+    return res;
+}
+
+/* former implementation of _nib_onl_get() */
+static _nib_onl_entry_t *_neighbor_former(const ipv6_addr_t *addr,
+                                          unsigned iface)
+{
+    for (_nib_onl_entry_t *node = _nib_onl_iter(NULL); node != NULL;
+         node = _nib_onl_iter(node)) {
+        if (((_nib_onl_get_if(node) == 0) || (iface == 0) ||
+             (_nib_onl_get_if(node) == iface)) &&
+            ipv6_addr_equal(&node->ipv6, addr)) {
+            return node;
+        }
+    }
+    return NULL;
+}
+
+static void _fill(unsigned numof)
+{
+    for (; _numof_routes < numof; _numof_routes++) {
+        ipv6_addr_t *pfx = &_pfxs[_numof_routes];
+        ipv6_addr_t next_hop;
+
+        _pfx_lens[_numof_routes] = _route(pfx, _numof_routes);
+        _router(&next_hop, _numof_routes % NUMOF_ROUTERS);
+        if (gnrc_ipv6_nib_ft_add(pfx, _pfx_lens[_numof_routes], &next_hop,
+                                 IFACE, 0) < 0) {
+            printf("unable to add route %u\n", _numof_routes);
+            _ok = false;
+            return;
+        }
+    }
+    for (; _numof_neighbors < numof; _numof_neighbors++) {
+        ipv6_addr_t addr;
+
+        _neighbor(&addr, _numof_neighbors);
+        if (gnrc_ipv6_nib_nc_set(&addr, IFACE, NULL, 0) < 0) {
+            printf("unable to add neighbor %u\n", _numof_neighbors);
+            _ok = false;
+            return;
+        }
+    }
+}
+
+static void _run(unsigned numof)
+{
+    static ipv6_addr_t dsts[NUMOF_LOOKUPS];
+    static ipv6_addr_t neighbors[NUMOF_LOOKUPS];
+    gnrc_ipv6_nib_ft_t fte;
+    uint32_t start, routes_former, routes, neighbors_former, neighbors_us;
+    uintptr_t sum = 0;
+
+    _fill(numof);
+    for (unsigned i = 0; i < NUMOF_LOOKUPS; i++) {
+        _dst(&dsts[i], _rand() % numof);
+        _neighbor(&neighbors[i], _rand() % numof);
+    }
+
+    _nib_acquire();
+    for (unsigned i = 0; i < NUMOF_LOOKUPS; i++) {
+        _nib_offl_entry_t *former = _route_former(&dsts[i]);
+
+        if ((former == NULL) || (_nib_get_route(&dsts[i], NULL, &fte) < 0) ||
+            (fte.dst_len != former->pfx_len) ||
+            !ipv6_addr_equal(&fte.next_hop, &former->next_hop->ipv6)) {
+            printf("route mismatch for lookup %u\n", i);
+            _ok = false;
+            break;
+        }
+        if ((_neighbor_former(&neighbors[i], IFACE) == NULL) ||
+            (_neighbor_former(&neighbors[i], IFACE) !=
+             _nib_onl_get(&neighbors[i], IFACE))) {
+            printf("neighbor mismatch for lookup %u\n", i);
+            _ok = false;
+            break;
+        }
+    }
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < NUMOF_LOOKUPS; i++) {
+        _nib_offl_entry_t *former = _route_former(&dsts[i]);
+
+        /* what _nib_get_route() does on a match */
+        _nib_ft_get(former, &fte);
+        sum += fte.dst_len;
+    }
+    routes_former = ztimer_now(ZTIMER_USEC) - start;
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < NUMOF_LOOKUPS; i++) {
+        _nib_get_route(&dsts[i], NULL, &fte);
+        sum += fte.dst_len;
+    }
+    routes = ztimer_now(ZTIMER_USEC) - start;
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < NUMOF_LOOKUPS; i++) {
+        sum += (uintptr_t)_neighbor_former(&neighbors[i], IFACE);
+    }
+    neighbors_former = ztimer_now(ZTIMER_USEC) - start;
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < NUMOF_LOOKUPS; i++) {
+        sum += (uintptr_t)_nib_onl_get(&neighbors[i], IFACE);
+    }
+    neighbors_us = ztimer_now(ZTIMER_USEC) - start;
+    _nib_release();
+
+    printf("{ \"entries\" : %u, \"routes_former_us\" : %" PRIu32
+           ", \"routes_us\" : %" PRIu32, numof, routes_former, routes);
+    printf(", \"neighbors_former_us\" : %" PRIu32 ", \"neighbors_us\" : %"
+           PRIu32 " }\n", neighbors_former, neighbors_us);
+    /* keep the lookups from being optimized out */
+    _sink = sum;
+}
+
+int main(void)
+{
+    puts("main starting");
+
+    for (unsigned i = 0; (i < ARRAY_SIZE(_sizes)) && (_sizes[i] <= NIB_ENTRIES);
+         i++) {
+        _run(_sizes[i]);
+    }
+
+    puts(_ok ? "SUCCESS" : "FAILURE");
+
+    return 0;
+}
@@ -0,0 +1,164 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Per-packet latency and stack usage of the receive path from
+ *              a network interface through IPv6 and UDP to an application
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "container.h"
+#include "msg.h"
+#include "net/gnrc/ipv6.h"
+#include "net/gnrc/netapi.h"
+#include "net/gnrc/netreg.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/udp.h"
+#include "net/inet_csum.h"
+#include "net/ipv6/hdr.h"
+#include "net/protnum.h"
+#include "net/udp.h"
+#include "thread.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#ifndef NUMOF_PACKETS
+#define NUMOF_PACKETS       (10000U)
+#endif
+
+#ifndef PAYLOAD_SIZE
+#define PAYLOAD_SIZE        (64U)
+#endif
+
+#define PORT                (61616U)
+#define UDP_LEN             (sizeof(udp_hdr_t) + PAYLOAD_SIZE)
+
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+static msg_t _netif_msg_queue[4];
+static msg_t _msg_queue[4];
+static uint8_t _frame[sizeof(ipv6_hdr_t) + UDP_LEN];
+static volatile uint32_t _start;
+
+/* an IPv6 packet to ::1, as a network interface would receive it */
+static void _build_frame(void)
+{
+    ipv6_hdr_t *ipv6 = (ipv6_hdr_t *)_frame;
+    udp_hdr_t *udp = (udp_hdr_t *)(ipv6 + 1);
+    uint16_t csum;
+
+    ipv6_hdr_set_version(ipv6);
+    ipv6->len = byteorder_htons(UDP_LEN);
+    ipv6->nh = PROTNUM_UDP;
+    ipv6->hl = 64;
+    ipv6->src = ipv6_addr_loopback;
+    ipv6->dst = ipv6_addr_loopback;
+    udp->src_port = byteorder_htons(PORT);
+    udp->dst_port = byteorder_htons(PORT);
+    udp->length = byteorder_htons(UDP_LEN);
+    for (unsigned i = 0; i < PAYLOAD_SIZE; i++) {
+        ((uint8_t *)(udp + 1))[i] = i;
+    }
+    csum = ipv6_hdr_inet_csum(0, ipv6, PROTNUM_UDP, UDP_LEN);
+    csum = inet_csum(csum, (uint8_t *)udp, UDP_LEN);
+    udp->checksum = byteorder_htons((csum == 0xffff) ? csum : ~csum);
+}
+
+/* plays the network interface: passes one packet up at a time */
+static void *_netif(void *arg)
+{
+    (void)arg;
+    msg_t msg;
+
+    msg_init_queue(_netif_msg_queue, ARRAY_SIZE(_netif_msg_queue));
+    for (unsigned i = 0; i < NUMOF_PACKETS; i++) {
+        gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, _frame, sizeof(_frame),
+                                              GNRC_NETTYPE_IPV6);
+
+        if (pkt == NULL) {
+            puts("packet buffer full");
+            break;
+        }
+        _start = ztimer_now(ZTIMER_USEC);
+        if (gnrc_netapi_dispatch_receive(GNRC_NETTYPE_IPV6,
+                                         GNRC_NETREG_DEMUX_CTX_ALL, pkt) == 0) {
+            gnrc_pktbuf_release(pkt);
+        }
+        /* wait for the application to have it */
+        msg_receive(&msg);
+    }
+    return NULL;
+}
+
+static unsigned _stack_used(kernel_pid_t pid)
+{
+    const thread_t *thread = thread_get(pid);
+
+    return thread_get_stacksize(thread) - thread_measure_stack_free(thread);
+}
+
+int main(void)
+{
+    gnrc_netreg_entry_t entry = GNRC_NETREG_ENTRY_INIT_PID(PORT, thread_getpid());
+    uint32_t total = 0, max = 0;
+    unsigned received = 0;
+    kernel_pid_t netif_pid;
+    kernel_pid_t udp_pid;
+    msg_t msg;
+
+    puts("main starting");
+
+    msg_init_queue(_msg_queue, ARRAY_SIZE(_msg_queue));
+    _build_frame();
+    gnrc_netreg_register(GNRC_NETTYPE_UDP, &entry);
+    /* already started by auto_init, this only returns its PID */
+    udp_pid = gnrc_udp_init();
+
+    netif_pid = thread_create(_netif_stack, sizeof(_netif_stack),
+                              THREAD_PRIORITY_MAIN - 5, 0, _netif, NULL,
+                              "netif");
+    while (received < NUMOF_PACKETS) {
+        msg_receive(&msg);
+        if (msg.type != GNRC_NETAPI_MSG_TYPE_RCV) {
+            continue;
+        }
+
+        uint32_t latency = ztimer_now(ZTIMER_USEC) - _start;
+
+        total += latency;
+        if (latency > max) {
+            max = latency;
+        }
+        received++;
+        gnrc_pktbuf_release(msg.content.ptr);
+        /* keep the interface thread alive to measure its stack */
+        if (received < NUMOF_PACKETS) {
+            msg_send(&msg, netif_pid);
+        }
+    }
+
+    printf("{ \"direct\" : %u, \"packets\" : %u, \"ns_per_packet\" : %" PRIu32
+           ", \"max_us\" : %" PRIu32 ", \"stack_netif\" : %u, "
+           "\"stack_ipv6\" : %u, \"stack_udp\" : %u }\n",
+           IS_USED(MODULE_GNRC_NETAPI_DIRECT), received,
+           (uint32_t)(((uint64_t)total * NS_PER_US) / received), max,
+           _stack_used(netif_pid), _stack_used(gnrc_ipv6_pid),
+           _stack_used(udp_pid));
+
+    puts((received == NUMOF_PACKETS) ? "SUCCESS" : "FAILURE");
+
+    return 0;
+}
@@ -0,0 +1,22 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect(r"{ \"direct\" : \d, \"packets\" : \d+, "
+                 r"\"ns_per_packet\" : \d+, \"max_us\" : \d+, "
+                 r"\"stack_netif\" : \d+, \"stack_ipv6\" : \d+, "
+                 r"\"stack_udp\" : \d+ }", timeout=120)
+    child.expect_exact("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
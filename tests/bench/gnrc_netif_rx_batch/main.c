@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Receive throughput of gnrc_netif over netdev_tap
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "irq.h"
+#include "net/gnrc/netapi.h"
+#include "net/gnrc/netreg.h"
+#include "net/gnrc/pktbuf.h"
+#include "timex.h"
+#include "ztimer.h"
+
+/* a burst is over when no frame arrived for this long */
+#ifndef IDLE_TIMEOUT_MS
+#define IDLE_TIMEOUT_MS     (500U)
+#endif
+
+static uint32_t _frames;
+static uint32_t _bytes;
+static uint32_t _first;
+static uint32_t _last;
+
+/* called within the thread of the interface, so only the interface itself is
+ * measured and not the IPC to the next layer */
+static void _recv(uint16_t cmd, gnrc_pktsnip_t *pkt, void *ctx)
+{
+    (void)ctx;
+
+    if (cmd == GNRC_NETAPI_MSG_TYPE_RCV) {
+        _last = ztimer_now(ZTIMER_USEC);
+        if (_frames == 0) {
+            _first = _last;
+        }
+        _frames++;
+        _bytes += gnrc_pkt_len(pkt);
+    }
+    gnrc_pktbuf_release(pkt);
+}
+
+static gnrc_netreg_entry_cbd_t _cbd = { .cb = _recv };
+
+int main(void)
+{
+    /* frames with an unknown ethertype are passed up as GNRC_NETTYPE_UNDEF */
+    gnrc_netreg_entry_t entry = GNRC_NETREG_ENTRY_INIT_CB(
+                                    GNRC_NETREG_DEMUX_CTX_ALL, &_cbd);
+    uint32_t frames = 0;
+
+    gnrc_netreg_register(GNRC_NETTYPE_UNDEF, &entry);
+    puts("main starting");
+
+    while (1) {
+        ztimer_sleep(ZTIMER_MSEC, IDLE_TIMEOUT_MS);
+
+        unsigned state = irq_disable();
+
+        if ((_frames == 0) || (_frames != frames)) {
+            frames = _frames;
+            irq_restore(state);
+            continue;
+        }
+        printf("{ \"batch\" : %u, \"frames\" : %" PRIu32 ", \"bytes\" : %"
+               PRIu32 ", \"us\" : %" PRIu32 " }\n",
+               CONFIG_GNRC_NETIF_RX_BATCH_SIZE, _frames, _bytes,
+               _last - _first);
+        _frames = 0;
+        _bytes = 0;
+        frames = 0;
+        irq_restore(state);
+    }
+
+    return 0;
+}
@@ -0,0 +1,63 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import socket
+import sys
+
+import pexpect
+from testrunner import run
+
+
+# a burst should fit into the transmit queue of the TAP interface (qlen),
+# so the time it takes is bound by how fast RIOT reads it
+FRAMES = int(os.environ.get("FRAMES", 900))
+BURSTS = int(os.environ.get("BURSTS", 10))
+PAYLOAD_LEN = int(os.environ.get("PAYLOAD_LEN", 64))
+# broadcast, locally administered source, local experimental ethertype
+FRAME = bytes.fromhex("ffffffffffff" "020000000001" "88b5") + \
+        bytes(PAYLOAD_LEN)
+
+
+def testfunc(child):
+    child.expect_exact("main starting")
+    results = []
+    with socket.socket(socket.AF_PACKET, socket.SOCK_RAW) as sock:
+        sock.bind((os.environ.get("TAP", "tap0"), 0))
+        for _ in range(BURSTS):
+            for _ in range(FRAMES):
+                sock.send(FRAME)
+            # the host may send frames of its own, so take the largest burst
+            bursts = [(0, 0, 0)]
+            while True:
+                idx = child.expect([r"{ \"batch\" : (\d+), "
+                                    r"\"frames\" : (\d+), \"bytes\" : \d+, "
+                                    r"\"us\" : (\d+) }",
+                                    pexpect.TIMEOUT], timeout=2)
+                if idx == 1:
+                    break
+                bursts.append((int(child.match.group(2)),
+                               int(child.match.group(3)),
+                               int(child.match.group(1))))
+            results.append(max(bursts))
+    results = [res for res in results if res[0] > 0]
+    assert results
+    frames = sum(res[0] for res in results)
+    usec = sum(res[1] for res in results)
+    print("\nbatch {}: received {} of {} frames in {} us, {:.0f} frames/s"
+          .format(results[0][2], frames, FRAMES * BURSTS, usec,
+                  (frames - len(results)) * 1000000 / max(usec, 1)))
+
+
+if __name__ == "__main__":
+    if os.geteuid() != 0:
+        print("\x1b[1;31mThis test requires root privileges.\n"
+              "It's sending Ethernet frames to a TAP interface.\x1b[0m\n",
+              file=sys.stderr)
+        sys.exit(1)
+    sys.exit(run(testfunc, echo=False))
@@ -0,0 +1,145 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark of the demultiplexing of received packets by the
+ *              network protocol registry with many registered UDP ports
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "container.h"
+#include "msg.h"
+#include "net/gnrc/netreg.h"
+#include "thread.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#ifndef NUMOF_LOOKUPS
+#define NUMOF_LOOKUPS       (100000U)
+#endif
+
+#ifndef SEED
+#define SEED                (0x2545f491U)
+#endif
+
+#define MAX_REGISTRATIONS   (128U)
+#define NUMOF_DESTS         (1024U)
+
+static const unsigned _sizes[] = { 1, 2, 4, 8, 16, 32, 64, 128 };
+
+static gnrc_netreg_entry_t _entries[MAX_REGISTRATIONS];
+static uint16_t _ports[MAX_REGISTRATIONS];
+static uint16_t _dests[NUMOF_DESTS];
+static msg_t _msg_queue[4];
+static uint32_t _state = SEED;
+static bool _ok = true;
+
+/* xorshift32, so every run sees the same ports */
+static uint32_t _rand(void)
+{
+    _state ^= _state << 13;
+    _state ^= _state >> 17;
+    _state ^= _state << 5;
+    return _state;
+}
+
+/* distinct ports spread like ephemeral ports and well-known ports */
+static uint16_t _port(unsigned numof)
+{
+    while (true) {
+        uint16_t port = (_rand() & 1) ? (49152U + (_rand() % 16384U))
+                                      : (1U + (_rand() % 1023U));
+        unsigned i;
+
+        for (i = 0; (i < numof) && (_ports[i] != port); i++) {}
+        if (i == numof) {
+            return port;
+        }
+    }
+}
+
+/* what gnrc_netapi_dispatch() does to find the receivers of a packet */
+static unsigned _demux(uint16_t port)
+{
+    gnrc_netreg_entry_t *entry;
+    unsigned found = 0;
+
+    if (gnrc_netreg_num(GNRC_NETTYPE_UDP, port) > 0) {
+        entry = gnrc_netreg_lookup(GNRC_NETTYPE_UDP, port);
+        while (entry != NULL) {
+            found++;
+            entry = gnrc_netreg_getnext(entry);
+        }
+    }
+    return found;
+}
+
+static void _run(unsigned numof)
+{
+    uint32_t start, duration;
+    unsigned found = 0;
+
+    for (unsigned i = 0; i < numof; i++) {
+        gnrc_netreg_register(GNRC_NETTYPE_UDP, &_entries[i]);
+    }
+    for (unsigned i = 0; i < NUMOF_DESTS; i++) {
+        _dests[i] = _ports[_rand() % numof];
+    }
+
+    /* the shared lock is held across all lookups, as for a batch of
+     * received packets, so mostly the walk through the registry is timed */
+    gnrc_netreg_acquire_shared();
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < NUMOF_LOOKUPS; i++) {
+        found += _demux(_dests[i % NUMOF_DESTS]);
+    }
+    duration = ztimer_now(ZTIMER_USEC) - start;
+    gnrc_netreg_release_shared();
+
+    if (found != NUMOF_LOOKUPS) {
+        printf("found %u of %u receivers\n", found, NUMOF_LOOKUPS);
+        _ok = false;
+    }
+    for (unsigned i = 0; i < numof; i++) {
+        gnrc_netreg_unregister(GNRC_NETTYPE_UDP, &_entries[i]);
+    }
+
+    printf("{ \"buckets\" : %u, \"registrations\" : %u, \"lookups\" : %u, "
+           "\"ns_per_lookup\" : %" PRIu32 " }\n",
+           CONFIG_GNRC_NETREG_BUCKETS, numof, NUMOF_LOOKUPS,
+           (uint32_t)(((uint64_t)duration * NS_PER_US) / NUMOF_LOOKUPS));
+}
+
+int main(void)
+{
+    puts("main starting");
+
+    /* registering a thread requires a message queue */
+    msg_init_queue(_msg_queue, ARRAY_SIZE(_msg_queue));
+    gnrc_netreg_init();
+    for (unsigned i = 0; i < MAX_REGISTRATIONS; i++) {
+        _ports[i] = _port(i);
+        gnrc_netreg_entry_init_pid(&_entries[i], _ports[i], thread_getpid());
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(_sizes); i++) {
+        _run(_sizes[i]);
+    }
+
+    puts(_ok ? "SUCCESS" : "FAILURE");
+
+    return 0;
+}
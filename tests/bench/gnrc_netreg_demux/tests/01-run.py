@@ -0,0 +1,22 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    for registrations in (1, 2, 4, 8, 16, 32, 64, 128):
+        child.expect(r"{{ \"buckets\" : \d+, \"registrations\" : {}, "
+                     r"\"lookups\" : \d+, \"ns_per_lookup\" : \d+ }}"
+                     .format(registrations))
+    child.expect_exact("SUCCESS", timeout=120)
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
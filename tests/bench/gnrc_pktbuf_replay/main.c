@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Packet buffer benchmark replaying a mix of packet sizes
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "modules.h"
+#include "net/gnrc/pktbuf.h"
+#include "ztimer.h"
+
+#ifndef NUMOF_STEPS
+#define NUMOF_STEPS         (20000U)
+#endif
+
+#ifndef NUMOF_SLOTS
+#define NUMOF_SLOTS         (16U)
+#endif
+
+#ifndef SEED
+#define SEED                (0x2545f491U)
+#endif
+
+#if IS_USED(MODULE_GNRC_PKTBUF_SLAB)
+#define BACKEND             "slab"
+#elif IS_USED(MODULE_GNRC_PKTBUF_STATIC)
+#define BACKEND             "static"
+#else
+#define BACKEND             "malloc"
+#endif
+
+typedef struct {
+    uint16_t min;           /**< minimum payload size */
+    uint16_t max;           /**< maximum payload size */
+    uint8_t share;          /**< share of all packets in percent */
+} size_class_t;
+
+/* roughly what a border router sees: link-layer acknowledgements and
+ * control messages, 802.15.4 frames and reassembled IPv6 datagrams */
+static const size_class_t _mix[] = {
+    { 16, 64, 50 },
+    { 65, 127, 35 },
+    { 1024, 1280, 15 },
+};
+
+static gnrc_pktsnip_t *_slots[NUMOF_SLOTS];
+static uint32_t _state = SEED;
+
+/* xorshift32, to replay the same trace on every backend */
+static uint32_t _rand(void)
+{
+    _state ^= _state << 13;
+    _state ^= _state >> 17;
+    _state ^= _state << 5;
+    return _state;
+}
+
+static size_t _next_size(void)
+{
+    unsigned pick = _rand() % 100;
+    const size_class_t *class = &_mix[0];
+
+    while (pick >= class->share) {
+        pick -= class->share;
+        class++;
+    }
+    return class->min + (_rand() % (class->max - class->min + 1));
+}
+
+static gnrc_pktsnip_t *_receive(size_t size)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL, size, GNRC_NETTYPE_UNDEF);
+
+    /* parse a header off larger packets, as the stack would */
+    if (pkt && (size > 48)) {
+        if (!gnrc_pktbuf_mark(pkt, 8 + (_rand() % 40), GNRC_NETTYPE_UNDEF)) {
+            gnrc_pktbuf_release(pkt);
+            pkt = NULL;
+        }
+    }
+    return pkt;
+}
+
+int main(void)
+{
+    uint32_t failures = 0;
+    uint32_t failed_bytes = 0;
+
+    puts("main starting");
+
+    gnrc_pktbuf_init();
+
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < NUMOF_STEPS; i++) {
+        gnrc_pktsnip_t **slot = &_slots[_rand() % NUMOF_SLOTS];
+        size_t size = _next_size();
+
+        if (*slot) {
+            gnrc_pktbuf_release(*slot);
+        }
+        *slot = _receive(size);
+        if (*slot == NULL) {
+            failures++;
+            failed_bytes += size;
+        }
+    }
+    uint32_t duration = ztimer_now(ZTIMER_USEC) - start;
+
+    printf("{ \"backend\" : \"%s\", \"steps\" : %u, \"failures\" : %" PRIu32
+           ", \"failed_bytes\" : %" PRIu32 ", \"us\" : %" PRIu32 " }\n",
+           BACKEND, NUMOF_STEPS, failures, failed_bytes, duration);
+
+#if IS_USED(MODULE_GNRC_PKTBUF_SLAB) && defined(DEVELHELP)
+    gnrc_pktbuf_stats();
+#endif
+
+    for (unsigned i = 0; i < NUMOF_SLOTS; i++) {
+        gnrc_pktbuf_release(_slots[i]);
+    }
+
+    puts("done");
+
+    return 0;
+}
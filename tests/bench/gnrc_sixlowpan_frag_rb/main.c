@@ -0,0 +1,196 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark of the 6LoWPAN reassembly buffer under a storm of
+ *              interleaved fragments from many senders
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "byteorder.h"
+#include "container.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/sixlowpan/frag/rb.h"
+#include "net/sixlowpan.h"
+#include "ztimer.h"
+
+#ifndef NUMOF_DATAGRAMS
+#define NUMOF_DATAGRAMS     (4096U)
+#endif
+
+#ifndef SEED
+#define SEED                (0x2545f491U)
+#endif
+
+#define L2ADDR_LEN          (8U)
+#define FRAG_PAYLOAD        (80U)
+#define FRAGS_PER_DATAGRAM  (4U)
+#define DATAGRAM_SIZE       (FRAG_PAYLOAD * FRAGS_PER_DATAGRAM)
+#define MAX_CONCURRENT      (64U)
+
+static const unsigned _sizes[] = { 1, 4, 16, 64 };
+
+static struct {
+    gnrc_netif_hdr_t hdr;
+    uint8_t src[L2ADDR_LEN];
+    uint8_t dst[L2ADDR_LEN];
+} _netif_hdrs[MAX_CONCURRENT];
+
+static gnrc_pktsnip_t *_frags[MAX_CONCURRENT * FRAGS_PER_DATAGRAM];
+static uint8_t _flows[MAX_CONCURRENT * FRAGS_PER_DATAGRAM];
+static uint32_t _state = SEED;
+static bool _ok = true;
+
+/* xorshift32, so every run sees the same storm */
+static uint32_t _rand(void)
+{
+    _state ^= _state << 13;
+    _state ^= _state >> 17;
+    _state ^= _state << 5;
+    return _state;
+}
+
+static void _sender(unsigned flow, uint16_t sender)
+{
+    static const uint8_t dst[] = { 0xa4, 0xf2, 0xd2, 0xc9,
+                                   0x13, 0xb9, 0xbb, 0x25 };
+    uint8_t src[] = { 0xb3, 0x47, 0x60, 0x49, 0x78, 0xfe, 0x00, 0x00 };
+
+    src[6] = sender >> 8;
+    src[7] = sender & 0xff;
+    gnrc_netif_hdr_init(&_netif_hdrs[flow].hdr, L2ADDR_LEN, L2ADDR_LEN);
+    gnrc_netif_hdr_set_src_addr(&_netif_hdrs[flow].hdr, src, sizeof(src));
+    gnrc_netif_hdr_set_dst_addr(&_netif_hdrs[flow].hdr, dst, sizeof(dst));
+}
+
+static gnrc_pktsnip_t *_fragment(unsigned idx, uint16_t tag)
+{
+    size_t hdr_len = (idx == 0) ? sizeof(sixlowpan_frag_t) + 1
+                                : sizeof(sixlowpan_frag_n_t);
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL, hdr_len + FRAG_PAYLOAD,
+                                          GNRC_NETTYPE_SIXLOWPAN);
+    sixlowpan_frag_n_t *hdr;
+
+    if (pkt == NULL) {
+        return NULL;
+    }
+    hdr = pkt->data;
+    hdr->disp_size = byteorder_htons(((idx == 0) ? SIXLOWPAN_FRAG_1_DISP
+                                                 : SIXLOWPAN_FRAG_N_DISP) << 8 |
+                                     DATAGRAM_SIZE);
+    hdr->tag = byteorder_htons(tag);
+    if (idx == 0) {
+        /* uncompressed IPv6 header */
+        ((uint8_t *)pkt->data)[sizeof(sixlowpan_frag_t)] = SIXLOWPAN_UNCOMP;
+    }
+    else {
+        hdr->offset = (idx * FRAG_PAYLOAD) / 8;
+    }
+    memset((uint8_t *)pkt->data + hdr_len, idx, FRAG_PAYLOAD);
+    return pkt;
+}
+
+/* fragments of the next concurrent datagrams, interleaved round robin
+ * starting with a random sender for every fragment index */
+static unsigned _prepare(unsigned concurrent, unsigned datagram)
+{
+    uint16_t tags[MAX_CONCURRENT];
+    unsigned numof = 0;
+
+    for (unsigned i = 0; i < concurrent; i++) {
+        _sender(i, datagram + i);
+        tags[i] = _rand();
+    }
+    for (unsigned idx = 0; idx < FRAGS_PER_DATAGRAM; idx++) {
+        unsigned first = _rand() % concurrent;
+
+        for (unsigned i = 0; i < concurrent; i++) {
+            unsigned flow = (first + i) % concurrent;
+
+            _frags[numof] = _fragment(idx, tags[flow]);
+            _flows[numof] = flow;
+            if (_frags[numof] == NULL) {
+                printf("unable to allocate fragment %u of datagram %u\n",
+                       idx, datagram + flow);
+                _ok = false;
+                return numof;
+            }
+            numof++;
+        }
+    }
+    return numof;
+}
+
+static void _run(unsigned concurrent)
+{
+    uint32_t duration = 0;
+    unsigned fragments = 0, completed = 0;
+
+    for (unsigned datagram = 0; _ok && (datagram < NUMOF_DATAGRAMS);
+         datagram += concurrent) {
+        unsigned numof = _prepare(concurrent, datagram);
+        uint32_t start = ztimer_now(ZTIMER_USEC);
+
+        for (unsigned i = 0; i < numof; i++) {
+            unsigned idx = i / concurrent;
+            gnrc_sixlowpan_frag_rb_t *entry;
+
+            entry = gnrc_sixlowpan_frag_rb_add(&_netif_hdrs[_flows[i]].hdr,
+                                               _frags[i], idx * FRAG_PAYLOAD,
+                                               0);
+            if ((entry != NULL) &&
+                (entry->super.current_size == entry->super.datagram_size)) {
+                gnrc_pktbuf_release(entry->pkt);
+                gnrc_sixlowpan_frag_rb_remove(entry);
+                completed++;
+            }
+        }
+        duration += ztimer_now(ZTIMER_USEC) - start;
+        fragments += numof;
+    }
+    if (fragments == 0) {
+        return;
+    }
+    if (_ok && (completed != NUMOF_DATAGRAMS)) {
+        printf("only %u of %u datagrams reassembled\n", completed,
+               NUMOF_DATAGRAMS);
+        _ok = false;
+    }
+
+    printf("{ \"rbuf_size\" : %u, \"concurrent\" : %u, \"fragments\" : %u, "
+           "\"ns_per_fragment\" : %" PRIu32 " }\n",
+           CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE, concurrent, fragments,
+           (uint32_t)(((uint64_t)duration * NS_PER_US) / fragments));
+}
+
+int main(void)
+{
+    puts("main starting");
+
+    gnrc_pktbuf_init();
+    for (unsigned i = 0; (i < ARRAY_SIZE(_sizes)) &&
+                         (_sizes[i] <= CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE);
+         i++) {
+        _run(_sizes[i]);
+    }
+
+    puts(_ok ? "SUCCESS" : "FAILURE");
+
+    return 0;
+}
@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark of the 6LoWPAN IPHC encoder with and without the
+ *              compressed header cache
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/netif/internal.h"
+#include "net/gnrc/sixlowpan/config.h"
+#include "net/gnrc/sixlowpan/ctx.h"
+#include "net/gnrc/sixlowpan/iphc.h"
+#include "net/ipv6/hdr.h"
+#include "net/netdev.h"
+#include "net/protnum.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#ifndef NUMOF_RUNS
+#define NUMOF_RUNS          (100000U)
+#endif
+
+#define CTX_ID              (0U)
+#define CTX_LTIME           (60U)
+#define HOP_LIMIT           (64U)
+/* more flows than the cache holds, so round robin never hits */
+#define NUMOF_FLOWS         (2 * CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE + 1)
+
+static const uint8_t _l2addr[] = { 0x3a, 0x1c, 0x97, 0x4d,
+                                   0x62, 0x0b, 0xe4, 0x85 };
+static const uint8_t _dst_l2addr[] = { 0xc6, 0x52, 0x0e, 0x38,
+                                       0xa1, 0x7f, 0x29, 0xd4 };
+static const ipv6_addr_t _prefix = { { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00,
+                                       0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+                                       0x00, 0x00, 0x00, 0x00 } };
+
+static gnrc_netif_t _netif;
+static eui64_t _iid;
+static struct {
+    gnrc_netif_hdr_t hdr;
+    uint8_t dst[sizeof(_dst_l2addr)];
+} _netif_hdr;
+static ipv6_hdr_t _ipv6_hdrs[NUMOF_FLOWS];
+static gnrc_pktsnip_t _ipv6_snips[NUMOF_FLOWS];
+static gnrc_pktsnip_t _pkts[NUMOF_FLOWS];
+static uint8_t _iphc_hdr[sizeof(ipv6_hdr_t) + 1];
+static bool _ok = true;
+
+/* flow i goes from the interface's address with the prefix to the i-th
+ * address with the same prefix */
+static void _flow(unsigned i)
+{
+    ipv6_hdr_t *ipv6_hdr = &_ipv6_hdrs[i];
+
+    memset(ipv6_hdr, 0, sizeof(*ipv6_hdr));
+    ipv6_hdr_set_version(ipv6_hdr);
+    ipv6_hdr->nh = PROTNUM_IPV6_NONXT;
+    ipv6_hdr->hl = HOP_LIMIT;
+    memcpy(&ipv6_hdr->src, &_prefix, sizeof(ipv6_addr_t));
+    memcpy(&ipv6_hdr->src.u64[1], &_iid, sizeof(_iid));
+    memcpy(&ipv6_hdr->dst, &_prefix, sizeof(ipv6_addr_t));
+    ipv6_hdr->dst.u8[15] = i + 1;
+    _ipv6_snips[i].data = ipv6_hdr;
+    _ipv6_snips[i].size = sizeof(*ipv6_hdr);
+    _ipv6_snips[i].type = GNRC_NETTYPE_IPV6;
+    _pkts[i].next = &_ipv6_snips[i];
+    _pkts[i].data = &_netif_hdr;
+    _pkts[i].size = sizeof(_netif_hdr);
+    _pkts[i].type = GNRC_NETTYPE_NETIF;
+}
+
+static void _run(const char *workload, unsigned numof_flows)
+{
+    /* IPHC dispatch and NHC byte, plus the inline 64 bit destination IID */
+    const size_t exp_len = 3 + sizeof(eui64_t);
+    size_t len = 0;
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+
+    for (unsigned i = 0; i < NUMOF_RUNS; i++) {
+        len += gnrc_sixlowpan_iphc_encode_hdr(&_pkts[i % numof_flows], &_netif,
+                                              _iphc_hdr);
+    }
+
+    uint32_t duration = ztimer_now(ZTIMER_USEC) - start;
+
+    if (len != NUMOF_RUNS * exp_len) {
+        printf("%s: unexpected compressed header length\n", workload);
+        _ok = false;
+    }
+    printf("{ \"cache_size\" : %u, \"workload\" : \"%s\", "
+           "\"ns_per_encoding\" : %" PRIu32 " }\n",
+           (unsigned)CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE, workload,
+           (uint32_t)(((uint64_t)duration * NS_PER_US) / NUMOF_RUNS));
+}
+
+int main(void)
+{
+    puts("main starting");
+
+    _netif.device_type = NETDEV_TYPE_IEEE802154;
+    _netif.flags = GNRC_NETIF_FLAGS_HAS_L2ADDR;
+    memcpy(_netif.l2addr, _l2addr, sizeof(_l2addr));
+    _netif.l2addr_len = sizeof(_l2addr);
+    gnrc_netif_hdr_init(&_netif_hdr.hdr, 0, sizeof(_dst_l2addr));
+    gnrc_netif_hdr_set_dst_addr(&_netif_hdr.hdr, _dst_l2addr,
+                                sizeof(_dst_l2addr));
+    if ((gnrc_netif_ipv6_get_iid(&_netif, &_iid) < 0) ||
+        (gnrc_sixlowpan_ctx_update(CTX_ID, &_prefix, 64, CTX_LTIME,
+                                   true) == NULL)) {
+        puts("FAILURE");
+        return 1;
+    }
+    for (unsigned i = 0; i < NUMOF_FLOWS; i++) {
+        _flow(i);
+    }
+
+    _run("single flow", 1);
+    _run("round robin", NUMOF_FLOWS);
+
+    puts(_ok ? "SUCCESS" : "FAILURE");
+
+    return 0;
+}
@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Bulk receive throughput of gnrc_tcp over netdev_tap
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "msg.h"
+#include "net/af.h"
+#include "net/gnrc/netif.h"
+#include "net/gnrc/tcp.h"
+#include "net/ipv6/addr.h"
+#include "ztimer.h"
+
+#ifndef SERVER_PORT
+#define SERVER_PORT     (5000U)
+#endif
+
+/* number of connections accepted in parallel, all but one stay idle */
+#ifndef CONNECTIONS
+#define CONNECTIONS     (4U)
+#endif
+
+#define MAIN_QUEUE_SIZE (8)
+#define CHUNK_SIZE      (1024)
+
+static msg_t _main_msg_queue[MAIN_QUEUE_SIZE];
+static gnrc_tcp_tcb_t _tcbs[CONNECTIONS];
+static gnrc_tcp_tcb_queue_t _queue = GNRC_TCP_TCB_QUEUE_INIT;
+static uint8_t _buf[CHUNK_SIZE];
+
+static void _print_addr(void)
+{
+    gnrc_netif_t *netif = gnrc_netif_iter(NULL);
+    ipv6_addr_t addrs[CONFIG_GNRC_NETIF_IPV6_ADDRS_NUMOF];
+    char addr_str[IPV6_ADDR_MAX_STR_LEN];
+    int res = gnrc_netif_ipv6_addrs_get(netif, addrs, sizeof(addrs));
+
+    for (unsigned i = 0; res > 0 && i < res / sizeof(addrs[0]); i++) {
+        if (ipv6_addr_is_link_local(&addrs[i])) {
+            printf("address: %s\n",
+                   ipv6_addr_to_str(addr_str, &addrs[i], sizeof(addr_str)));
+        }
+    }
+}
+
+int main(void)
+{
+    gnrc_tcp_ep_t local;
+
+    msg_init_queue(_main_msg_queue, MAIN_QUEUE_SIZE);
+
+    for (unsigned i = 0; i < CONNECTIONS; i++) {
+        gnrc_tcp_tcb_init(&_tcbs[i]);
+    }
+    gnrc_tcp_ep_init(&local, AF_INET6, NULL, 0, SERVER_PORT, 0);
+    if (gnrc_tcp_listen(&_queue, _tcbs, CONNECTIONS, &local) < 0) {
+        puts("listen failed");
+        return 1;
+    }
+    _print_addr();
+    printf("listening on port %u\n", SERVER_PORT);
+
+    while (1) {
+        gnrc_tcp_tcb_t *conn = NULL;
+        uint32_t bytes = 0;
+        uint32_t start = 0;
+
+        if (gnrc_tcp_accept(&_queue, &conn, GNRC_TCP_NO_TIMEOUT) < 0) {
+            continue;
+        }
+        /* the peer closing the connection ends the transfer */
+        while (1) {
+            ssize_t res = gnrc_tcp_recv(conn, _buf, sizeof(_buf), GNRC_TCP_NO_TIMEOUT);
+
+            if (res <= 0) {
+                break;
+            }
+            if (bytes == 0) {
+                start = ztimer_now(ZTIMER_MSEC);
+            }
+            bytes += res;
+        }
+        if (bytes > 0) {
+            printf("{ \"window\" : %" PRIu32 ", \"bytes\" : %" PRIu32 ", \"ms\" : %"
+                   PRIu32 " }\n", (uint32_t)CONFIG_GNRC_TCP_DEFAULT_WINDOW, bytes,
+                   ztimer_now(ZTIMER_MSEC) - start);
+        }
+        gnrc_tcp_close(conn);
+    }
+
+    return 0;
+}
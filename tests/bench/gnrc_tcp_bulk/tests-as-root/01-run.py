@@ -0,0 +1,61 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import socket
+import sys
+import time
+
+from testrunner import run
+
+
+TRANSFER_SIZE = int(os.environ.get("TRANSFER_SIZE", 256 * 1024))
+TRANSFERS = int(os.environ.get("TRANSFERS", 3))
+
+
+def _connect(addr, port):
+    # the link local address of RIOT may still be tentative
+    for _ in range(10):
+        try:
+            return socket.create_connection(
+                ("{}%{}".format(addr, os.environ.get("TAP", "tap0")), port),
+                timeout=30)
+        except OSError:
+            time.sleep(0.5)
+    raise ConnectionError("Could not connect to RIOT")
+
+
+def testfunc(child):
+    child.expect(r"address: (\S+)")
+    addr = child.match.group(1)
+    child.expect(r"listening on port (\d+)")
+    port = int(child.match.group(1))
+    data = bytes(i % 256 for i in range(TRANSFER_SIZE))
+    results = []
+    for _ in range(TRANSFERS):
+        with _connect(addr, port) as sock:
+            sock.sendall(data)
+            sock.shutdown(socket.SHUT_WR)
+            child.expect(r"{ \"window\" : (\d+), \"bytes\" : (\d+), "
+                         r"\"ms\" : (\d+) }", timeout=120)
+            window = int(child.match.group(1))
+            assert int(child.match.group(2)) == TRANSFER_SIZE
+            results.append(int(child.match.group(3)))
+    msec = sum(results)
+    print("\nwindow {}: received {} bytes {} times in {} ms, {:.0f} B/s"
+          .format(window, TRANSFER_SIZE, TRANSFERS, msec,
+                  TRANSFER_SIZE * TRANSFERS * 1000 / max(msec, 1)))
+
+
+if __name__ == "__main__":
+    if os.geteuid() != 0:
+        print("\x1b[1;31mThis test requires root privileges.\n"
+              "It's connecting to RIOT via a TAP interface.\x1b[0m\n",
+              file=sys.stderr)
+        sys.exit(1)
+    sys.exit(run(testfunc, echo=False))
@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark of the Internet Checksum against the former
+ *              implementation summing one 16 bit word per iteration
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "container.h"
+#include "net/inet_csum.h"
+#include "ztimer.h"
+
+#ifndef NUMOF_RUNS
+#define NUMOF_RUNS          (1000U)
+#endif
+
+static const uint16_t _lens[] = { 8, 16, 40, 64, 127, 256, 512, 1024, 1280, 1500 };
+
+/* the buffer of a packet is not necessarily aligned, so start at an odd
+ * address as well */
+static uint8_t _buf[1500 + 1];
+
+/* former implementation of inet_csum_slice() */
+static uint16_t _csum_former(uint16_t sum, const uint8_t *buf, uint16_t len,
+                             size_t accum_len)
+{
+    uint32_t csum = sum;
+
+    if (len == 0) {
+        return csum;
+    }
+
+    if (accum_len & 1) {
+        csum += *buf;
+        buf++;
+        len--;
+        accum_len++;
+    }
+
+    for (unsigned i = 0; i < (len >> 1); buf += 2, i++) {
+        csum += (uint16_t)(*buf << 8) + *(buf + 1);
+    }
+
+    if ((accum_len + len) & 1) {
+        csum += (uint16_t)(*buf << 8);
+    }
+
+    while (csum >> 16) {
+        uint16_t carry = csum >> 16;
+        csum = (csum & 0xffff) + carry;
+    }
+
+    return csum;
+}
+
+static uint32_t _measure(uint16_t (*csum)(uint16_t, const uint8_t *, uint16_t, size_t),
+                         const uint8_t *buf, uint16_t len)
+{
+    /* keep the compiler from dropping the calls */
+    static volatile uint16_t sink;
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+
+    for (unsigned i = 0; i < NUMOF_RUNS; i++) {
+        sink = csum(sink, buf, len, 0);
+    }
+    return ztimer_now(ZTIMER_USEC) - start;
+}
+
+int main(void)
+{
+    bool ok = true;
+
+    puts("main starting");
+
+    for (unsigned i = 0; i < sizeof(_buf); i++) {
+        _buf[i] = i * 37 + 11;
+    }
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_lens); i++) {
+        for (unsigned offset = 0; offset < 2; offset++) {
+            const uint8_t *buf = &_buf[offset];
+            uint16_t len = _lens[i];
+
+            if (_csum_former(0, buf, len, 0) != inet_csum(0, buf, len)) {
+                printf("mismatch for len %u at offset %u\n", len, offset);
+                ok = false;
+            }
+            printf("{ \"len\" : %u, \"offset\" : %u, \"former_us\" : %" PRIu32
+                   ", \"us\" : %" PRIu32 " }\n", len, offset,
+                   _measure(_csum_former, buf, len),
+                   _measure(inet_csum_slice, buf, len));
+        }
+    }
+
+    puts(ok ? "SUCCESS" : "FAILURE");
+
+    return 0;
+}
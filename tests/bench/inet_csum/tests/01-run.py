@@ -0,0 +1,26 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+LENS = (8, 16, 40, 64, 127, 256, 512, 1024, 1280, 1500)
+
+
+def testfunc(child):
+    for length in LENS:
+        for offset in (0, 1):
+            child.expect(r"{ \"len\" : %d, \"offset\" : %d, "
+                         r"\"former_us\" : \d+, \"us\" : \d+ }"
+                         % (length, offset))
+    child.expect_exact("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
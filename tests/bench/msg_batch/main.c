@@ -0,0 +1,141 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Compare per-message and batched message throughput
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include "macros/units.h"
+#include "thread.h"
+#include "clk.h"
+#include "timex.h"
+
+#include "msg.h"
+#include "ztimer.h"
+
+#ifndef TEST_DURATION_US
+#define TEST_DURATION_US    (1000000U)
+#endif
+
+#ifndef BATCH_SIZE
+#define BATCH_SIZE          (16U)
+#endif
+
+static char _stack[THREAD_STACKSIZE_MAIN];
+static msg_t _queue[BATCH_SIZE];
+
+static volatile bool _batched;
+static uint32_t _received;
+static uint32_t _errors;
+
+static void _timer_callback(void *_flag)
+{
+    atomic_flag *flag = _flag;
+    atomic_flag_clear(flag);
+}
+
+static void _check(const msg_t *m)
+{
+    if (m->content.value != _received) {
+        _errors++;
+    }
+    _received++;
+}
+
+static void *_consumer(void *arg)
+{
+    (void)arg;
+
+    msg_init_queue(_queue, BATCH_SIZE);
+
+    while (1) {
+        msg_t msgs[BATCH_SIZE];
+
+        if (_batched) {
+            unsigned n = msg_receive_batch(msgs, BATCH_SIZE);
+            for (unsigned i = 0; i < n; i++) {
+                _check(&msgs[i]);
+            }
+        }
+        else {
+            msg_receive(&msgs[0]);
+            _check(&msgs[0]);
+        }
+    }
+
+    return NULL;
+}
+
+static void _run(kernel_pid_t consumer, bool batched)
+{
+    atomic_flag flag = ATOMIC_FLAG_INIT;
+    ztimer_t timer = {
+        .callback = _timer_callback,
+        .arg = &flag,
+    };
+    uint32_t sent = 0;
+
+    _batched = batched;
+    _received = 0;
+    _errors = 0;
+
+    atomic_flag_test_and_set(&flag);
+    ztimer_set(ZTIMER_USEC, &timer, TEST_DURATION_US);
+
+    while (atomic_flag_test_and_set(&flag)) {
+        if (batched) {
+            msg_t msgs[BATCH_SIZE];
+            for (unsigned i = 0; i < BATCH_SIZE; i++) {
+                msgs[i].content.value = sent + i;
+            }
+            unsigned n = 0;
+            while (n < BATCH_SIZE) {
+                n += msg_send_batch(&msgs[n], BATCH_SIZE - n, consumer);
+            }
+            sent += BATCH_SIZE;
+        }
+        else {
+            msg_t msg = { .content.value = sent };
+            msg_send(&msg, consumer);
+            sent++;
+        }
+    }
+
+    printf("{ \"mode\" : \"%s\", \"result\" : %" PRIu32,
+           batched ? "batch" : "single", _received);
+    printf(", \"ticks\" : %" PRIu32,
+           (uint32_t)((TEST_DURATION_US/US_PER_MS) * (coreclk()/KHZ(1)))/_received);
+    printf(", \"errors\" : %" PRIu32 " }\n", _errors);
+}
+
+int main(void)
+{
+    puts("main starting");
+
+    kernel_pid_t other = thread_create(_stack,
+                                       sizeof(_stack),
+                                       (THREAD_PRIORITY_MAIN - 1),
+                                       0,
+                                       _consumer,
+                                       NULL,
+                                       "consumer");
+
+    _run(other, false);
+    _run(other, true);
+
+    return 0;
+}
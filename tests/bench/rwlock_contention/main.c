@@ -0,0 +1,223 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Reader-writer lock contention benchmark
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "mutex.h"
+#include "rwlock.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef TEST_DURATION_US
+#define TEST_DURATION_US    (1000000U)
+#endif
+
+#ifndef NUMOF_READERS
+#define NUMOF_READERS       (3U)
+#endif
+
+#ifndef HOLD_US
+#define HOLD_US             (1000U)
+#endif
+
+#ifndef GAP_US
+#define GAP_US              (250U)
+#endif
+
+#ifndef PERIOD_US
+#define PERIOD_US           (5000U)
+#endif
+
+/* the writer must not be outranked by the readers */
+#define READER_PRIO         (THREAD_PRIORITY_MAIN + 1)
+
+typedef struct {
+    const char *name;
+    void (*read_lock)(void);
+    void (*read_unlock)(void);
+    void (*write_lock)(void);
+    void (*write_unlock)(void);
+} lock_ops_t;
+
+static char _stacks[NUMOF_READERS][THREAD_STACKSIZE_DEFAULT];
+
+static const lock_ops_t *_ops;
+static uint32_t _start;
+static uint32_t _reads;
+static unsigned _readers_done;
+
+static mutex_t _mutex = MUTEX_INIT;
+
+static void _mutex_lock(void)
+{
+    mutex_lock(&_mutex);
+}
+
+static void _mutex_unlock(void)
+{
+    mutex_unlock(&_mutex);
+}
+
+/* the scheme gnrc_netreg used before it was migrated to rwlock_t */
+static mutex_t _counter_lock = MUTEX_INIT;
+static mutex_t _counter_wait_exclusive = MUTEX_INIT;
+static unsigned _counter;
+
+static void _counter_read_lock(void)
+{
+    mutex_lock(&_counter_lock);
+    if (_counter++ == 0) {
+        mutex_lock(&_counter_wait_exclusive);
+    }
+    mutex_unlock(&_counter_lock);
+}
+
+static void _counter_read_unlock(void)
+{
+    mutex_lock(&_counter_lock);
+    if (--_counter == 0) {
+        mutex_unlock(&_counter_wait_exclusive);
+    }
+    mutex_unlock(&_counter_lock);
+}
+
+static void _counter_write_lock(void)
+{
+    while (1) {
+        mutex_lock(&_counter_lock);
+        if (_counter == 0) {
+            mutex_lock(&_counter_wait_exclusive);
+            return;
+        }
+        mutex_unlock(&_counter_lock);
+
+        mutex_lock(&_counter_wait_exclusive);
+        mutex_unlock(&_counter_wait_exclusive);
+    }
+}
+
+static void _counter_write_unlock(void)
+{
+    mutex_unlock(&_counter_wait_exclusive);
+    mutex_unlock(&_counter_lock);
+}
+
+static rwlock_t _rwlock = RWLOCK_INIT;
+
+static void _rwlock_read_lock(void)
+{
+    rwlock_read_lock(&_rwlock);
+}
+
+static void _rwlock_read_unlock(void)
+{
+    rwlock_read_unlock(&_rwlock);
+}
+
+static void _rwlock_write_lock(void)
+{
+    rwlock_write_lock(&_rwlock);
+}
+
+static void _rwlock_write_unlock(void)
+{
+    rwlock_write_unlock(&_rwlock);
+}
+
+static const lock_ops_t _schemes[] = {
+    { "mutex", _mutex_lock, _mutex_unlock, _mutex_lock, _mutex_unlock },
+    { "counter", _counter_read_lock, _counter_read_unlock,
+      _counter_write_lock, _counter_write_unlock },
+    { "rwlock", _rwlock_read_lock, _rwlock_read_unlock,
+      _rwlock_write_lock, _rwlock_write_unlock },
+};
+
+static bool _running(void)
+{
+    return (ztimer_now(ZTIMER_USEC) - _start) < TEST_DURATION_US;
+}
+
+static void *_reader(void *arg)
+{
+    unsigned idx = (uintptr_t)arg;
+
+    ztimer_sleep(ZTIMER_USEC, idx * (HOLD_US + GAP_US) / NUMOF_READERS);
+
+    while (_running()) {
+        _ops->read_lock();
+        ztimer_sleep(ZTIMER_USEC, HOLD_US);
+        _ops->read_unlock();
+        _reads++;
+        ztimer_sleep(ZTIMER_USEC, GAP_US);
+    }
+
+    _readers_done++;
+    return NULL;
+}
+
+static void _run(const lock_ops_t *ops)
+{
+    uint32_t writes = 0;
+    uint32_t sum_us = 0;
+    uint32_t max_us = 0;
+
+    _ops = ops;
+    _reads = 0;
+    _readers_done = 0;
+    _start = ztimer_now(ZTIMER_USEC);
+
+    for (unsigned i = 0; i < NUMOF_READERS; i++) {
+        thread_create(_stacks[i], sizeof(_stacks[i]), READER_PRIO, 0,
+                      _reader, (void *)(uintptr_t)i, "reader");
+    }
+
+    while (_running()) {
+        ztimer_sleep(ZTIMER_USEC, PERIOD_US);
+
+        uint32_t before = ztimer_now(ZTIMER_USEC);
+        ops->write_lock();
+        uint32_t waited = ztimer_now(ZTIMER_USEC) - before;
+        ops->write_unlock();
+
+        writes++;
+        sum_us += waited;
+        if (waited > max_us) {
+            max_us = waited;
+        }
+    }
+
+    while (_readers_done < NUMOF_READERS) {
+        ztimer_sleep(ZTIMER_USEC, HOLD_US);
+    }
+
+    printf("{ \"lock\" : \"%s\", \"reads\" : %" PRIu32 ", \"writes\" : %" PRIu32,
+           ops->name, _reads, writes);
+    printf(", \"avg_us\" : %" PRIu32 ", \"max_us\" : %" PRIu32 " }\n",
+           writes ? sum_us / writes : 0, max_us);
+}
+
+int main(void)
+{
+    puts("main starting");
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_schemes); i++) {
+        _run(&_schemes[i]);
+    }
+
+    return 0;
+}
@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       ztimer list vs. timing wheel stress benchmark
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "test_utils/expect.h"
+
+#include "ztimer.h"
+#include "ztimer/mock.h"
+#include "ztimer/wheel.h"
+
+#ifndef NUMOF_TIMERS
+#define NUMOF_TIMERS    (256U)
+#endif
+
+#ifndef REPEAT
+#define REPEAT          (1000U)
+#endif
+
+#ifndef SPREAD
+#define SPREAD          (10000LU)
+#endif
+
+#ifndef WHEEL_SHIFT
+#define WHEEL_SHIFT     (5U)
+#endif
+
+#define STEP            (3U)
+
+typedef struct {
+    ztimer_t timer;
+    ztimer_mock_t *mock;
+    uint32_t target;
+    uint32_t fired_at;
+    unsigned triggers;
+} bench_timer_t;
+
+static ztimer_mock_t _mock;
+static ztimer_wheel_t _wheel;
+static bench_timer_t _timers[NUMOF_TIMERS];
+static uint32_t _seed;
+
+static void _callback(void *arg)
+{
+    bench_timer_t *t = arg;
+
+    t->fired_at = t->mock->now;
+    t->triggers++;
+}
+
+static uint32_t _rand(void)
+{
+    _seed = _seed * 1103515245ul + 12345;
+    return _seed >> 8;
+}
+
+static void _timer_set(unsigned n)
+{
+    uint32_t val = _rand() % SPREAD;
+
+    _timers[n].target = _mock.now + val;
+    ztimer_set(&_mock.super, &_timers[n].timer, val);
+}
+
+static void _print_result(const char *backend, const char *desc, unsigned n,
+                          uint32_t total)
+{
+    printf("%6s %24s %8"PRIu32" / %u = %"PRIu32"\n", backend, desc, total, n,
+           total/n);
+}
+
+static void _run(const char *backend, bool wheel)
+{
+    uint32_t before, diff;
+
+    _seed = 1;
+    ztimer_mock_init(&_mock, 32);
+    if (wheel) {
+        ztimer_wheel_init(&_mock.super, &_wheel, WHEEL_SHIFT);
+    }
+    for (unsigned n = 0; n < NUMOF_TIMERS; n++) {
+        _timers[n] = (bench_timer_t){
+            .timer = { .callback = _callback, .arg = &_timers[n] },
+            .mock = &_mock,
+        };
+    }
+
+    before = ztimer_now(ZTIMER_USEC);
+    for (unsigned n = 0; n < NUMOF_TIMERS; n++) {
+        _timer_set(n);
+    }
+    diff = ztimer_now(ZTIMER_USEC) - before;
+    _print_result(backend, "set() many random", NUMOF_TIMERS, diff);
+
+    before = ztimer_now(ZTIMER_USEC);
+    for (unsigned n = 0; n < REPEAT; n++) {
+        _timer_set(_rand() % NUMOF_TIMERS);
+    }
+    diff = ztimer_now(ZTIMER_USEC) - before;
+    _print_result(backend, "re-set() random", REPEAT, diff);
+
+    before = ztimer_now(ZTIMER_USEC);
+    for (unsigned n = 0; n < REPEAT; n++) {
+        unsigned idx = _rand() % NUMOF_TIMERS;
+        ztimer_remove(&_mock.super, &_timers[idx].timer);
+        _timer_set(idx);
+    }
+    diff = ztimer_now(ZTIMER_USEC) - before;
+    _print_result(backend, "remove() + set() random", REPEAT, diff);
+
+    before = ztimer_now(ZTIMER_USEC);
+    for (unsigned n = 0; n <= SPREAD / STEP; n++) {
+        ztimer_mock_advance(&_mock, STEP);
+    }
+    diff = ztimer_now(ZTIMER_USEC) - before;
+    _print_result(backend, "expire all", NUMOF_TIMERS, diff);
+
+    for (unsigned n = 0; n < NUMOF_TIMERS; n++) {
+        expect(_timers[n].triggers == 1);
+        expect(_timers[n].fired_at == _timers[n].target);
+    }
+}
+
+int main(void)
+{
+    puts("ztimer timing wheel benchmark application.\n");
+
+    _run("list", false);
+    _run("wheel", true);
+
+    puts("done.");
+
+    return 0;
+}
@@ -0,0 +1,210 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for mutex priority inheritance
+ *
+ * The main thread has the lowest priority, so every thread created runs until
+ * it blocks, and the main thread can check the priorities in between.
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "irq.h"
+#include "mutex.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+
+#define PRIO_LOW    (THREAD_PRIORITY_MAIN - 1)
+#define PRIO_HOG    (THREAD_PRIORITY_MAIN - 2)
+#define PRIO_MID    (THREAD_PRIORITY_MAIN - 3)
+#define PRIO_HIGH   (THREAD_PRIORITY_MAIN - 4)
+
+static char stack_low[THREAD_STACKSIZE_DEFAULT];
+static char stack_hog[THREAD_STACKSIZE_DEFAULT];
+static char stack_mid[THREAD_STACKSIZE_DEFAULT];
+static char stack_high[THREAD_STACKSIZE_DEFAULT];
+
+static mutex_t m1 = MUTEX_INIT;
+static mutex_t m2 = MUTEX_INIT;
+static mutex_cancel_t mc;
+
+static kernel_pid_t pid_low;
+static char run_order[8];
+static unsigned run_order_pos;
+
+static void record(char c)
+{
+    unsigned irq_state = irq_disable();
+    run_order[run_order_pos++] = c;
+    irq_restore(irq_state);
+}
+
+static uint8_t prio(kernel_pid_t pid)
+{
+    return thread_get(pid)->priority;
+}
+
+static void reset(void)
+{
+    memset(run_order, 0, sizeof(run_order));
+    run_order_pos = 0;
+}
+
+static kernel_pid_t create(char *stack, size_t size, uint8_t priority,
+                           thread_task_func_t func, void *arg,
+                           const char *name)
+{
+    return thread_create(stack, size, priority, 0, func, arg, name);
+}
+
+/* holds m1 until woken up */
+static void *low_chain(void *arg)
+{
+    (void)arg;
+    mutex_lock(&m1);
+    thread_sleep();
+    record('l');
+    mutex_unlock(&m1);
+    expect(prio(thread_getpid()) == PRIO_LOW);
+    return NULL;
+}
+
+/* holds m2, then waits for m1 */
+static void *mid_chain(void *arg)
+{
+    (void)arg;
+    mutex_lock(&m2);
+    mutex_lock(&m1);
+    record('m');
+    /* high is still waiting for m2 */
+    expect(prio(thread_getpid()) == PRIO_HIGH);
+    mutex_unlock(&m1);
+    expect(prio(thread_getpid()) == PRIO_HIGH);
+    mutex_unlock(&m2);
+    expect(prio(thread_getpid()) == PRIO_MID);
+    return NULL;
+}
+
+static void *high_lock(void *mutex)
+{
+    mutex_lock(mutex);
+    record('h');
+    mutex_unlock(mutex);
+    return NULL;
+}
+
+/* busy thread with a priority between the low and the mid one */
+static void *hog(void *arg)
+{
+    (void)arg;
+    thread_wakeup(pid_low);
+    record('x');
+    return NULL;
+}
+
+static void test_transitive(void)
+{
+    reset();
+    pid_low = create(stack_low, sizeof(stack_low), PRIO_LOW, low_chain, NULL,
+                     "low");
+    kernel_pid_t pid_mid = create(stack_mid, sizeof(stack_mid), PRIO_MID,
+                                  mid_chain, NULL, "mid");
+    expect(prio(pid_low) == PRIO_MID);
+
+    create(stack_high, sizeof(stack_high), PRIO_HIGH, high_lock, &m2, "high");
+    /* high waits for mid, which waits for low */
+    expect(prio(pid_mid) == PRIO_HIGH);
+    expect(prio(pid_low) == PRIO_HIGH);
+
+    /* without inheritance, the hog would delay the whole chain */
+    create(stack_hog, sizeof(stack_hog), PRIO_HOG, hog, NULL, "hog");
+    expect(strcmp(run_order, "lmhx") == 0);
+    puts("transitive inheritance: OK");
+}
+
+/* waits for m1, then holds it until woken up */
+static void *mid_owner(void *arg)
+{
+    (void)arg;
+    mutex_lock(&m1);
+    thread_sleep();
+    record('m');
+    mutex_unlock(&m1);
+    expect(prio(thread_getpid()) == PRIO_MID);
+    return NULL;
+}
+
+static void test_hand_over(void)
+{
+    reset();
+    pid_low = create(stack_low, sizeof(stack_low), PRIO_LOW, low_chain, NULL,
+                     "low");
+    kernel_pid_t pid_mid = create(stack_mid, sizeof(stack_mid), PRIO_MID,
+                                  mid_owner, NULL, "mid");
+    expect(prio(pid_low) == PRIO_MID);
+
+    /* low hands m1 over to mid, which keeps it */
+    thread_wakeup(pid_low);
+    expect(strcmp(run_order, "l") == 0);
+
+    /* high must boost the new owner */
+    create(stack_high, sizeof(stack_high), PRIO_HIGH, high_lock, &m1, "high");
+    expect(prio(pid_mid) == PRIO_HIGH);
+
+    thread_wakeup(pid_mid);
+    expect(strcmp(run_order, "lmh") == 0);
+    puts("ownership hand over: OK");
+}
+
+static void *high_cancel(void *arg)
+{
+    (void)arg;
+    mc = mutex_cancel_init(&m1);
+    expect(mutex_lock_cancelable(&mc) == -ECANCELED);
+    record('h');
+    return NULL;
+}
+
+static void test_cancel(void)
+{
+    reset();
+    pid_low = create(stack_low, sizeof(stack_low), PRIO_LOW, low_chain, NULL,
+                     "low");
+    create(stack_high, sizeof(stack_high), PRIO_HIGH, high_cancel, NULL, "high");
+    expect(prio(pid_low) == PRIO_HIGH);
+
+    mutex_cancel(&mc);
+    expect(strcmp(run_order, "h") == 0);
+
+    /* low drops the boost when unlocking, even without waiters left */
+    thread_wakeup(pid_low);
+    expect(strcmp(run_order, "hl") == 0);
+    puts("canceled waiter: OK");
+}
+
+int main(void)
+{
+    puts("Test Application for mutex priority inheritance");
+
+    test_transitive();
+    test_hand_over();
+    test_cancel();
+
+    puts("TEST PASSED");
+
+    return 0;
+}
@@ -0,0 +1,170 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for the reader-writer lock
+ *
+ * The main thread has the lowest priority, so every thread created runs until
+ * it blocks, and the main thread can check the order in between.
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "irq.h"
+#include "rwlock.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+
+#define PRIO_LOW    (THREAD_PRIORITY_MAIN - 1)
+#define PRIO_MID    (THREAD_PRIORITY_MAIN - 2)
+#define PRIO_HIGH   (THREAD_PRIORITY_MAIN - 3)
+
+static char stacks[3][THREAD_STACKSIZE_DEFAULT];
+
+static rwlock_t lock = RWLOCK_INIT;
+
+static char run_order[8];
+static unsigned run_order_pos;
+
+static void record(char c)
+{
+    unsigned irq_state = irq_disable();
+    run_order[run_order_pos++] = c;
+    irq_restore(irq_state);
+}
+
+static void reset(void)
+{
+    memset(run_order, 0, sizeof(run_order));
+    run_order_pos = 0;
+}
+
+static kernel_pid_t create(unsigned idx, uint8_t priority,
+                           thread_task_func_t func, void *arg)
+{
+    return thread_create(stacks[idx], sizeof(stacks[idx]), priority, 0, func,
+                         arg, "t");
+}
+
+static void *reader(void *arg)
+{
+    rwlock_read_lock(&lock);
+    record((char)(uintptr_t)arg);
+    rwlock_read_unlock(&lock);
+    return NULL;
+}
+
+static void *writer(void *arg)
+{
+    rwlock_write_lock(&lock);
+    record((char)(uintptr_t)arg);
+    rwlock_write_unlock(&lock);
+    return NULL;
+}
+
+static void *sleeping_reader(void *arg)
+{
+    rwlock_read_lock(&lock);
+    record((char)(uintptr_t)arg);
+    thread_sleep();
+    rwlock_read_unlock(&lock);
+    return NULL;
+}
+
+static void test_writer_preference(void)
+{
+    reset();
+    rwlock_read_lock(&lock);
+
+    create(0, PRIO_LOW, writer, (void *)'w');
+    /* a reader of the same priority must queue up behind the writer ... */
+    create(1, PRIO_LOW, reader, (void *)'r');
+    expect(run_order_pos == 0);
+    expect(!rwlock_read_trylock(&lock));
+    /* ... a reader of higher priority may still join */
+    create(2, PRIO_MID, reader, (void *)'h');
+    expect(strcmp(run_order, "h") == 0);
+
+    rwlock_read_unlock(&lock);
+    expect(strcmp(run_order, "hwr") == 0);
+    puts("writer preference: OK");
+}
+
+static void test_priority_order(void)
+{
+    reset();
+    rwlock_write_lock(&lock);
+
+    create(0, PRIO_LOW, writer, (void *)'l');
+    create(1, PRIO_HIGH, writer, (void *)'h');
+    create(2, PRIO_MID, reader, (void *)'m');
+    expect(run_order_pos == 0);
+
+    rwlock_write_unlock(&lock);
+    expect(strcmp(run_order, "hml") == 0);
+    puts("priority order: OK");
+}
+
+static void test_shared_readers(void)
+{
+    reset();
+    rwlock_write_lock(&lock);
+
+    kernel_pid_t r1 = create(0, PRIO_LOW, sleeping_reader, (void *)'1');
+    kernel_pid_t r2 = create(1, PRIO_MID, sleeping_reader, (void *)'2');
+    expect(run_order_pos == 0);
+
+    /* both readers are handed the lock at once */
+    rwlock_write_unlock(&lock);
+    expect(strcmp(run_order, "21") == 0);
+    expect(rwlock_is_read_locked(&lock));
+    expect(!rwlock_write_trylock(&lock));
+
+    thread_wakeup(r1);
+    thread_wakeup(r2);
+    expect(rwlock_write_trylock(&lock));
+    rwlock_write_unlock(&lock);
+    puts("shared readers: OK");
+}
+
+static void test_recursive(void)
+{
+    reset();
+    rwlock_read_lock(&lock);
+
+    create(0, PRIO_LOW, writer, (void *)'w');
+    expect(!rwlock_read_trylock(&lock));
+    rwlock_read_lock_recursive(&lock);
+    rwlock_read_unlock(&lock);
+    expect(run_order_pos == 0);
+
+    rwlock_read_unlock(&lock);
+    expect(strcmp(run_order, "w") == 0);
+    puts("recursive read lock: OK");
+}
+
+int main(void)
+{
+    puts("Test Application for the reader-writer lock");
+
+    test_writer_preference();
+    test_priority_order();
+    test_shared_readers();
+    test_recursive();
+
+    puts("TEST PASSED");
+
+    return 0;
+}
@@ -0,0 +1,22 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("writer preference: OK")
+    child.expect_exact("priority order: OK")
+    child.expect_exact("shared readers: OK")
+    child.expect_exact("recursive read lock: OK")
+    child.expect_exact("TEST PASSED")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -34,6 +34,7 @@
 #include "net/gnrc/sixlowpan/frag.h"
 #include "net/gnrc/sixlowpan/frag/rb.h"
 #include "net/gnrc/sixlowpan/frag/minfwd.h"
+#include "net/gnrc/sixlowpan/frag/stats.h"
 #include "net/gnrc/sixlowpan/iphc.h"
 #include "net/netdev_test.h"
 /* for debugging _target_buf */
@@ -447,12 +448,53 @@ static void test_minfwd_vrbe_from_route__vrb_full(void)
     gnrc_pktbuf_release(ipv6_snip);
 }
 
+static void test_minfwd_vrbe__timeout(void)
+{
+    gnrc_sixlowpan_frag_vrb_t *vrbe = gnrc_sixlowpan_frag_vrb_add(
+            &_vrbe_base, _mock_netif, _rem_l2, sizeof(_rem_l2)
+        );
+
+    TEST_ASSERT_NOT_NULL(vrbe);
+    /* entry times out in 10ms */
+    gnrc_sixlowpan_frag_vrb_set_arrival(
+            vrbe, xtimer_now_usec() - CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_TIMEOUT_US +
+                  10000U
+        );
+    TEST_ASSERT_NOT_NULL(gnrc_sixlowpan_frag_vrb_get(_vrbe_base.src,
+                                                     _vrbe_base.src_len,
+                                                     _vrbe_base.tag));
+    /* garbage collection timer removes it */
+    xtimer_usleep(50000U);
+    TEST_ASSERT_NULL(gnrc_sixlowpan_frag_vrb_get(_vrbe_base.src,
+                                                 _vrbe_base.src_len,
+                                                 _vrbe_base.tag));
+}
+
+static const gnrc_sixlowpan_frag_stats_flow_t *_get_flow(void)
+{
+    gnrc_sixlowpan_frag_stats_t *stats = gnrc_sixlowpan_frag_stats_get();
+
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_STATS_FLOWS; i++) {
+        if ((stats->flows[i].src_len == _vrbe_base.src_len) &&
+            (memcmp(stats->flows[i].src, _vrbe_base.src,
+                    _vrbe_base.src_len) == 0) &&
+            (stats->flows[i].dst_len == sizeof(_rem_l2)) &&
+            (memcmp(stats->flows[i].dst, _rem_l2, sizeof(_rem_l2)) == 0)) {
+            return &stats->flows[i];
+        }
+    }
+    return NULL;
+}
+
 static void test_minfwd_forward__success__1st_frag_sixlo(void)
 {
     gnrc_sixlowpan_frag_vrb_t *vrbe = gnrc_sixlowpan_frag_vrb_add(
             &_vrbe_base, _mock_netif, _rem_l2, sizeof(_rem_l2)
         );
     gnrc_pktsnip_t *pkt, *frag;
+    const gnrc_sixlowpan_frag_stats_flow_t *flow = _get_flow();
+    unsigned fwd_fragments = gnrc_sixlowpan_frag_stats_get()->fwd_fragments;
+    unsigned flow_fragments = (flow != NULL) ? flow->fragments : 0;
     size_t mhr_len;
 
     vrbe->super.arrival = xtimer_now_usec();
@@ -485,6 +527,11 @@ static void test_minfwd_forward__success__1st_frag_sixlo(void)
     TEST_ASSERT_NOT_NULL(gnrc_sixlowpan_frag_vrb_get(_vrbe_base.src,
                                                      _vrbe_base.src_len,
                                                      _vrbe_base.tag));
+    /* fragment is counted for the flow */
+    TEST_ASSERT_EQUAL_INT(fwd_fragments + 1,
+                          gnrc_sixlowpan_frag_stats_get()->fwd_fragments);
+    TEST_ASSERT_NOT_NULL((flow = _get_flow()));
+    TEST_ASSERT_EQUAL_INT(flow_fragments + 1, flow->fragments);
 }
 
 static void test_minfwd_forward__success__1st_frag_iphc(void)
@@ -1474,6 +1521,7 @@ static Test *tests_gnrc_sixlowpan_frag_minfwd_api(void)
         new_TestFixture(test_minfwd_vrbe_from_route__no_route2),
         new_TestFixture(test_minfwd_vrbe_from_route__local_addr),
         new_TestFixture(test_minfwd_vrbe_from_route__vrb_full),
+        new_TestFixture(test_minfwd_vrbe__timeout),
         new_TestFixture(test_minfwd_forward__success__1st_frag_sixlo),
         new_TestFixture(test_minfwd_forward__success__1st_frag_iphc),
         new_TestFixture(test_minfwd_forward__success__nth_frag_incomplete),
@@ -23,6 +23,7 @@
 #include <stdint.h>
 #include <stdio.h>
 
+#include "container.h"
 #include "net/sock/udp.h"
 #include "test_utils/expect.h"
 #include "xtimer.h"
@@ -685,6 +686,90 @@ static void test_sock_udp_sendv__socketed(void)
     expect(_check_net());
 }
 
+static void test_sock_udp_sendv_batch__socketed(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const sock_udp_ep_t local = { .addr = { .ipv6 = _TEST_ADDR_LOCAL },
+                                         .family = AF_INET6,
+                                         .netif = _TEST_NETIF,
+                                         .port = _TEST_PORT_LOCAL };
+    static const sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR_REMOTE },
+                                          .family = AF_INET6,
+                                          .port = _TEST_PORT_REMOTE };
+    const iolist_t first = {
+        .iol_base = "ABCD",
+        .iol_len  = sizeof("ABCD"),
+    };
+    const iolist_t tail = {
+        .iol_base = "GH",
+        .iol_len  = sizeof("GH"),
+    };
+    const iolist_t second = {
+        .iol_next = (void *)&tail,
+        .iol_base = "EF",
+        .iol_len  = sizeof("EF") - 1,
+    };
+    const iolist_t *msgs[] = { &first, &second };
+
+    expect(0 == sock_udp_create(&_sock, &local, &remote, SOCK_FLAGS_REUSE_EP));
+    expect(-EINVAL == sock_udp_sendv_batch(&_sock, msgs, ARRAY_SIZE(msgs),
+                                           &(sock_udp_ep_t){ .family = AF_INET6,
+                                                             .port = 0 }));
+    expect(ARRAY_SIZE(msgs) == sock_udp_sendv_batch(&_sock, msgs,
+                                                    ARRAY_SIZE(msgs), NULL));
+    expect(_check_packet(&src_addr, &dst_addr, _TEST_PORT_LOCAL,
+                         _TEST_PORT_REMOTE, "ABCD", sizeof("ABCD"),
+                         _TEST_NETIF, false));
+    expect(_check_packet(&src_addr, &dst_addr, _TEST_PORT_LOCAL,
+                         _TEST_PORT_REMOTE, "EFGH", sizeof("EFGH"),
+                         _TEST_NETIF, false));
+    xtimer_usleep(1000);    /* let GNRC stack finish */
+    expect(_check_net());
+}
+
+static void test_sock_udp_cork__socketed(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const sock_udp_ep_t local = { .addr = { .ipv6 = _TEST_ADDR_LOCAL },
+                                         .family = AF_INET6,
+                                         .netif = _TEST_NETIF,
+                                         .port = _TEST_PORT_LOCAL };
+    static const sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR_REMOTE },
+                                          .family = AF_INET6,
+                                          .port = _TEST_PORT_REMOTE };
+    const iolist_t tail = {
+        .iol_base = "EFGH",
+        .iol_len  = sizeof("EFGH"),
+    };
+    const iolist_t head = {
+        .iol_next = (void *)&tail,
+        .iol_base = "CD",
+        .iol_len  = sizeof("CD") - 1,
+    };
+
+    expect(0 == sock_udp_create(&_sock, &local, &remote, SOCK_FLAGS_REUSE_EP));
+    expect(-ENOENT == sock_udp_cork_append(&_sock, "AB", 2));
+    expect(-ENOENT == sock_udp_uncork(&_sock, NULL));
+    expect(0 == sock_udp_cork(&_sock, 16));
+    expect(-EALREADY == sock_udp_cork(&_sock, 16));
+    expect(2 == sock_udp_cork_append(&_sock, "AB", 2));
+    expect((sizeof("ABCDEFGH")) == sock_udp_cork_appendv(&_sock, &head));
+    expect(-ENOBUFS == sock_udp_cork_append(&_sock, "IJKLMNOP", 8));
+    expect(sizeof("ABCDEFGH") == sock_udp_uncork(&_sock, NULL));
+    expect(_check_packet(&src_addr, &dst_addr, _TEST_PORT_LOCAL,
+                         _TEST_PORT_REMOTE, "ABCDEFGH", sizeof("ABCDEFGH"),
+                         _TEST_NETIF, false));
+    expect(-ENOENT == sock_udp_uncork(&_sock, NULL));
+    /* a message that is not sent is released on close */
+    expect(0 == sock_udp_cork(&_sock, 16));
+    expect(4 == sock_udp_cork_append(&_sock, "ABCD", 4));
+    sock_udp_close(&_sock);
+    xtimer_usleep(1000);    /* let GNRC stack finish */
+    expect(_check_net());
+}
+
 static void test_sock_udp_send__socketed_other_remote(void)
 {
     static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_LOCAL };
@@ -866,6 +951,8 @@ int main(void)
     CALL(test_sock_udp_send__socketed_no_local());
     CALL(test_sock_udp_send__socketed());
     CALL(test_sock_udp_sendv__socketed());
+    CALL(test_sock_udp_sendv_batch__socketed());
+    CALL(test_sock_udp_cork__socketed());
     CALL(test_sock_udp_send__socketed_other_remote());
     CALL(test_sock_udp_send__unsocketed_no_local_no_netif());
     CALL(test_sock_udp_send__unsocketed_no_netif());
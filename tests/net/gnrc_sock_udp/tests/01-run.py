@@ -42,6 +42,8 @@ def testfunc(child):
     child.expect_exact(u"Calling test_sock_udp_send__socketed_no_netif()")
     child.expect_exact(u"Calling test_sock_udp_send__socketed_no_local()")
     child.expect_exact(u"Calling test_sock_udp_send__socketed()")
+    child.expect_exact(u"Calling test_sock_udp_sendv_batch__socketed()")
+    child.expect_exact(u"Calling test_sock_udp_cork__socketed()")
     child.expect_exact(u"Calling test_sock_udp_send__socketed_other_remote()")
     child.expect_exact(u"Calling test_sock_udp_send__unsocketed_no_local_no_netif()")
     child.expect_exact(u"Calling test_sock_udp_send__unsocketed_no_netif()")
@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Listen backlog and batched accept of gnrc_tcp
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "msg.h"
+#include "net/af.h"
+#include "net/gnrc/netif.h"
+#include "net/gnrc/tcp.h"
+#include "net/ipv6/addr.h"
+#include "shell.h"
+
+#define MAIN_QUEUE_SIZE (8)
+#define REPLY           "telemetry\n"
+
+static msg_t _main_msg_queue[MAIN_QUEUE_SIZE];
+static gnrc_tcp_tcb_t _tcbs[TCP_CONNECTIONS];
+static gnrc_tcp_tcb_queue_t _queue = GNRC_TCP_TCB_QUEUE_INIT;
+
+static int _listen(int argc, char **argv)
+{
+    gnrc_tcp_ep_t local;
+    int res;
+
+    if (argc < 2) {
+        printf("usage: %s <port>\n", argv[0]);
+        return 1;
+    }
+    for (unsigned i = 0; i < TCP_CONNECTIONS; i++) {
+        gnrc_tcp_tcb_init(&_tcbs[i]);
+    }
+    gnrc_tcp_ep_init(&local, AF_INET6, NULL, 0, atoi(argv[1]), 0);
+    res = gnrc_tcp_listen(&_queue, _tcbs, TCP_CONNECTIONS, &local);
+    printf("%s: returns %d\n", argv[0], res);
+    return (res < 0) ? 1 : 0;
+}
+
+static int _accept(int argc, char **argv)
+{
+    gnrc_tcp_tcb_t *conns[TCP_CONNECTIONS];
+    uint32_t timeout = 0;
+    int res;
+
+    if (argc > 1) {
+        timeout = strtoul(argv[1], NULL, 10);
+    }
+    /* answer every connection that is ready with a single call */
+    res = gnrc_tcp_accept_multi(&_queue, conns, TCP_CONNECTIONS, timeout);
+    printf("%s: returns %d\n", argv[0], res);
+    for (int i = 0; i < res; i++) {
+        gnrc_tcp_send(conns[i], REPLY, sizeof(REPLY) - 1, 0);
+        gnrc_tcp_close(conns[i]);
+    }
+    return (res < 0) ? 1 : 0;
+}
+
+static int _stats(int argc, char **argv)
+{
+    gnrc_tcp_tcb_queue_stats_t stats;
+
+    (void)argc;
+    gnrc_tcp_queue_get_stats(&_queue, &stats);
+    printf("%s: syn_rcvd %" PRIu32 " syn_dropped %" PRIu32 " accepted %" PRIu32 "\n",
+           argv[0], stats.syn_rcvd, stats.syn_dropped, stats.accepted);
+    return 0;
+}
+
+static int _stop(int argc, char **argv)
+{
+    (void)argc;
+    gnrc_tcp_stop_listen(&_queue);
+    printf("%s: returns\n", argv[0]);
+    return 0;
+}
+
+static int _addr(int argc, char **argv)
+{
+    gnrc_netif_t *netif = gnrc_netif_iter(NULL);
+    ipv6_addr_t addrs[CONFIG_GNRC_NETIF_IPV6_ADDRS_NUMOF];
+    char addr_str[IPV6_ADDR_MAX_STR_LEN];
+    int res = gnrc_netif_ipv6_addrs_get(netif, addrs, sizeof(addrs));
+
+    (void)argc;
+    for (unsigned i = 0; res > 0 && i < res / sizeof(addrs[0]); i++) {
+        if (ipv6_addr_is_link_local(&addrs[i])) {
+            printf("%s: %s\n", argv[0],
+                   ipv6_addr_to_str(addr_str, &addrs[i], sizeof(addr_str)));
+        }
+    }
+    return 0;
+}
+
+static const shell_command_t shell_commands[] = {
+    { "listen", "listen on <port>", _listen },
+    { "accept", "accept all established connections [timeout ms]", _accept },
+    { "stats", "print statistics of the listening queue", _stats },
+    { "stop", "stop listening", _stop },
+    { "addr", "print link local address", _addr },
+    { NULL, NULL, NULL }
+};
+
+int main(void)
+{
+    /* we need a message queue for the thread running the shell in order to
+     * receive potentially fast incoming networking packets */
+    msg_init_queue(_main_msg_queue, MAIN_QUEUE_SIZE);
+
+    char line_buf[SHELL_DEFAULT_BUFSIZE];
+    shell_run(shell_commands, line_buf, SHELL_DEFAULT_BUFSIZE);
+
+    return 0;
+}
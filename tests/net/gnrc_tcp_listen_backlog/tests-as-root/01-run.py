@@ -0,0 +1,118 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import errno
+import os
+import select
+import socket
+import sys
+import time
+
+from testrunner import run
+
+
+TAP = os.environ.get("TAP", "tap0")
+CONNECTIONS = int(os.environ.get("TCP_CONNECTIONS", 4))
+BACKLOG = int(os.environ.get("TCP_LISTEN_BACKLOG", 2))
+PORT = 5000
+
+
+def _connect_all(addr, num):
+    """Start num connection attempts at once"""
+    target = socket.getaddrinfo("{}%{}".format(addr, TAP), PORT,
+                                socket.AF_INET6, socket.SOCK_STREAM)[0][4]
+    socks = []
+    for _ in range(num):
+        sock = socket.socket(socket.AF_INET6, socket.SOCK_STREAM)
+        sock.setblocking(False)
+        res = sock.connect_ex(target)
+        assert res in (0, errno.EINPROGRESS), os.strerror(res)
+        socks.append(sock)
+    return socks
+
+
+def _wait_connected(socks, timeout):
+    """Wait until the handshake of every socket completed"""
+    pending = list(socks)
+    deadline = time.monotonic() + timeout
+    while pending and time.monotonic() < deadline:
+        _, writable, _ = select.select([], pending, [], 0.1)
+        for sock in writable:
+            assert sock.getsockopt(socket.SOL_SOCKET, socket.SO_ERROR) == 0
+            pending.remove(sock)
+    assert not pending, "{} connections not established".format(len(pending))
+
+
+def _drain(child, socks, num, timeout=30):
+    """Read replies of num accepted connections and close them"""
+    done = []
+    deadline = time.monotonic() + timeout
+    while len(done) < num and time.monotonic() < deadline:
+        readable, _, _ = select.select(socks, [], [], 0.1)
+        for sock in readable:
+            data = sock.recv(64)
+            if data:
+                assert data == b"telemetry\n"
+            else:
+                sock.close()
+                socks.remove(sock)
+                done.append(sock)
+    assert len(done) == num
+    child.expect_exact(">")
+
+
+def _stats(child):
+    child.sendline("stats")
+    child.expect(r"stats: syn_rcvd (\d+) syn_dropped (\d+) accepted (\d+)")
+    return tuple(int(g) for g in child.match.groups())
+
+
+def testfunc(child):
+    child.sendline("addr")
+    child.expect(r"addr: (\S+)")
+    addr = child.match.group(1)
+    child.sendline("listen {}".format(PORT))
+    child.expect_exact("listen: returns 0")
+
+    # nothing was accepted yet: only BACKLOG handshakes are completed, the other SYNs
+    # are dropped without a reset
+    socks = _connect_all(addr, CONNECTIONS)
+    time.sleep(0.5)
+    syn_rcvd, syn_dropped, accepted = _stats(child)
+    assert syn_rcvd == BACKLOG
+    assert syn_dropped >= CONNECTIONS - BACKLOG
+    assert accepted == 0
+
+    # a single accept call takes every established connection
+    child.sendline("accept")
+    child.expect_exact("accept: returns {}".format(BACKLOG))
+    _drain(child, socks, BACKLOG)
+
+    # the peer retransmits the dropped SYNs, they find room in the backlog now
+    _wait_connected(socks, 10)
+    child.sendline("accept 1000")
+    child.expect_exact("accept: returns {}".format(CONNECTIONS - BACKLOG))
+    _drain(child, socks, CONNECTIONS - BACKLOG)
+
+    syn_rcvd, syn_dropped, accepted = _stats(child)
+    assert syn_rcvd == CONNECTIONS
+    assert accepted == CONNECTIONS
+    print("\nsyn_rcvd {} syn_dropped {} accepted {}"
+          .format(syn_rcvd, syn_dropped, accepted))
+
+    child.sendline("stop")
+    child.expect_exact("stop: returns")
+
+
+if __name__ == "__main__":
+    if os.geteuid() != 0:
+        print("\x1b[1;31mThis test requires root privileges.\n"
+              "It's connecting to RIOT via a TAP interface.\x1b[0m\n",
+              file=sys.stderr)
+        sys.exit(1)
+    sys.exit(run(testfunc, timeout=10, echo=False))
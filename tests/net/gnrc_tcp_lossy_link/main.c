@@ -0,0 +1,174 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Goodput of gnrc_tcp over a lossy link
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "msg.h"
+#include "net/af.h"
+#include "net/gnrc/tcp.h"
+#include "shell.h"
+#include "ztimer.h"
+
+#define MAIN_QUEUE_SIZE (8)
+#define CHUNK_SIZE      (512)
+
+static msg_t main_msg_queue[MAIN_QUEUE_SIZE];
+static gnrc_tcp_tcb_t tcb;
+static gnrc_tcp_tcb_queue_t queue = GNRC_TCP_TCB_QUEUE_INIT;
+static uint8_t buffer[CHUNK_SIZE];
+
+static void _print_goodput(const char *cmd, const char *verb, size_t len,
+                           uint32_t start)
+{
+    uint32_t duration = ztimer_now(ZTIMER_MSEC) - start;
+
+    if (duration == 0) {
+        duration = 1;
+    }
+    printf("%s: %s %" PRIuSIZE " bytes in %" PRIu32 " ms (%" PRIu32 " B/s)\n",
+           cmd, verb, len, duration, (uint32_t)((len * MS_PER_SEC) / duration));
+}
+
+static int _tcp_server(int argc, char **argv)
+{
+    gnrc_tcp_tcb_t *conn = NULL;
+    gnrc_tcp_ep_t local;
+    size_t len, rcvd = 0;
+    uint32_t start;
+    int res;
+
+    if (argc < 3) {
+        printf("usage: %s <port> <bytes>\n", argv[0]);
+        return 1;
+    }
+    gnrc_tcp_ep_init(&local, AF_INET6, NULL, 0, atoi(argv[1]), 0);
+    len = atol(argv[2]);
+
+    gnrc_tcp_tcb_init(&tcb);
+    res = gnrc_tcp_listen(&queue, &tcb, 1, &local);
+    if (res < 0) {
+        printf("%s: listen failed (%d)\n", argv[0], res);
+        return 1;
+    }
+    printf("%s: listening\n", argv[0]);
+    res = gnrc_tcp_accept(&queue, &conn, GNRC_TCP_NO_TIMEOUT);
+    if (res < 0) {
+        printf("%s: accept failed (%d)\n", argv[0], res);
+        gnrc_tcp_stop_listen(&queue);
+        return 1;
+    }
+
+    start = ztimer_now(ZTIMER_MSEC);
+    while (rcvd < len) {
+        ssize_t n = gnrc_tcp_recv(conn, buffer, sizeof(buffer), GNRC_TCP_NO_TIMEOUT);
+
+        if (n <= 0) {
+            printf("%s: recv failed (%d)\n", argv[0], (int)n);
+            break;
+        }
+        /* payload is the byte position modulo 256, see _tcp_client() */
+        for (ssize_t i = 0; i < n; i++) {
+            if (buffer[i] != (uint8_t)(rcvd + i)) {
+                printf("%s: data mismatch at %" PRIuSIZE "\n", argv[0],
+                       rcvd + (size_t)i);
+                n = -1;
+                break;
+            }
+        }
+        if (n < 0) {
+            break;
+        }
+        rcvd += n;
+    }
+    if (rcvd == len) {
+        _print_goodput(argv[0], "received", rcvd, start);
+    }
+
+    gnrc_tcp_close(conn);
+    gnrc_tcp_stop_listen(&queue);
+    return (rcvd == len) ? 0 : 1;
+}
+
+static int _tcp_client(int argc, char **argv)
+{
+    gnrc_tcp_ep_t remote;
+    size_t len, sent = 0;
+    uint32_t start;
+    int res;
+
+    if (argc < 3) {
+        printf("usage: %s <[addr]:port> <bytes>\n", argv[0]);
+        return 1;
+    }
+    if (gnrc_tcp_ep_from_str(&remote, argv[1]) < 0) {
+        printf("%s: invalid endpoint %s\n", argv[0], argv[1]);
+        return 1;
+    }
+    len = atol(argv[2]);
+
+    gnrc_tcp_tcb_init(&tcb);
+    res = gnrc_tcp_open(&tcb, &remote, 0);
+    if (res < 0) {
+        printf("%s: open failed (%d)\n", argv[0], res);
+        return 1;
+    }
+
+    start = ztimer_now(ZTIMER_MSEC);
+    while (sent < len) {
+        size_t chunk = (len - sent < sizeof(buffer)) ? len - sent : sizeof(buffer);
+
+        for (size_t i = 0; i < chunk; i++) {
+            buffer[i] = (uint8_t)(sent + i);
+        }
+        for (size_t off = 0; off < chunk;) {
+            ssize_t n = gnrc_tcp_send(&tcb, buffer + off, chunk - off, GNRC_TCP_NO_TIMEOUT);
+
+            if (n <= 0) {
+                printf("%s: send failed (%d)\n", argv[0], (int)n);
+                gnrc_tcp_abort(&tcb);
+                return 1;
+            }
+            off += n;
+        }
+        sent += chunk;
+    }
+    _print_goodput(argv[0], "sent", sent, start);
+
+    gnrc_tcp_close(&tcb);
+    return 0;
+}
+
+static const shell_command_t shell_commands[] = {
+    { "tcp_server", "receive <bytes> on <port>", _tcp_server },
+    { "tcp_client", "send <bytes> to <[addr]:port>", _tcp_client },
+    { NULL, NULL, NULL }
+};
+
+int main(void)
+{
+    /* we need a message queue for the thread running the shell in order to
+     * receive potentially fast incoming networking packets */
+    msg_init_queue(main_msg_queue, MAIN_QUEUE_SIZE);
+
+    char line_buf[SHELL_DEFAULT_BUFSIZE];
+    shell_run(shell_commands, line_buf, SHELL_DEFAULT_BUFSIZE);
+
+    return 0;
+}
@@ -0,0 +1,125 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import contextlib
+import os
+import subprocess
+import sys
+
+from subprocess import Popen
+from riotctrl.ctrl import RIOTCtrlBoardFactory
+from riotctrl_ctrl import native
+from riotctrl_shell.netif import Ifconfig, IfconfigListParser
+
+RIOTBASE = os.getenv("RIOTBASE", os.path.abspath(os.path.join(os.path.dirname(__file__), "../../../")))
+ZEP_DISPATCH_PATH = os.path.join(RIOTBASE, "dist/tools/zep_dispatch/bin/zep_dispatch")
+TRANSFER_SIZE = int(os.getenv("TRANSFER_SIZE", "2048"))
+# probability that a frame is delivered
+LINK_QUALITY = os.getenv("LINK_QUALITY", "0.9")
+PORT = 5000
+
+
+class RIOTCtrlAppFactory(RIOTCtrlBoardFactory):
+
+    def __init__(self, board='native'):
+        super().__init__(board_cls={
+            board: native.NativeRIOTCtrl,
+        })
+        self.board = board
+        self.ctrl_list = list()
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *exc):
+        for ctrl in self.ctrl_list:
+            ctrl.stop_term()
+
+    def get_shell(self, application_directory='.', env=None):
+        if env is None:
+            env = {'BOARD': self.board}
+        # retrieve a RIOTCtrl Object
+        ctrl = super().get_ctrl(
+            env=env,
+            application_directory=application_directory
+        )
+        # append ctrl to list
+        self.ctrl_list.append(ctrl)
+        # start terminal
+        ctrl.start_term()
+        ctrl.term.logfile = sys.stdout
+        # return ctrl with started terminal
+        return Shell(ctrl)
+
+    def get_shells(self, num=1):
+        terms = []
+        for i in range(num):
+            terms.append(self.get_shell())
+        return terms
+
+
+class Shell(Ifconfig):
+    pass
+
+
+def link_local_addr(ifconfig_out):
+    netifs = IfconfigListParser().parse(ifconfig_out)
+    netif = netifs[next(iter(netifs))]
+    return [addr["addr"] for addr in netif["ipv6_addrs"] if addr["scope"] == "link"][0]
+
+
+def test_goodput(factory, zep_dispatch):
+    zep_dispatch.stdin.write("A B {}\n".format(LINK_QUALITY).encode())
+    zep_dispatch.stdin.close()
+
+    server, client = factory.get_shells(2)
+    addr = link_local_addr(server.ifconfig_list())
+
+    server.riotctrl.term.sendline("tcp_server {} {}".format(PORT, TRANSFER_SIZE))
+    server.riotctrl.term.expect_exact("tcp_server: listening")
+    client.riotctrl.term.sendline("tcp_client [{}]:{} {}".format(addr, PORT, TRANSFER_SIZE))
+
+    # every byte must arrive in order, losses only cost time
+    client.riotctrl.term.expect(r"tcp_client: sent (\d+) bytes in (\d+) ms \((\d+) B/s\)",
+                                timeout=300)
+    assert int(client.riotctrl.term.match.group(1)) == TRANSFER_SIZE
+    server.riotctrl.term.expect(r"tcp_server: received (\d+) bytes in (\d+) ms \((\d+) B/s\)",
+                                timeout=30)
+    assert int(server.riotctrl.term.match.group(1)) == TRANSFER_SIZE
+    print("\nGoodput at link quality {}: {} B/s".format(
+          LINK_QUALITY, server.riotctrl.term.match.group(3)))
+
+
+@contextlib.contextmanager
+def run_zep_dispatch():
+    zep_dispatch = Popen(
+        [
+            ZEP_DISPATCH_PATH,
+            '-t',
+            '-',
+            '127.0.0.1',
+            '17754'
+        ],
+        stdin=subprocess.PIPE
+    )
+    try:
+        yield zep_dispatch
+    finally:
+        zep_dispatch.terminate()
+
+
+if __name__ == "__main__":
+    board = os.environ.get('BOARD', 'native')
+    if board not in ['native', 'native32', 'native64']:
+        print('\x1b[1;31mThis test requires a native board.\x1b[0m\n',
+              file=sys.stderr)
+        sys.exit(1)
+
+    with RIOTCtrlAppFactory(board) as factory, run_zep_dispatch() as zep_dispatch:
+        test_goodput(factory, zep_dispatch)
+    print("SUCCESS")
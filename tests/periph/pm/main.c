@@ -19,6 +19,7 @@
  * @}
  */
 
+#include <inttypes.h>
 #include <stdio.h>
 #include <stdlib.h>
 
@@ -150,6 +151,24 @@ static int cmd_set_rtc(int argc, char **argv)
     return 0;
 }
 #endif /* MODULE_PERIPH_RTC */
+
+#ifdef MODULE_PM_LAYERED_PREDICTIVE
+static int cmd_residency(int argc, char **argv)
+{
+    (void)argc;
+    (void)argv;
+
+    pm_residency_t residency;
+
+    pm_get_residency(&residency);
+    for (unsigned i = 0; i < PM_NUM_MODES; i++) {
+        printf("mode %u entered: %" PRIu32 ", skipped: %" PRIu32 "\n", i,
+               residency.entered[i], residency.skipped[i]);
+    }
+
+    return 0;
+}
+#endif /* MODULE_PM_LAYERED_PREDICTIVE */
 #endif /* MODULE_PM_LAYERED */
 
 #if defined(MODULE_PERIPH_GPIO_IRQ) && defined(BTN0_PIN)
@@ -167,6 +186,9 @@ static const shell_command_t shell_commands[] = {
 #if defined MODULE_PM_LAYERED && defined MODULE_PERIPH_RTC
     { "set_rtc", "temporary set power mode", cmd_set_rtc },
     { "unblock_rtc", "temporarily unblock power mode", cmd_unblock_rtc },
+#endif
+#ifdef MODULE_PM_LAYERED_PREDICTIVE
+    { "residency", "show power mode selection counters", cmd_residency },
 #endif
     { NULL, NULL, NULL }
 };
@@ -0,0 +1,181 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Priority and deadline event queue test application
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "event/prio.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+#include "ztimer/mock.h"
+
+#define NUMOF_EVENTS    (5U)
+
+static event_prio_queue_t _queue;
+static event_prio_t _events[NUMOF_EVENTS];
+static unsigned _order[NUMOF_EVENTS];
+static unsigned _handled;
+
+static void _handler(event_t *event)
+{
+    _order[_handled++] = (event_prio_t *)event - _events;
+}
+
+static void _dispatch_all(void)
+{
+    event_prio_t *event;
+
+    _handled = 0;
+    while ((event = event_prio_get(&_queue))) {
+        event->super.handler(&event->super);
+    }
+}
+
+static void _expect_order(const unsigned *order, unsigned numof)
+{
+    expect(_handled == numof);
+    for (unsigned i = 0; i < numof; i++) {
+        expect(_order[i] == order[i]);
+    }
+}
+
+static void test_priority(void)
+{
+    static const unsigned order[] = { 3, 1, 4, 0, 2 };
+
+    event_prio_queue_init(&_queue);
+
+    event_prio_post(&_queue, &_events[0], 5);
+    event_prio_post(&_queue, &_events[1], 1);
+    event_prio_post(&_queue, &_events[2], 7);
+    event_prio_post(&_queue, &_events[3], 0);
+    /* same priority as _events[1], but posted later */
+    event_prio_post(&_queue, &_events[4], 1);
+    /* reposting a queued event doesn't change its position */
+    event_prio_post(&_queue, &_events[2], 0);
+
+    for (unsigned i = 0; i < NUMOF_EVENTS; i++) {
+        expect(event_prio_is_queued(&_events[i]));
+    }
+
+    _dispatch_all();
+    _expect_order(order, NUMOF_EVENTS);
+
+    for (unsigned i = 0; i < NUMOF_EVENTS; i++) {
+        expect(!event_prio_is_queued(&_events[i]));
+    }
+    puts("priority ordering OK");
+}
+
+static void test_cancel(void)
+{
+    static const unsigned order[] = { 0, 2 };
+
+    event_prio_queue_init(&_queue);
+
+    event_prio_post(&_queue, &_events[0], 1);
+    event_prio_post(&_queue, &_events[1], 2);
+    event_prio_post(&_queue, &_events[2], 3);
+    event_prio_cancel(&_queue, &_events[1]);
+    expect(!event_prio_is_queued(&_events[1]));
+
+    _dispatch_all();
+    _expect_order(order, 2);
+    puts("cancel OK");
+}
+
+static void test_deadline(void)
+{
+    static const unsigned order[] = { 1, 2, 0 };
+
+    event_deadline_queue_init(&_queue, ZTIMER_USEC);
+
+    event_prio_post(&_queue, &_events[0], 3000);
+    ztimer_sleep(ZTIMER_USEC, 1000);
+    /* due 1000us earlier than _events[0] */
+    event_prio_post(&_queue, &_events[1], 1000);
+    /* posted later with a longer relative deadline, but still due first */
+    ztimer_sleep(ZTIMER_USEC, 500);
+    event_prio_post(&_queue, &_events[2], 1000);
+
+    _dispatch_all();
+    _expect_order(order, 3);
+    puts("deadline ordering OK");
+}
+
+static void test_deadline_wrap(void)
+{
+    static const unsigned order[] = { 1, 2, 0 };
+    ztimer_mock_t mock;
+
+    ztimer_mock_init(&mock, 32);
+    ztimer_mock_jump(&mock, UINT32_MAX - 100);
+    event_deadline_queue_init(&_queue, &mock.super);
+
+    /* due after the clock wrapped around */
+    event_prio_post(&_queue, &_events[0], 300);
+    /* due before the clock wraps around */
+    event_prio_post(&_queue, &_events[1], 50);
+    ztimer_mock_jump(&mock, 10);
+    event_prio_post(&_queue, &_events[2], 100);
+
+    _dispatch_all();
+    _expect_order(order, 3);
+    puts("deadline wrap around OK");
+}
+
+static void test_timeout(void)
+{
+    static const unsigned order[] = { 1, 0 };
+    event_prio_timeout_t timeout;
+
+    event_prio_queue_init(&_queue);
+
+    event_prio_post(&_queue, &_events[0], 10);
+    event_prio_timeout_init(&timeout, ZTIMER_USEC, &_queue, &_events[1], 0);
+    event_prio_timeout_set(&timeout, 1000);
+    expect(!event_prio_is_queued(&_events[1]));
+    ztimer_sleep(ZTIMER_USEC, 2000);
+
+    /* the timed out event overtakes the already queued one */
+
+    _dispatch_all();
+    _expect_order(order, 2);
+
+    event_prio_timeout_set(&timeout, 1000);
+    event_prio_timeout_clear(&timeout);
+    ztimer_sleep(ZTIMER_USEC, 2000);
+    expect(!event_prio_is_queued(&_events[1]));
+    puts("timeout OK");
+}
+
+int main(void)
+{
+    for (unsigned i = 0; i < NUMOF_EVENTS; i++) {
+        _events[i].super.handler = _handler;
+    }
+
+    test_priority();
+    test_cancel();
+    test_deadline();
+    test_deadline_wrap();
+    test_timeout();
+
+    puts("[SUCCESS]");
+
+    return 0;
+}
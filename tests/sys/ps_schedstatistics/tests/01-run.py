@@ -28,7 +28,13 @@ PS_EXPECTED = (
      r'0x\d+ | 0x\d+  | \d+\.\d+% |      \d+'),
     (r'\t  7 | thread               | bl rx    _ |   6 | \d+  \( -?\d+\) | '
      r'0x\d+ | 0x\d+  | \d+\.\d+% |      \d+'),
-    (r'\t    | SUM                  |            |     | \d+  \(\d+\)')
+    (r'\t    | SUM                  |            |     | \d+  \(\d+\)'),
+    (r'\tpid | histo    |     max us | >=     0 | >=    16'),
+)
+
+PS_HIST_EXPECTED = (
+    r'\t  {} | latency  | +\d+( \| +\d+){{8}}',
+    r'\t    | runtime  | +\d+( \| +\d+){{8}}',
 )
 
 
@@ -53,6 +59,9 @@ def _check_ps(child):
     child.sendline('ps')
     for line in PS_EXPECTED:
         child.expect(line)
+    for pid in range(1, 8):
+        for line in PS_HIST_EXPECTED:
+            child.expect(line.format(pid))
     # Wait for all lines of the ps output to be displayed
     child.expect_exact('>')
 
@@ -367,6 +367,41 @@ static void test_gcoap__server_con_resp(void)
     TEST_ASSERT_EQUAL_INT(sizeof(resp_data), res + 1);
 }
 
+/*
+ * Server CON GET response written into a different buffer than the request
+ * was parsed from, as done when the request is read from the stack's buffer.
+ */
+static void test_gcoap__server_con_resp_other_buf(void)
+{
+    uint8_t req_buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+    uint8_t buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+    uint8_t req_data[CONFIG_GCOAP_PDU_BUF_SIZE];
+    coap_pkt_t pdu;
+
+    /* read request */
+    _read_cli_stats_req_con(&pdu, &req_buf[0]);
+    memcpy(req_data, req_buf, sizeof(req_data));
+
+    /* generate response */
+    gcoap_resp_init(&pdu, &buf[0], sizeof(buf), COAP_CODE_CONTENT);
+    coap_opt_add_format(&pdu, COAP_FORMAT_TEXT);
+    ssize_t res = coap_opt_finish(&pdu, COAP_OPT_FINISH_PAYLOAD);
+
+    char resp_payload[]  = "2";
+    memcpy(&pdu.payload[0], &resp_payload[0], strlen(resp_payload));
+
+    uint8_t resp_data[] = {
+        0x62, 0x45, 0x8e, 0x03, 0x35, 0x61, 0xc0, 0xff,
+        0x32
+    };
+
+    TEST_ASSERT((uint8_t *)pdu.hdr == &buf[0]);
+    TEST_ASSERT_EQUAL_INT(sizeof(resp_data), res + strlen(resp_payload));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(resp_data, buf, sizeof(resp_data)));
+    /* request is left untouched */
+    TEST_ASSERT_EQUAL_INT(0, memcmp(req_data, req_buf, sizeof(req_data)));
+}
+
 /*
  * Test the export of configured resources as CoRE link format string
  */
@@ -405,6 +440,7 @@ Test *tests_gcoap_tests(void)
         new_TestFixture(test_gcoap__server_get_resp),
         new_TestFixture(test_gcoap__server_con_req),
         new_TestFixture(test_gcoap__server_con_resp),
+        new_TestFixture(test_gcoap__server_con_resp_other_buf),
         new_TestFixture(test_gcoap__server_get_resource_list)
     };
 
@@ -178,6 +178,69 @@ static void test_nib_ft_get__success4(void)
     TEST_ASSERT_EQUAL_INT(IFACE, fte.iface);
 }
 
+/*
+ * Adds two routes to the forwarding table that only differ in their prefix
+ * length, the shorter one first, then tries to get an address that matches
+ * both routes by more bits than the longer prefix.
+ * Expected result: gnrc_ipv6_nib_ft_get() returns route with the longer prefix
+ */
+static void test_nib_ft_get__success5(void)
+{
+    gnrc_ipv6_nib_ft_t fte;
+    static const ipv6_addr_t dst = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                              { .u64 = TEST_UINT64 } } };
+    static const ipv6_addr_t next_hop1 = { .u64 = { { .u8 = LINK_LOCAL_PREFIX },
+                                                  { .u64 = TEST_UINT64 } } };
+    static const ipv6_addr_t next_hop2 = { .u64 = { { .u8 = LINK_LOCAL_PREFIX },
+                                                  { .u64 = TEST_UINT64 + 1 } } };
+
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&dst, GLOBAL_PREFIX_LEN,
+                                                  &next_hop1, IFACE, 0));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&dst, 2 * GLOBAL_PREFIX_LEN,
+                                                  &next_hop2, IFACE, 0));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&dst, NULL, &fte));
+    TEST_ASSERT(ipv6_addr_equal(&next_hop2, &fte.next_hop));
+    TEST_ASSERT_EQUAL_INT(2 * GLOBAL_PREFIX_LEN, fte.dst_len);
+    TEST_ASSERT_EQUAL_INT(IFACE, fte.iface);
+}
+
+/*
+ * Adds routes with nested and diverging prefixes to the forwarding table,
+ * then removes the longer ones one by one and gets an address that matches
+ * all of them after each removal.
+ * Expected result: gnrc_ipv6_nib_ft_get() returns the longest prefix
+ * remaining each time
+ */
+static void test_nib_ft_get__success_after_del(void)
+{
+    gnrc_ipv6_nib_ft_t fte;
+    static const ipv6_addr_t dst = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                              { .u64 = TEST_UINT64 } } };
+    static const uint8_t dst_lens[] = { 16, 64, 48, 32, 128 };
+    static const uint8_t del_order[] = { 128, 64, 48, 32, 16 };
+    ipv6_addr_t next_hop = { .u64 = { { .u8 = LINK_LOCAL_PREFIX },
+                                      { .u64 = TEST_UINT64 } } };
+    ipv6_addr_t other = dst;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(dst_lens); i++) {
+        next_hop.u8[15] = dst_lens[i];
+        TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&dst, dst_lens[i],
+                                                      &next_hop, IFACE, 0));
+        /* routes forking off the ones above */
+        bf_toggle(other.u8, dst_lens[i] - 1);
+        TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&other, dst_lens[i],
+                                                      &next_hop, IFACE, 0));
+        bf_toggle(other.u8, dst_lens[i] - 1);
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(del_order); i++) {
+        TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&dst, NULL, &fte));
+        TEST_ASSERT_EQUAL_INT(del_order[i], fte.dst_len);
+        TEST_ASSERT_EQUAL_INT(del_order[i], fte.next_hop.u8[15]);
+        gnrc_ipv6_nib_ft_del(&dst, del_order[i]);
+    }
+    TEST_ASSERT_EQUAL_INT(-ENETUNREACH, gnrc_ipv6_nib_ft_get(&dst, NULL, &fte));
+}
+
 /*
  * Tries to create a forwarding table entry for the default route (::) with
  * NULL as next hop.
@@ -727,6 +790,8 @@ Test *tests_gnrc_ipv6_nib_ft_tests(void)
         new_TestFixture(test_nib_ft_get__success2),
         new_TestFixture(test_nib_ft_get__success3),
         new_TestFixture(test_nib_ft_get__success4),
+        new_TestFixture(test_nib_ft_get__success5),
+        new_TestFixture(test_nib_ft_get__success_after_del),
         new_TestFixture(test_nib_ft_add__EINVAL_def_route_next_hop_NULL),
         new_TestFixture(test_nib_ft_add__EINVAL_iface0),
         new_TestFixture(test_nib_ft_add__ENOMEM_diff_def_router),
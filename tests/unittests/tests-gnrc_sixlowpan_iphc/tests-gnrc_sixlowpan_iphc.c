@@ -0,0 +1,222 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ */
+#include <stdint.h>
+#include <string.h>
+
+#include "embUnit/embUnit.h"
+
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/netif/internal.h"
+#include "net/gnrc/sixlowpan/ctx.h"
+#include "net/gnrc/sixlowpan/iphc.h"
+#include "net/ipv6/hdr.h"
+#include "net/netdev.h"
+#include "net/protnum.h"
+
+#include "tests-gnrc_sixlowpan_iphc.h"
+
+#define TEST_L2ADDR         { 0x3a, 0x1c, 0x97, 0x4d, 0x62, 0x0b, 0xe4, 0x85 }
+#define TEST_L2ADDR2        { 0x3a, 0x1c, 0x97, 0x4d, 0x62, 0x0b, 0xe4, 0x86 }
+#define TEST_DST_L2ADDR     { 0xc6, 0x52, 0x0e, 0x38, 0xa1, 0x7f, 0x29, 0xd4 }
+#define TEST_PREFIX         { { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00, \
+                                0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } }
+#define TEST_CTX_ID         (0U)
+#define TEST_CTX_LTIME      (60U)
+#define TEST_HL             (64U)
+#define TEST_NUMOF_FLOWS    (2 * CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE + 1)
+
+/* IPHC dispatch with elided traffic class and flow label, inline next header
+ * and a hop limit of 64 */
+#define TEST_IPHC1          (SIXLOWPAN_IPHC1_DISP | 0x18 | 0x02)
+
+static const uint8_t _l2addr[] = TEST_L2ADDR;
+static const uint8_t _dst_l2addr[] = TEST_DST_L2ADDR;
+static const ipv6_addr_t _prefix = TEST_PREFIX;
+
+static gnrc_netif_t _netif;
+static eui64_t _iid;
+static struct {
+    gnrc_netif_hdr_t hdr;
+    uint8_t dst[sizeof(_dst_l2addr)];
+} _netif_hdr;
+static ipv6_hdr_t _ipv6_hdrs[TEST_NUMOF_FLOWS];
+static gnrc_pktsnip_t _ipv6_snips[TEST_NUMOF_FLOWS];
+static gnrc_pktsnip_t _pkts[TEST_NUMOF_FLOWS];
+static uint8_t _iphc_hdr[sizeof(ipv6_hdr_t) + 1];
+
+static void set_up(void)
+{
+    memset(&_netif, 0, sizeof(_netif));
+    _netif.device_type = NETDEV_TYPE_IEEE802154;
+    _netif.flags = GNRC_NETIF_FLAGS_HAS_L2ADDR;
+    memcpy(_netif.l2addr, _l2addr, sizeof(_l2addr));
+    _netif.l2addr_len = sizeof(_l2addr);
+    gnrc_netif_hdr_init(&_netif_hdr.hdr, 0, sizeof(_dst_l2addr));
+    gnrc_netif_hdr_set_dst_addr(&_netif_hdr.hdr, _dst_l2addr,
+                                sizeof(_dst_l2addr));
+    TEST_ASSERT(gnrc_netif_ipv6_get_iid(&_netif, &_iid) >= 0);
+    gnrc_sixlowpan_ctx_reset();
+}
+
+/* flow i goes from the interface's address with the prefix to the i-th
+ * address with the same prefix */
+static gnrc_pktsnip_t *_flow(unsigned i, const ipv6_addr_t *prefix)
+{
+    ipv6_hdr_t *ipv6_hdr = &_ipv6_hdrs[i];
+
+    memset(ipv6_hdr, 0, sizeof(*ipv6_hdr));
+    ipv6_hdr_set_version(ipv6_hdr);
+    ipv6_hdr->nh = PROTNUM_IPV6_NONXT;
+    ipv6_hdr->hl = TEST_HL;
+    memcpy(&ipv6_hdr->src, prefix, sizeof(ipv6_addr_t));
+    memcpy(&ipv6_hdr->src.u64[1], &_iid, sizeof(_iid));
+    memcpy(&ipv6_hdr->dst, prefix, sizeof(ipv6_addr_t));
+    ipv6_hdr->dst.u8[15] = i + 1;
+    _ipv6_snips[i].data = ipv6_hdr;
+    _ipv6_snips[i].size = sizeof(*ipv6_hdr);
+    _ipv6_snips[i].type = GNRC_NETTYPE_IPV6;
+    _pkts[i].next = &_ipv6_snips[i];
+    _pkts[i].data = &_netif_hdr;
+    _pkts[i].size = sizeof(_netif_hdr);
+    _pkts[i].type = GNRC_NETTYPE_NETIF;
+    return &_pkts[i];
+}
+
+static void test_encode_hdr__link_local(void)
+{
+    static const uint8_t exp[] = {
+        TEST_IPHC1,
+        0x33,   /* SAM and DAM derived from link-layer addresses */
+        PROTNUM_IPV6_NONXT,
+    };
+    gnrc_pktsnip_t *pkt;
+    eui64_t iid;
+
+    pkt = _flow(0, &ipv6_addr_link_local_prefix);
+    TEST_ASSERT(gnrc_netif_hdr_ipv6_iid_from_dst(&_netif, &_netif_hdr.hdr,
+                                                 &iid) >= 0);
+    memcpy(&_ipv6_hdrs[0].dst.u64[1], &iid, sizeof(iid));
+    /* second encoding is served from the cache */
+    for (unsigned i = 0; i < 2; i++) {
+        memset(_iphc_hdr, 0, sizeof(_iphc_hdr));
+        TEST_ASSERT_EQUAL_INT(sizeof(exp),
+                              gnrc_sixlowpan_iphc_encode_hdr(pkt, &_netif,
+                                                             _iphc_hdr));
+        TEST_ASSERT_EQUAL_INT(0, memcmp(exp, _iphc_hdr, sizeof(exp)));
+    }
+}
+
+static void test_encode_hdr__l2addr_changed(void)
+{
+    static const uint8_t l2addr[] = TEST_L2ADDR2;
+    static const uint8_t exp[] = {
+        TEST_IPHC1,
+        0x13,   /* SAM inline 64 bits, DAM derived from link-layer address */
+        PROTNUM_IPV6_NONXT,
+    };
+    gnrc_pktsnip_t *pkt;
+    eui64_t iid;
+
+    test_encode_hdr__link_local();
+    pkt = &_pkts[0];
+    /* the source address does not match the interface identifier anymore */
+    memcpy(_netif.l2addr, l2addr, sizeof(l2addr));
+    TEST_ASSERT_EQUAL_INT(sizeof(exp) + sizeof(iid),
+                          gnrc_sixlowpan_iphc_encode_hdr(pkt, &_netif,
+                                                         _iphc_hdr));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(exp, _iphc_hdr, sizeof(exp)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(&_ipv6_hdrs[0].src.u64[1],
+                                    &_iphc_hdr[sizeof(exp)], sizeof(iid)));
+}
+
+static void test_encode_hdr__ctx_removed(void)
+{
+    static const uint8_t exp_ctx[] = {
+        TEST_IPHC1,
+        0x75,   /* SAM derived from context and link-layer address,
+                 * DAM inline 64 bits with context */
+        PROTNUM_IPV6_NONXT,
+    };
+    static const uint8_t exp_no_ctx[] = {
+        TEST_IPHC1,
+        0x00,   /* both addresses inline */
+        PROTNUM_IPV6_NONXT,
+    };
+    gnrc_pktsnip_t *pkt;
+
+    TEST_ASSERT_NOT_NULL(gnrc_sixlowpan_ctx_update(TEST_CTX_ID, &_prefix, 64,
+                                                   TEST_CTX_LTIME, true));
+    pkt = _flow(0, &_prefix);
+    for (unsigned i = 0; i < 2; i++) {
+        TEST_ASSERT_EQUAL_INT(sizeof(exp_ctx) + sizeof(eui64_t),
+                              gnrc_sixlowpan_iphc_encode_hdr(pkt, &_netif,
+                                                             _iphc_hdr));
+        TEST_ASSERT_EQUAL_INT(0, memcmp(exp_ctx, _iphc_hdr, sizeof(exp_ctx)));
+    }
+    /* the cached header must not be used after the context is gone */
+    gnrc_sixlowpan_ctx_remove(TEST_CTX_ID);
+    TEST_ASSERT_EQUAL_INT(sizeof(exp_no_ctx) + (2 * sizeof(ipv6_addr_t)),
+                          gnrc_sixlowpan_iphc_encode_hdr(pkt, &_netif,
+                                                         _iphc_hdr));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(exp_no_ctx, _iphc_hdr,
+                                    sizeof(exp_no_ctx)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(&_ipv6_hdrs[0].dst,
+                                    &_iphc_hdr[sizeof(exp_no_ctx) +
+                                               sizeof(ipv6_addr_t)],
+                                    sizeof(ipv6_addr_t)));
+}
+
+static void test_encode_hdr__more_flows_than_cached(void)
+{
+    static uint8_t exp[TEST_NUMOF_FLOWS][sizeof(_iphc_hdr)];
+    static size_t exp_len[TEST_NUMOF_FLOWS];
+
+    TEST_ASSERT_NOT_NULL(gnrc_sixlowpan_ctx_update(TEST_CTX_ID, &_prefix, 64,
+                                                   TEST_CTX_LTIME, true));
+    for (unsigned i = 0; i < TEST_NUMOF_FLOWS; i++) {
+        exp_len[i] = gnrc_sixlowpan_iphc_encode_hdr(_flow(i, &_prefix),
+                                                    &_netif, exp[i]);
+        TEST_ASSERT(exp_len[i] > 0);
+    }
+    /* in reverse to mix hits and misses */
+    for (unsigned i = TEST_NUMOF_FLOWS; i > 0; i--) {
+        TEST_ASSERT_EQUAL_INT(exp_len[i - 1],
+                              gnrc_sixlowpan_iphc_encode_hdr(&_pkts[i - 1],
+                                                             &_netif,
+                                                             _iphc_hdr));
+        TEST_ASSERT_EQUAL_INT(0, memcmp(exp[i - 1], _iphc_hdr,
+                                        exp_len[i - 1]));
+    }
+}
+
+static Test *tests_gnrc_sixlowpan_iphc_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_encode_hdr__link_local),
+        new_TestFixture(test_encode_hdr__l2addr_changed),
+        new_TestFixture(test_encode_hdr__ctx_removed),
+        new_TestFixture(test_encode_hdr__more_flows_than_cached),
+    };
+
+    EMB_UNIT_TESTCALLER(iphc_tests, set_up, NULL, fixtures);
+
+    return (Test *)&iphc_tests;
+}
+
+void tests_gnrc_sixlowpan_iphc(void)
+{
+    TESTS_RUN(tests_gnrc_sixlowpan_iphc_tests());
+}
+/** @} */
@@ -0,0 +1,35 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     unittests
+ * @{
+ *
+ * @file
+ * @brief       Unittests for the `gnrc_sixlowpan_iphc` module
+ */
+#ifndef TESTS_GNRC_SIXLOWPAN_IPHC_H
+#define TESTS_GNRC_SIXLOWPAN_IPHC_H
+
+#include "embUnit.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   The entry point of this test suite.
+ */
+void tests_gnrc_sixlowpan_iphc(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TESTS_GNRC_SIXLOWPAN_IPHC_H */
+/** @} */
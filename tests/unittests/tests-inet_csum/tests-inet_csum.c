@@ -13,6 +13,7 @@
  */
 #include <errno.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "embUnit.h"
 
@@ -21,6 +22,36 @@
 #include "unittests-constants.h"
 #include "tests-inet_csum.h"
 
+#define REF_MAX_LEN     (1500U)
+#define REF_OFFSETS     (8U)
+
+static uint8_t ref_buf[REF_MAX_LEN + REF_OFFSETS];
+
+/* straightforward implementation, folding one word at a time */
+static uint16_t _csum_ref(uint16_t sum, const uint8_t *buf, uint16_t len,
+                          size_t accum_len)
+{
+    uint32_t csum = sum;
+
+    for (unsigned i = 0; i < len; i++) {
+        csum += ((accum_len + i) & 1) ? buf[i] : (buf[i] << 8);
+    }
+    while (csum >> 16) {
+        csum = (csum & 0xffff) + (csum >> 16);
+    }
+    return csum;
+}
+
+static void _fill_ref_buf(void)
+{
+    uint32_t state = 0x2545f491;
+
+    for (unsigned i = 0; i < sizeof(ref_buf); i++) {
+        state = state * 1103515245 + 12345;
+        ref_buf[i] = state >> 24;
+    }
+}
+
 static void test_inet_csum__rfc_example(void)
 {
     /* source: https://tools.ietf.org/html/rfc1071#section-3 */
@@ -165,6 +196,51 @@ static void test_inet_csum__empty_app_buffer(void)
     TEST_ASSERT_EQUAL_INT(hdr_expected, pyld_sum);
 }
 
+static void test_inet_csum__reference(void)
+{
+    _fill_ref_buf();
+    /* every length at every alignment, starting at even and odd positions of
+     * the checksum domain */
+    for (unsigned len = 0; len <= REF_MAX_LEN; len++) {
+        for (unsigned offset = 0; offset < REF_OFFSETS; offset++) {
+            for (unsigned accum_len = 0; accum_len < 2; accum_len++) {
+                const uint8_t *buf = &ref_buf[offset];
+
+                TEST_ASSERT_EQUAL_INT(_csum_ref(0x1234, buf, len, accum_len),
+                                      inet_csum_slice(0x1234, buf, len, accum_len));
+            }
+        }
+    }
+}
+
+static void test_inet_csum__all_ones(void)
+{
+    /* maximizes carries in the accumulator */
+    memset(ref_buf, 0xff, sizeof(ref_buf));
+    for (unsigned offset = 0; offset < REF_OFFSETS; offset++) {
+        TEST_ASSERT_EQUAL_INT(_csum_ref(0xffff, &ref_buf[offset], REF_MAX_LEN, 0),
+                              inet_csum(0xffff, &ref_buf[offset], REF_MAX_LEN));
+    }
+}
+
+static void test_inet_csum__slices(void)
+{
+    _fill_ref_buf();
+    const uint16_t expected = inet_csum(0, ref_buf, REF_MAX_LEN);
+
+    /* checksum the domain in slices of odd and even length */
+    for (unsigned slice = 1; slice <= 64; slice++) {
+        uint16_t sum = 0;
+
+        for (unsigned pos = 0; pos < REF_MAX_LEN; pos += slice) {
+            unsigned len = (REF_MAX_LEN - pos < slice) ? REF_MAX_LEN - pos : slice;
+
+            sum = inet_csum_slice(sum, &ref_buf[pos], len, pos);
+        }
+        TEST_ASSERT_EQUAL_INT(expected, sum);
+    }
+}
+
 Test *tests_inet_csum_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -176,6 +252,9 @@ Test *tests_inet_csum_tests(void)
         new_TestFixture(test_inet_csum__odd_len),
         new_TestFixture(test_inet_csum__two_app_snips),
         new_TestFixture(test_inet_csum__empty_app_buffer),
+        new_TestFixture(test_inet_csum__reference),
+        new_TestFixture(test_inet_csum__all_ones),
+        new_TestFixture(test_inet_csum__slices),
     };
 
     EMB_UNIT_TESTCALLER(inet_csum_tests, NULL, NULL, fixtures);
@@ -13,6 +13,8 @@
  */
 #include <errno.h>
 
+#include "container.h"
+
 #include "embUnit.h"
 
 #include "net/gnrc/netreg.h"
@@ -185,6 +187,47 @@ void test_netreg_getnext__2_entries(void)
     gnrc_netreg_release_shared();
 }
 
+void test_netreg_getnext__many_demux_ctx(void)
+{
+    /* two entries for each demux context, so some share a bucket with other
+     * demux contexts */
+    static gnrc_netreg_entry_t many[4 * CONFIG_GNRC_NETREG_BUCKETS];
+    gnrc_netreg_entry_t *res;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(many); i++) {
+        gnrc_netreg_entry_init_pid(&many[i], TEST_UINT16 + (i / 2), i + 1);
+        TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(GNRC_NETTYPE_TEST,
+                                                      &many[i]));
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(many); i += 2) {
+        uint32_t demux_ctx = TEST_UINT16 + (i / 2);
+
+        gnrc_netreg_acquire_shared();
+        TEST_ASSERT_EQUAL_INT(2, gnrc_netreg_num(GNRC_NETTYPE_TEST, demux_ctx));
+        /* latest registration first */
+        TEST_ASSERT_NOT_NULL((res = gnrc_netreg_lookup(GNRC_NETTYPE_TEST,
+                                                       demux_ctx)));
+        TEST_ASSERT(&many[i + 1] == res);
+        TEST_ASSERT_NOT_NULL((res = gnrc_netreg_getnext(res)));
+        TEST_ASSERT(&many[i] == res);
+        TEST_ASSERT_NULL(gnrc_netreg_getnext(res));
+        gnrc_netreg_release_shared();
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(many); i += 2) {
+        gnrc_netreg_unregister(GNRC_NETTYPE_TEST, &many[i + 1]);
+    }
+    gnrc_netreg_acquire_shared();
+    for (unsigned i = 0; i < ARRAY_SIZE(many); i += 2) {
+        uint32_t demux_ctx = TEST_UINT16 + (i / 2);
+
+        TEST_ASSERT_NOT_NULL((res = gnrc_netreg_lookup(GNRC_NETTYPE_TEST,
+                                                       demux_ctx)));
+        TEST_ASSERT(&many[i] == res);
+        TEST_ASSERT_NULL(gnrc_netreg_getnext(res));
+    }
+    gnrc_netreg_release_shared();
+}
+
 Test *tests_netreg_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -201,6 +244,7 @@ Test *tests_netreg_tests(void)
         new_TestFixture(test_netreg_num__2_entries),
         new_TestFixture(test_netreg_getnext__NULL),
         new_TestFixture(test_netreg_getnext__2_entries),
+        new_TestFixture(test_netreg_getnext__many_demux_ctx),
     };
 
     EMB_UNIT_TESTCALLER(netreg_tests, set_up, NULL, fixtures);
@@ -213,6 +213,108 @@ static void test_add(void)
     }
 }
 
+static void test_add_get_wrap(void)
+{
+    for (int i = 0; i < (int)sizeof(_io_buffer); i++) {
+        _io_buffer[i] = TEST_INPUT + i;
+    }
+    /* move read and write position to the middle of the buffer */
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE / 2 + 1,
+                          tsrb_add(&_tsrb, _io_buffer, BUFFER_SIZE / 2 + 1));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE / 2 + 1,
+                          tsrb_drop(&_tsrb, BUFFER_SIZE / 2 + 1));
+
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, tsrb_add(&_tsrb, _io_buffer,
+                                                sizeof(_io_buffer)));
+    TEST_ASSERT_EQUAL_INT(1, tsrb_full(&_tsrb));
+    memset(_io_buffer, IO_BUFFER_CANARY, sizeof(_io_buffer));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, tsrb_peek(&_tsrb, _io_buffer,
+                                                 sizeof(_io_buffer)));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, tsrb_get(&_tsrb, &_io_buffer[BUFFER_SIZE],
+                                                BUFFER_SIZE));
+    for (int i = 0; i < BUFFER_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT((uint8_t)(TEST_INPUT + i), _io_buffer[i]);
+        TEST_ASSERT_EQUAL_INT((uint8_t)(TEST_INPUT + i),
+                              _io_buffer[BUFFER_SIZE + i]);
+    }
+    TEST_ASSERT_EQUAL_INT(1, tsrb_empty(&_tsrb));
+}
+
+static void test_peek_regions(void)
+{
+    tsrb_region_t regions[2];
+
+    TEST_ASSERT_EQUAL_INT(0, tsrb_peek_regions(&_tsrb, regions));
+    TEST_ASSERT_EQUAL_INT(0, regions[0].len + regions[1].len);
+
+    for (int i = 0; i < BUFFER_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT(0, tsrb_add_one(&_tsrb, TEST_INPUT + i));
+    }
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - TEST_DROP_NUM,
+                          tsrb_drop(&_tsrb, BUFFER_SIZE - TEST_DROP_NUM));
+    for (int i = 0; i < BUFFER_SIZE - (int)TEST_DROP_NUM; i++) {
+        TEST_ASSERT_EQUAL_INT(0, tsrb_add_one(&_tsrb, TEST_INPUT + BUFFER_SIZE + i));
+    }
+
+    /* the data wraps around the end of the buffer */
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, tsrb_peek_regions(&_tsrb, regions));
+    TEST_ASSERT_EQUAL_INT(TEST_DROP_NUM, regions[0].len);
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - TEST_DROP_NUM, regions[1].len);
+    TEST_ASSERT(regions[1].data == _tsrb_buffer);
+    for (int i = 0; i < (int)TEST_DROP_NUM; i++) {
+        TEST_ASSERT_EQUAL_INT((uint8_t)(TEST_INPUT + BUFFER_SIZE - TEST_DROP_NUM + i),
+                              regions[0].data[i]);
+    }
+    for (int i = 0; i < BUFFER_SIZE - (int)TEST_DROP_NUM; i++) {
+        TEST_ASSERT_EQUAL_INT((uint8_t)(TEST_INPUT + BUFFER_SIZE + i),
+                              regions[1].data[i]);
+    }
+
+    /* peeking doesn't consume */
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, tsrb_avail(&_tsrb));
+    TEST_ASSERT_EQUAL_INT(TEST_DROP_NUM, tsrb_drop(&_tsrb, regions[0].len));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - TEST_DROP_NUM,
+                          tsrb_peek_regions(&_tsrb, regions));
+    TEST_ASSERT(regions[0].data == _tsrb_buffer);
+    TEST_ASSERT_EQUAL_INT(0, regions[1].len);
+}
+
+static void test_free_regions_commit(void)
+{
+    tsrb_region_t regions[2];
+
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, tsrb_free_regions(&_tsrb, regions));
+    TEST_ASSERT(regions[0].data == _tsrb_buffer);
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, regions[0].len);
+    TEST_ASSERT_EQUAL_INT(0, regions[1].len);
+
+    for (int i = 0; i < BUFFER_SIZE - (int)TEST_DROP_NUM; i++) {
+        TEST_ASSERT_EQUAL_INT(0, tsrb_add_one(&_tsrb, TEST_INPUT));
+    }
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - TEST_DROP_NUM,
+                          tsrb_drop(&_tsrb, BUFFER_SIZE));
+
+    /* the free space wraps around the end of the buffer */
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, tsrb_free_regions(&_tsrb, regions));
+    TEST_ASSERT_EQUAL_INT(TEST_DROP_NUM, regions[0].len);
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - TEST_DROP_NUM, regions[1].len);
+    for (unsigned i = 0; i < regions[0].len; i++) {
+        regions[0].data[i] = TEST_INPUT + i;
+    }
+    regions[1].data[0] = TEST_INPUT + regions[0].len;
+
+    /* nothing is visible before committing */
+    TEST_ASSERT_EQUAL_INT(1, tsrb_empty(&_tsrb));
+    tsrb_commit(&_tsrb, TEST_DROP_NUM + 1);
+    TEST_ASSERT_EQUAL_INT(TEST_DROP_NUM + 1, tsrb_avail(&_tsrb));
+    TEST_ASSERT_EQUAL_INT(TEST_DROP_NUM + 1,
+                          tsrb_get(&_tsrb, _io_buffer, sizeof(_io_buffer)));
+    for (int i = 0; i < (int)TEST_DROP_NUM + 1; i++) {
+        TEST_ASSERT_EQUAL_INT((uint8_t)(TEST_INPUT + i), _io_buffer[i]);
+    }
+    TEST_ASSERT_EQUAL_INT(IO_BUFFER_CANARY, _io_buffer[TEST_DROP_NUM + 1]);
+}
+
 static Test *tests_tsrb_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -228,6 +330,9 @@ static Test *tests_tsrb_tests(void)
         new_TestFixture(test_drop),
         new_TestFixture(test_add_one),
         new_TestFixture(test_add),
+        new_TestFixture(test_add_get_wrap),
+        new_TestFixture(test_peek_regions),
+        new_TestFixture(test_free_regions_commit),
     };
 
     EMB_UNIT_TESTCALLER(tsrb_tests, NULL, tear_down, fixtures);
@@ -380,6 +380,45 @@ static void test_ztimer_mock_remove(void)
     TEST_ASSERT_EQUAL_INT(2, count);
 }
 
+/**
+ * @brief   Testing the time until the next timer is due
+ */
+static void test_ztimer_mock_until_next(void)
+{
+    ztimer_mock_t zmock;
+    ztimer_clock_t *z = &zmock.super;
+
+    ztimer_mock_init(&zmock, 32);
+    TEST_ASSERT_EQUAL_INT(UINT32_MAX, ztimer_until_next(z));
+
+    uint32_t count = 0;
+    ztimer_t alarms[] = {
+        { .callback = cb_incr, .arg = &count },
+        { .callback = cb_incr, .arg = &count },
+    };
+
+    ztimer_set(z, &alarms[0], 1000);
+    ztimer_set(z, &alarms[1], 300);
+    TEST_ASSERT_EQUAL_INT(300, ztimer_until_next(z));
+
+    /* time passing without the clock being serviced counts, too */
+    ztimer_mock_jump(&zmock, 100);
+    TEST_ASSERT_EQUAL_INT(200, ztimer_until_next(z));
+
+    ztimer_mock_jump(&zmock, 300);
+    ztimer_mock_fire(&zmock);
+    TEST_ASSERT_EQUAL_INT(1, count);
+    TEST_ASSERT_EQUAL_INT(700, ztimer_until_next(z));
+
+    /* overdue, but not yet handled */
+    ztimer_mock_jump(&zmock, 1100);
+    TEST_ASSERT_EQUAL_INT(0, ztimer_until_next(z));
+
+    ztimer_mock_fire(&zmock);
+    TEST_ASSERT_EQUAL_INT(2, count);
+    TEST_ASSERT_EQUAL_INT(UINT32_MAX, ztimer_until_next(z));
+}
+
 Test *tests_ztimer_mock_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -391,6 +430,7 @@ Test *tests_ztimer_mock_tests(void)
         new_TestFixture(test_ztimer_mock_set16),
         new_TestFixture(test_ztimer_mock_is_set),
         new_TestFixture(test_ztimer_mock_remove),
+        new_TestFixture(test_ztimer_mock_until_next),
     };
 
     EMB_UNIT_TESTCALLER(ztimer_tests, NULL, NULL, fixtures);
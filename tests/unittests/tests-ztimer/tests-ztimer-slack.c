@@ -0,0 +1,151 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       Unittests for ztimer_set_with_slack()
+ */
+
+#include "ztimer.h"
+#include "ztimer/mock.h"
+
+#include "embUnit/embUnit.h"
+
+#include "tests-ztimer.h"
+
+typedef struct {
+    ztimer_t timer;
+    ztimer_mock_t *mock;
+    uint32_t fired_at;
+    unsigned count;
+} _timer_t;
+
+static ztimer_mock_t _zmock;
+static _timer_t _timers[3];
+
+static void _cb(void *arg)
+{
+    _timer_t *t = arg;
+
+    t->fired_at = t->mock->now;
+    t->count++;
+}
+
+static void _setup(void)
+{
+    ztimer_mock_init(&_zmock, 32);
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_timers); i++) {
+        _timers[i] = (_timer_t){
+            .timer = { .callback = _cb, .arg = &_timers[i] },
+            .mock = &_zmock,
+        };
+    }
+}
+
+/**
+ * @brief   a timer with slack is merged into a later expiration in range
+ */
+static void test_ztimer_slack_coalesce(void)
+{
+    ztimer_clock_t *z = &_zmock.super;
+
+    _setup();
+
+    ztimer_set(z, &_timers[0].timer, 100);
+    ztimer_set_with_slack(z, &_timers[1].timer, 90, 20);
+    TEST_ASSERT_EQUAL_INT(1, z->coalesced);
+    TEST_ASSERT_EQUAL_INT(100, _zmock.target);
+
+    ztimer_mock_advance(&_zmock, 99);
+    TEST_ASSERT_EQUAL_INT(0, _timers[0].count);
+    TEST_ASSERT_EQUAL_INT(0, _timers[1].count);
+
+    unsigned sets = _zmock.calls.set;
+    ztimer_mock_advance(&_zmock, 1);
+    TEST_ASSERT_EQUAL_INT(1, _timers[0].count);
+    TEST_ASSERT_EQUAL_INT(1, _timers[1].count);
+    TEST_ASSERT_EQUAL_INT(100, _timers[1].fired_at);
+    /* both fired from the same pass, without re-arming the clock */
+    TEST_ASSERT_EQUAL_INT(sets, _zmock.calls.set);
+    TEST_ASSERT(!_zmock.armed);
+}
+
+/**
+ * @brief   expirations outside of the slack window are left alone
+ */
+static void test_ztimer_slack_out_of_range(void)
+{
+    ztimer_clock_t *z = &_zmock.super;
+
+    _setup();
+
+    ztimer_set(z, &_timers[0].timer, 100);
+    ztimer_set(z, &_timers[1].timer, 50);
+    /* the nearest later expiration is 21 ticks away */
+    ztimer_set_with_slack(z, &_timers[2].timer, 79, 20);
+    TEST_ASSERT_EQUAL_INT(0, z->coalesced);
+
+    ztimer_mock_advance(&_zmock, 79);
+    TEST_ASSERT_EQUAL_INT(1, _timers[1].count);
+    TEST_ASSERT_EQUAL_INT(1, _timers[2].count);
+    TEST_ASSERT_EQUAL_INT(79, _timers[2].fired_at);
+    TEST_ASSERT_EQUAL_INT(0, _timers[0].count);
+
+    /* a timer is never moved onto an earlier expiration */
+    ztimer_set_with_slack(z, &_timers[2].timer, 22, 100);
+    TEST_ASSERT_EQUAL_INT(0, z->coalesced);
+    ztimer_mock_advance(&_zmock, 21);
+    TEST_ASSERT_EQUAL_INT(1, _timers[0].count);
+    TEST_ASSERT_EQUAL_INT(1, _timers[2].count);
+    ztimer_mock_advance(&_zmock, 1);
+    TEST_ASSERT_EQUAL_INT(2, _timers[2].count);
+    TEST_ASSERT_EQUAL_INT(101, _timers[2].fired_at);
+}
+
+/**
+ * @brief   re-setting a timer with slack doesn't merge it with itself
+ */
+static void test_ztimer_slack_reset(void)
+{
+    ztimer_clock_t *z = &_zmock.super;
+
+    _setup();
+
+    ztimer_set(z, &_timers[0].timer, 100);
+    ztimer_set_with_slack(z, &_timers[0].timer, 50, 100);
+    TEST_ASSERT_EQUAL_INT(0, z->coalesced);
+    TEST_ASSERT_EQUAL_INT(50, _zmock.target);
+
+    ztimer_set(z, &_timers[1].timer, 60);
+    ztimer_set_with_slack(z, &_timers[0].timer, 50, 10);
+    TEST_ASSERT_EQUAL_INT(1, z->coalesced);
+    TEST_ASSERT_EQUAL_INT(60, _zmock.target);
+
+    ztimer_mock_advance(&_zmock, 60);
+    TEST_ASSERT_EQUAL_INT(1, _timers[0].count);
+    TEST_ASSERT_EQUAL_INT(1, _timers[1].count);
+    TEST_ASSERT_EQUAL_INT(60, _timers[0].fired_at);
+}
+
+Test *tests_ztimer_slack_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_ztimer_slack_coalesce),
+        new_TestFixture(test_ztimer_slack_out_of_range),
+        new_TestFixture(test_ztimer_slack_reset),
+    };
+
+    EMB_UNIT_TESTCALLER(ztimer_tests, NULL, NULL, fixtures);
+
+    return (Test *)&ztimer_tests;
+}
+
+/** @} */
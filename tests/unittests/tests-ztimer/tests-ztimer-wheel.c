@@ -0,0 +1,275 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       Unittests for the ztimer timing wheel
+ */
+
+#include "ztimer.h"
+#include "ztimer/mock.h"
+#include "ztimer/wheel.h"
+
+#include "embUnit/embUnit.h"
+
+#include "tests-ztimer.h"
+
+#define WHEEL_SHIFT     (4U)
+#define TIMERS_NUMOF    (64U)
+
+typedef struct {
+    ztimer_t timer;
+    ztimer_mock_t *mock;
+    uint32_t target;
+    uint32_t fired_at;
+    unsigned count;
+} _timer_t;
+
+static ztimer_mock_t _zmock;
+static ztimer_wheel_t _wheel;
+static _timer_t _timers[TIMERS_NUMOF];
+
+static void _cb(void *arg)
+{
+    _timer_t *t = arg;
+
+    t->fired_at = t->mock->now;
+    t->count++;
+}
+
+static void _setup(void)
+{
+    ztimer_mock_init(&_zmock, 32);
+    ztimer_wheel_init(&_zmock.super, &_wheel, WHEEL_SHIFT);
+
+    for (unsigned i = 0; i < TIMERS_NUMOF; i++) {
+        _timers[i] = (_timer_t){
+            .timer = { .callback = _cb, .arg = &_timers[i] },
+            .mock = &_zmock,
+        };
+    }
+}
+
+static void _set(_timer_t *t, uint32_t val)
+{
+    t->target = _zmock.now + val;
+    ztimer_set(&_zmock.super, &t->timer, val);
+}
+
+/* a simple LCG is good enough to scatter the timers over the wheel */
+static uint32_t _rand(uint32_t *state)
+{
+    *state = *state * 1103515245ul + 12345;
+    return *state >> 8;
+}
+
+static void test_ztimer_wheel_near_far(void)
+{
+    ztimer_clock_t *z = &_zmock.super;
+
+    _setup();
+
+    /* within the current slot: goes into the list */
+    _set(&_timers[0], 3);
+    TEST_ASSERT(!_timers[0].timer.base.prev);
+    /* far away: goes into the wheel */
+    _set(&_timers[1], 1000);
+    TEST_ASSERT(_timers[1].timer.base.prev);
+    TEST_ASSERT_EQUAL_INT(1, _wheel.count);
+    TEST_ASSERT(ztimer_is_set(z, &_timers[0].timer));
+    TEST_ASSERT(ztimer_is_set(z, &_timers[1].timer));
+
+    /* only the near timer may arm the clock */
+    TEST_ASSERT_EQUAL_INT(3, _zmock.target);
+
+    ztimer_mock_advance(&_zmock, 999);
+    TEST_ASSERT_EQUAL_INT(1, _timers[0].count);
+    TEST_ASSERT_EQUAL_INT(3, _timers[0].fired_at);
+    TEST_ASSERT_EQUAL_INT(0, _timers[1].count);
+    TEST_ASSERT(!ztimer_is_set(z, &_timers[0].timer));
+    TEST_ASSERT(ztimer_is_set(z, &_timers[1].timer));
+
+    ztimer_mock_advance(&_zmock, 1);
+    TEST_ASSERT_EQUAL_INT(1, _timers[1].count);
+    TEST_ASSERT_EQUAL_INT(1000, _timers[1].fired_at);
+    TEST_ASSERT(!ztimer_is_set(z, &_timers[1].timer));
+    TEST_ASSERT_EQUAL_INT(0, _wheel.count);
+    TEST_ASSERT(!_zmock.armed);
+}
+
+static void test_ztimer_wheel_remove(void)
+{
+    ztimer_clock_t *z = &_zmock.super;
+
+    _setup();
+
+    _set(&_timers[0], 500);
+    _set(&_timers[1], 500);
+    _set(&_timers[2], 700);
+    TEST_ASSERT_EQUAL_INT(3, _wheel.count);
+
+    TEST_ASSERT(ztimer_remove(z, &_timers[1].timer));
+    TEST_ASSERT(!ztimer_is_set(z, &_timers[1].timer));
+    TEST_ASSERT(!ztimer_remove(z, &_timers[1].timer));
+    TEST_ASSERT_EQUAL_INT(2, _wheel.count);
+
+    /* re-setting a timer in the wheel moves it */
+    _set(&_timers[0], 600);
+    TEST_ASSERT_EQUAL_INT(2, _wheel.count);
+
+    ztimer_mock_advance(&_zmock, 1000);
+    TEST_ASSERT_EQUAL_INT(1, _timers[0].count);
+    TEST_ASSERT_EQUAL_INT(600, _timers[0].fired_at);
+    TEST_ASSERT_EQUAL_INT(0, _timers[1].count);
+    TEST_ASSERT_EQUAL_INT(1, _timers[2].count);
+    TEST_ASSERT_EQUAL_INT(700, _timers[2].fired_at);
+}
+
+static void test_ztimer_wheel_dirty(void)
+{
+    ztimer_clock_t *z = &_zmock.super;
+    ztimer_base_t trap = { .next = NULL, .prev = NULL, .offset = 1000 };
+    ztimer_t dirty = { .callback = _cb, .arg = &_timers[1] };
+
+    _setup();
+
+    /* the wheel is not empty, and the garbage offset hashes to an occupied slot */
+    _set(&_timers[0], 1000);
+    TEST_ASSERT_EQUAL_INT(1, _wheel.count);
+
+    /* an uninitialised timer, with prev and offset pointing somewhere */
+    dirty.base.prev = &trap;
+    dirty.base.offset = 1000;
+    TEST_ASSERT(!ztimer_is_set(z, &dirty));
+    TEST_ASSERT(!ztimer_remove(z, &dirty));
+    TEST_ASSERT_NULL(trap.next);
+    TEST_ASSERT_EQUAL_INT(1, _wheel.count);
+
+    /* setting it into the list must not leave a stale prev behind */
+    _timers[1].mock = &_zmock;
+    _timers[1].target = _zmock.now + 3;
+    ztimer_set(z, &dirty, 3);
+    TEST_ASSERT_NULL(dirty.base.prev);
+    TEST_ASSERT(ztimer_is_set(z, &dirty));
+    TEST_ASSERT(ztimer_remove(z, &dirty));
+    TEST_ASSERT(!ztimer_is_set(z, &dirty));
+    TEST_ASSERT_NULL(trap.next);
+    TEST_ASSERT_EQUAL_INT(1, _wheel.count);
+
+    /* re-setting it from dirty state into the wheel works as well */
+    dirty.base.prev = &trap;
+    dirty.base.next = NULL;
+    ztimer_set(z, &dirty, 700);
+    TEST_ASSERT_EQUAL_INT(2, _wheel.count);
+    TEST_ASSERT_NULL(trap.next);
+
+    ztimer_mock_advance(&_zmock, 1000);
+    TEST_ASSERT_EQUAL_INT(1, _timers[0].count);
+    TEST_ASSERT_EQUAL_INT(1, _timers[1].count);
+    TEST_ASSERT_EQUAL_INT(700, _timers[1].fired_at);
+    TEST_ASSERT_EQUAL_INT(0, _wheel.count);
+}
+
+static void test_ztimer_wheel_revolutions(void)
+{
+    const uint32_t revolution = CONFIG_ZTIMER_WHEEL_SLOTS << WHEEL_SHIFT;
+
+    _setup();
+
+    /* timers sharing a slot, but several revolutions apart */
+    _set(&_timers[0], revolution + 20);
+    _set(&_timers[1], 3 * revolution + 20);
+    _set(&_timers[2], 0x80000000ul);
+
+    ztimer_mock_advance(&_zmock, revolution + 20);
+    TEST_ASSERT_EQUAL_INT(1, _timers[0].count);
+    TEST_ASSERT_EQUAL_INT(0, _timers[1].count);
+    ztimer_mock_advance(&_zmock, 2 * revolution - 1);
+    TEST_ASSERT_EQUAL_INT(0, _timers[1].count);
+    ztimer_mock_advance(&_zmock, 1);
+    TEST_ASSERT_EQUAL_INT(1, _timers[1].count);
+    TEST_ASSERT_EQUAL_INT(_timers[1].target, _timers[1].fired_at);
+
+    ztimer_mock_advance(&_zmock, 0x80000000ul);
+    TEST_ASSERT_EQUAL_INT(1, _timers[2].count);
+    TEST_ASSERT_EQUAL_INT(0x80000000ul, _timers[2].fired_at);
+}
+
+static void test_ztimer_wheel_random(void)
+{
+    uint32_t seed = 42;
+
+    _setup();
+
+    for (unsigned round = 0; round < 4; round++) {
+        for (unsigned i = 0; i < TIMERS_NUMOF; i++) {
+            _set(&_timers[i], _rand(&seed) % 5000);
+        }
+        /* remove every fifth timer again */
+        for (unsigned i = 0; i < TIMERS_NUMOF; i += 5) {
+            ztimer_remove(&_zmock.super, &_timers[i].timer);
+        }
+        /* advance in odd steps to hit the slot boundaries at random */
+        for (unsigned step = 0; step < 5000 / 7 + 1; step++) {
+            ztimer_mock_advance(&_zmock, 7);
+        }
+        for (unsigned i = 0; i < TIMERS_NUMOF; i++) {
+            if (i % 5 == 0) {
+                TEST_ASSERT_EQUAL_INT(0, _timers[i].count);
+            }
+            else {
+                TEST_ASSERT_EQUAL_INT(round + 1, _timers[i].count);
+                TEST_ASSERT_EQUAL_INT(_timers[i].target, _timers[i].fired_at);
+            }
+        }
+        TEST_ASSERT_EQUAL_INT(0, _wheel.count);
+        TEST_ASSERT_NULL(_zmock.super.list.next);
+    }
+}
+
+static void test_ztimer_wheel_extend(void)
+{
+    _setup();
+    ztimer_mock_init(&_zmock, 16);
+    _zmock.super.wheel = NULL;
+    ztimer_wheel_init(&_zmock.super, &_wheel, WHEEL_SHIFT);
+    ztimer_acquire(&_zmock.super);
+
+    _set(&_timers[0], 100000);
+    _set(&_timers[1], 300);
+    ztimer_mock_advance(&_zmock, 300);
+    TEST_ASSERT_EQUAL_INT(1, _timers[1].count);
+    TEST_ASSERT_EQUAL_INT(0, _timers[0].count);
+    ztimer_mock_advance(&_zmock, 100000 - 300 - 1);
+    TEST_ASSERT_EQUAL_INT(0, _timers[0].count);
+    ztimer_mock_advance(&_zmock, 1);
+    TEST_ASSERT_EQUAL_INT(1, _timers[0].count);
+    TEST_ASSERT_EQUAL_INT(100000, ztimer_now(&_zmock.super));
+
+    ztimer_release(&_zmock.super);
+}
+
+Test *tests_ztimer_wheel_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_ztimer_wheel_near_far),
+        new_TestFixture(test_ztimer_wheel_remove),
+        new_TestFixture(test_ztimer_wheel_dirty),
+        new_TestFixture(test_ztimer_wheel_revolutions),
+        new_TestFixture(test_ztimer_wheel_random),
+        new_TestFixture(test_ztimer_wheel_extend),
+    };
+
+    EMB_UNIT_TESTCALLER(ztimer_tests, NULL, NULL, fixtures);
+
+    return (Test *)&ztimer_tests;
+}
+
+/** @} */